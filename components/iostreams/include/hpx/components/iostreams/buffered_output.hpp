@@ -0,0 +1,135 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/synchronization/mutex.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <hpx/components/iostreams/export_definitions.hpp>
+#include <hpx/components/iostreams/server/buffer.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hpx::iostreams::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Configuration of the output buffering of the standard streams, read from
+    // the [hpx.iostreams] configuration section:
+    //
+    //   hpx.iostreams.buffered       = 0    (buffer output per worker thread)
+    //   hpx.iostreams.buffer_size    = 4096 (flush once a worker thread has
+    //                                        buffered that many characters)
+    //   hpx.iostreams.flush_interval = 100  (flush output at most 100ms after
+    //                                        it was written)
+    //   hpx.iostreams.ordered        = 1    (keep the output of a locality in
+    //                                        order)
+    //   hpx.iostreams.local_file     =      (write hpx::cout to this file
+    //                                        instead of the console, use
+    //                                        $[hpx.locality] to generate one
+    //                                        file per locality)
+    struct buffered_output_settings
+    {
+        bool buffered = false;
+        std::size_t buffer_size = 4096;
+        std::chrono::milliseconds flush_interval{100};
+        bool ordered = true;
+        std::string local_file;
+    };
+
+    HPX_IOSTREAMS_EXPORT buffered_output_settings
+    get_buffered_output_settings();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Collects the completed output of an ostream in one buffer per worker
+    // thread. The buffered output is flushed as a whole, i.e. it is sent to
+    // the console with a single action, once the buffer of one of the worker
+    // threads exceeds the configured size, or once the flush interval has
+    // elapsed after output was buffered. No task is kept alive while no
+    // output is pending as this would prevent the runtime from shutting down.
+    //
+    // Every piece of output is tagged with a sequence number, the collected
+    // output is ordered by those. This keeps the output of a task in order
+    // even if it moved from one worker thread to another.
+    class HPX_IOSTREAMS_EXPORT buffered_output
+    {
+    public:
+        buffered_output(buffered_output_settings const& settings,
+            hpx::function<void()> flush);
+
+        buffered_output(buffered_output const&) = delete;
+        buffered_output(buffered_output&&) = delete;
+        buffered_output& operator=(buffered_output const&) = delete;
+        buffered_output& operator=(buffered_output&&) = delete;
+
+        ~buffered_output();
+
+        // Append the given output to the buffer of the calling worker
+        // thread, returns whether the buffered output should be flushed
+        // immediately.
+        bool append(buffer const& data);
+
+        // Remove all buffered output and return it in a single buffer, the
+        // given output is appended to the result.
+        buffer collect(buffer const& data = buffer());
+
+        // No flush is scheduled or executed anymore once this returns.
+        void stop();
+
+        bool ordered() const noexcept
+        {
+            return ordered_;
+        }
+
+    private:
+        // the buffered output of one thread, each piece of output is
+        // preceded by its sequence number and its size
+        struct thread_buffer
+        {
+            hpx::spinlock mtx_;
+            std::vector<char> data_;
+        };
+
+        // The state needed by a scheduled flush, which may still be pending
+        // when this object is destroyed. The mutex is held while flushing.
+        struct flush_state
+        {
+            flush_state(std::chrono::milliseconds flush_interval,
+                hpx::function<void()> flush)
+              : flush_interval_(flush_interval)
+              , flush_(HPX_MOVE(flush))
+              , flush_scheduled_(false)
+            {
+            }
+
+            std::chrono::milliseconds flush_interval_;
+            hpx::function<void()> flush_;
+            std::atomic<bool> flush_scheduled_;
+
+            hpx::mutex mtx_;
+            bool stopped_ = false;
+        };
+
+        // flush the buffered output once the flush interval has elapsed
+        void schedule_flush();
+
+        std::vector<hpx::util::cache_aligned_data<thread_buffer>> buffers_;
+        std::size_t buffer_size_;
+        bool ordered_;
+        std::atomic<std::uint64_t> sequence_number_;
+        std::atomic<bool> stopped_;
+        std::shared_ptr<flush_state> flush_state_;
+    };
+}    // namespace hpx::iostreams::detail
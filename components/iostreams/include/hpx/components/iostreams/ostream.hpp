@@ -12,6 +12,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/async_distributed/post.hpp>
 #include <hpx/components/client_base.hpp>
+#include <hpx/components/iostreams/buffered_output.hpp>
 #include <hpx/components/iostreams/manipulators.hpp>
 #include <hpx/components/iostreams/server/output_stream.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
@@ -24,6 +25,7 @@
 #include <cstdint>
 #include <ios>
 #include <iterator>
+#include <memory>
 #include <mutex>
 #include <ostream>
 #include <sstream>
@@ -143,6 +145,28 @@ namespace hpx { namespace iostreams {
                 get_outstream_name(tag), detail::get_outstream(tag));
         }
 
+        // create a stream object writing to the given file on this locality
+        hpx::future<hpx::id_type> create_local_ostream(
+            std::string const& filename);
+
+        template <typename Tag>
+        hpx::future<hpx::id_type> create_ostream(
+            Tag tag, buffered_output_settings const&)
+        {
+            return create_ostream(tag);
+        }
+
+        // only hpx::cout can be redirected to a local file
+        inline hpx::future<hpx::id_type> create_ostream(
+            cout_tag tag, buffered_output_settings const& settings)
+        {
+            if (!settings.local_file.empty())
+            {
+                return create_local_ostream(settings.local_file);
+            }
+            return create_ostream(tag);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         HPX_IOSTREAMS_EXPORT void release_ostream(
             char const* name, hpx::id_type const& id);
@@ -184,6 +208,9 @@ namespace hpx { namespace iostreams {
         using detail::buffer::mtx_;
         std::atomic<std::uint64_t> generational_count_;
 
+        // the output of the worker threads, if enabled
+        std::unique_ptr<detail::buffered_output> buffered_;
+
         // Performs a lazy streaming operation.
         template <typename T>
         ostream& streaming_operator_lazy(T const& subject)
@@ -211,6 +238,15 @@ namespace hpx { namespace iostreams {
                 // Unlock the mutex before we cleanup.
                 l.unlock();
 
+                if (buffered_)
+                {
+                    if (buffered_->append(next))
+                    {
+                        flush_buffered();
+                    }
+                    return *this;
+                }
+
                 // Perform the write operation, then destroy the old buffer and
                 // stream.
                 typedef server::output_stream::write_async_action action_type;
@@ -239,6 +275,13 @@ namespace hpx { namespace iostreams {
             // Create the next buffer, returns the previous buffer
             buffer next = this->detail::buffer::init_locked();
 
+            // Send all output buffered by the worker threads along with it.
+            if (buffered_)
+            {
+                next = buffered_->collect(next);
+            }
+            std::uint64_t const count = generational_count_++;
+
             // 26110: Caller failing to hold lock 'l'
 #if defined(HPX_MSVC)
 #pragma warning(push)
@@ -253,8 +296,8 @@ namespace hpx { namespace iostreams {
             // Perform the write operation, then destroy the old buffer and
             // stream.
             typedef server::output_stream::write_sync_action action_type;
-            hpx::async<action_type>(this->get_id(), hpx::get_locality_id(),
-                generational_count_++, next)
+            hpx::async<action_type>(
+                this->get_id(), hpx::get_locality_id(), count, next)
                 .get();
 
 #else
@@ -285,6 +328,15 @@ namespace hpx { namespace iostreams {
                 // recursively
                 [[maybe_unused]] hpx::util::ignore_while_checking il(&l);
 
+                if (buffered_)
+                {
+                    if (buffered_->append(next))
+                    {
+                        flush_buffered();
+                    }
+                    return true;
+                }
+
                 // Perform the write operation, then destroy the old buffer and
                 // stream.
                 typedef server::output_stream::write_async_action action_type;
@@ -298,6 +350,47 @@ namespace hpx { namespace iostreams {
 #endif
         }
 
+        // Send the output buffered by all worker threads with a single action.
+        void flush_buffered()
+        {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+            std::unique_lock<mutex_type> l(*mtx_);
+            if (!buffered_)
+            {
+                return;
+            }
+
+            buffer next = buffered_->collect();
+            if (next.empty_locked())
+            {
+                return;
+            }
+
+            // the output is sent in the order it was collected
+            bool const ordered = buffered_->ordered();
+            std::uint64_t const count = ordered ? generational_count_++ : 0;
+
+            l.unlock();
+
+            [[maybe_unused]] hpx::util::ignore_while_checking il(&l);
+
+            if (ordered)
+            {
+                typedef server::output_stream::write_async_action action_type;
+                hpx::post<action_type>(
+                    this->get_id(), hpx::get_locality_id(), count, next);
+            }
+            else
+            {
+                typedef server::output_stream::write_unordered_action
+                    action_type;
+                hpx::post<action_type>(this->get_id(), next);
+            }
+#else
+            HPX_ASSERT(false);
+#endif
+        }
+
         ///////////////////////////////////////////////////////////////////////
         friend void detail::register_ostreams();
         friend void detail::unregister_ostreams();
@@ -306,13 +399,28 @@ namespace hpx { namespace iostreams {
         template <typename Tag>
         void initialize(Tag tag)
         {
-            *static_cast<base_type*>(this) = detail::create_ostream(tag);
+            detail::buffered_output_settings const settings =
+                detail::get_buffered_output_settings();
+
+            *static_cast<base_type*>(this) =
+                detail::create_ostream(tag, settings);
+
+            if (settings.buffered)
+            {
+                buffered_ = std::make_unique<detail::buffered_output>(
+                    settings, [this]() { flush_buffered(); });
+            }
         }
 
         // reset this object during runtime system shutdown
         template <typename Tag>
         void uninitialize(Tag tag)
         {
+            if (buffered_)
+            {
+                buffered_->stop();
+            }
+
             std::unique_lock<mutex_type> l(*mtx_, std::try_to_lock);
             if (l)
             {
@@ -323,6 +431,9 @@ namespace hpx { namespace iostreams {
             // FIXME: find a later spot to invoke this
             detail::release_ostream(tag, this->get_id());
             this->base_type::free();
+
+            // the buffers must not outlive the runtime system
+            buffered_.reset();
         }
 
     public:
@@ -13,7 +13,9 @@
 #include <hpx/components/iostreams/export_definitions.hpp>
 #include <hpx/components/iostreams/write_functions.hpp>
 
+#include <algorithm>
 #include <iosfwd>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -32,6 +34,12 @@ namespace hpx { namespace iostreams { namespace detail {
         {
         }
 
+        explicit buffer(std::vector<char>&& data)
+          : data_(std::make_shared<std::vector<char>>(HPX_MOVE(data)))
+          , mtx_(new mutex_type)
+        {
+        }
+
         buffer(buffer const& rhs)
           : data_(rhs.data_)
           , mtx_(rhs.mtx_)
@@ -96,6 +104,16 @@ namespace hpx { namespace iostreams { namespace detail {
             return n;
         }
 
+        // append the characters held by this buffer to the given vector
+        void append_to(std::vector<char>& data) const
+        {
+            std::lock_guard<mutex_type> l(*mtx_);
+            if (data_.get())
+            {
+                data.insert(data.end(), data_->begin(), data_->end());
+            }
+        }
+
         template <typename Mutex>
         void write(write_function_type const& f, Mutex& mtx)
         {
@@ -44,6 +44,8 @@ namespace hpx { namespace iostreams { namespace server {
             detail::buffer const& in, hpx::id_type /*this_id*/);
         void call_write_sync(std::uint32_t locality_id, std::uint64_t count,
             detail::buffer const& in, threads::thread_id_ref_type caller);
+        void call_write_unordered(
+            detail::buffer const& in, hpx::id_type /*this_id*/);
 
     public:
         explicit output_stream(
@@ -75,8 +77,13 @@ namespace hpx { namespace iostreams { namespace server {
         void write_sync(std::uint32_t locality_id, std::uint64_t count,
             detail::buffer const& in);
 
+        // Write the given output as soon as it arrives, without ordering it
+        // with respect to the other output received from the same locality.
+        void write_unordered(detail::buffer const& in);
+
         HPX_DEFINE_COMPONENT_ACTION(output_stream, write_async)
         HPX_DEFINE_COMPONENT_ACTION(output_stream, write_sync)
+        HPX_DEFINE_COMPONENT_ACTION(output_stream, write_unordered)
     };
 }}}    // namespace hpx::iostreams::server
 
@@ -88,4 +95,8 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::iostreams::server::output_stream::write_sync_action,
     output_stream_write_sync_action)
 
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::iostreams::server::output_stream::write_unordered_action,
+    output_stream_write_unordered_action)
+
 #include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,213 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/async_local/post.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/runtime_local/get_os_thread_count.hpp>
+#include <hpx/synchronization/mutex.hpp>
+#include <hpx/threading/thread.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <hpx/components/iostreams/buffered_output.hpp>
+#include <hpx/components/iostreams/server/buffer.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::iostreams::detail {
+
+    buffered_output_settings get_buffered_output_settings()
+    {
+        buffered_output_settings settings;
+
+        settings.buffered =
+            hpx::util::from_string<int>(
+                get_config_entry("hpx.iostreams.buffered", "0"), 0) != 0;
+        settings.buffer_size = hpx::util::from_string<std::size_t>(
+            get_config_entry("hpx.iostreams.buffer_size",
+                std::to_string(settings.buffer_size)),
+            settings.buffer_size);
+        settings.flush_interval =
+            std::chrono::milliseconds(hpx::util::from_string<std::int64_t>(
+                get_config_entry("hpx.iostreams.flush_interval",
+                    std::to_string(settings.flush_interval.count())),
+                settings.flush_interval.count()));
+        settings.ordered =
+            hpx::util::from_string<int>(
+                get_config_entry("hpx.iostreams.ordered", "1"), 1) != 0;
+        settings.local_file = get_config_entry("hpx.iostreams.local_file", "");
+
+        return settings;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        // header of a piece of output stored in a thread_buffer
+        struct output_header
+        {
+            std::uint64_t sequence_number;
+            std::size_t size;
+        };
+
+        struct output_record
+        {
+            std::uint64_t sequence_number;
+            char const* data;
+            std::size_t size;
+        };
+    }    // namespace
+
+    buffered_output::buffered_output(
+        buffered_output_settings const& settings, hpx::function<void()> flush)
+      // the last buffer is shared by all threads which are not HPX worker
+      // threads
+      : buffers_(hpx::get_os_thread_count() + 1)
+      , buffer_size_(settings.buffer_size)
+      , ordered_(settings.ordered)
+      , sequence_number_(0)
+      , stopped_(false)
+      , flush_state_(std::make_shared<flush_state>(
+            settings.flush_interval, HPX_MOVE(flush)))
+    {
+    }
+
+    buffered_output::~buffered_output()
+    {
+        stop();
+    }
+
+    bool buffered_output::append(buffer const& data)
+    {
+        std::size_t num_thread = hpx::get_worker_thread_num();
+        if (num_thread >= buffers_.size() - 1)
+        {
+            num_thread = buffers_.size() - 1;
+        }
+
+        auto& b = buffers_[num_thread].data_;
+
+        {
+            std::lock_guard<hpx::spinlock> l(b.mtx_);
+
+            // reserve space for the header, which is filled in once the size
+            // of the output is known
+            std::size_t const start = b.data_.size();
+            b.data_.resize(start + sizeof(output_header));
+            data.append_to(b.data_);
+
+            output_header const header{
+                sequence_number_.fetch_add(1, std::memory_order_relaxed),
+                b.data_.size() - start - sizeof(output_header)};
+            std::memcpy(b.data_.data() + start, &header, sizeof(header));
+
+            if (b.data_.size() >= buffer_size_)
+            {
+                return true;
+            }
+        }
+
+        schedule_flush();
+        return false;
+    }
+
+    void buffered_output::schedule_flush()
+    {
+        if (flush_state_->flush_interval_.count() <= 0 ||
+            stopped_.load(std::memory_order_relaxed) ||
+            flush_state_->flush_scheduled_.exchange(
+                true, std::memory_order_acq_rel))
+        {
+            return;
+        }
+
+        // the scheduled flush keeps its state alive, it does not access this
+        // object
+        hpx::post([state = flush_state_]() {
+            hpx::this_thread::sleep_for(state->flush_interval_);
+
+            // output appended from now on schedules the next flush
+            state->flush_scheduled_.store(false, std::memory_order_release);
+
+            std::lock_guard<hpx::mutex> l(state->mtx_);
+            if (!state->stopped_)
+            {
+                state->flush_();
+            }
+        });
+    }
+
+    buffer buffered_output::collect(buffer const& data)
+    {
+        std::vector<char> result;
+
+        // Acquire all locks before collecting the output. This ensures that
+        // no output is collected while output with a smaller sequence number
+        // is still being appended.
+        for (auto& b : buffers_)
+        {
+            b.data_.mtx_.lock();
+        }
+
+        // order the pieces of output by their sequence numbers
+        std::vector<output_record> records;
+        std::size_t size = 0;
+        for (auto& b : buffers_)
+        {
+            std::vector<char> const& d = b.data_.data_;
+            for (std::size_t pos = 0; pos != d.size(); /**/)
+            {
+                output_header header;
+                std::memcpy(&header, d.data() + pos, sizeof(header));
+                pos += sizeof(header);
+
+                records.push_back(output_record{
+                    header.sequence_number, d.data() + pos, header.size});
+                pos += header.size;
+                size += header.size;
+            }
+        }
+
+        std::sort(records.begin(), records.end(),
+            [](output_record const& lhs, output_record const& rhs) {
+                return lhs.sequence_number < rhs.sequence_number;
+            });
+
+        result.reserve(size);
+        for (output_record const& r : records)
+        {
+            result.insert(result.end(), r.data, r.data + r.size);
+        }
+
+        for (auto& b : buffers_)
+        {
+            b.data_.data_.clear();
+            b.data_.mtx_.unlock();
+        }
+
+        data.append_to(result);
+        return buffer(HPX_MOVE(result));
+    }
+
+    void buffered_output::stop()
+    {
+        stopped_.store(true, std::memory_order_relaxed);
+
+        // wait for a flush currently in progress
+        std::lock_guard<hpx::mutex> l(flush_state_->mtx_);
+        flush_state_->stopped_ = true;
+    }
+}    // namespace hpx::iostreams::detail
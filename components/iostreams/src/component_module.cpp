@@ -38,6 +38,9 @@ HPX_REGISTER_ACTION_ID(ostream_type::write_sync_action,
     output_stream_write_sync_action,
     hpx::actions::output_stream_write_sync_action_id)
 
+HPX_REGISTER_ACTION(
+    ostream_type::write_unordered_action, output_stream_write_unordered_action)
+
 ///////////////////////////////////////////////////////////////////////////////
 // Register a startup function which will be called as a HPX-thread during
 // runtime startup.
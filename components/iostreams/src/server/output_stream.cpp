@@ -98,4 +98,23 @@ namespace hpx::iostreams::server {
         this_thread::suspend(threads::thread_schedule_state::suspended,
             "output_stream::write_sync");
     }    // }}}
+
+    ///////////////////////////////////////////////////////////////////////////
+    void output_stream::call_write_unordered(
+        detail::buffer const& in, hpx::id_type /*this_id*/)
+    {
+        // Perform the IO operation.
+        detail::buffer next_in(in);
+        next_in.write(write_f, mtx_);
+    }
+
+    void output_stream::write_unordered(detail::buffer const& buf_in)
+    {
+        // Perform the IO in another OS thread.
+        detail::buffer in(buf_in);
+        hpx::id_type this_id = this->get_id();
+        hpx::get_thread_pool("io_pool")->get_io_service().post(
+            hpx::bind_front(&output_stream::call_write_unordered, this,
+                HPX_MOVE(in), HPX_MOVE(this_id)));
+    }
 }    // namespace hpx::iostreams::server
@@ -19,7 +19,9 @@
 #include <hpx/components/iostreams/ostream.hpp>
 #include <hpx/components/iostreams/standard_streams.hpp>
 
+#include <fstream>
 #include <functional>
+#include <ios>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -74,6 +76,36 @@ namespace hpx { namespace iostreams { namespace detail {
         return agas::on_symbol_namespace_event(cout_name, true);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<hpx::id_type> create_local_ostream(std::string const& filename)
+    {
+        LRT_(info).format(
+            "detail::create_local_ostream: writing output to '{}'", filename);
+
+        // the file is kept open until the end of the program as the stream
+        // object might be released late during shutdown only
+        static std::ofstream file;
+        if (!file.is_open())
+        {
+            file.open(filename, std::ios::out | std::ios::trunc);
+            if (!file.is_open())
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::iostreams::detail::create_local_ostream",
+                    "could not open output file '{}'", filename);
+            }
+        }
+
+        // the stream object is not registered with AGAS, the output is never
+        // sent to the console
+        typedef components::component<server::output_stream> ostream_type;
+
+        return hpx::make_ready_future(hpx::id_type(
+            components::server::construct<ostream_type>(
+                std::ref(static_cast<std::ostream&>(file))),
+            hpx::id_type::management_type::managed));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     void release_ostream(char const* name, hpx::id_type const& /* id */)
     {
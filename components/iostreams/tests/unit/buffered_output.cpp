@@ -0,0 +1,179 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the output of many tasks is neither lost nor garbled if the
+// standard streams buffer their output per worker thread, and that hpx::cout
+// can be redirected to a file on each locality.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+constexpr std::size_t num_tasks = 100;
+constexpr std::size_t num_lines = 100;
+
+std::string const output_file = "buffered_output_test.0.txt";
+
+std::string make_line(std::size_t task, std::size_t line)
+{
+    return std::to_string(task) + ":" + std::to_string(line);
+}
+
+void write_lines(std::size_t task)
+{
+    for (std::size_t line = 0; line != num_lines; ++line)
+    {
+        std::string const str = make_line(task, line);
+        hpx::consolestream << str << std::endl;
+        hpx::cout << str << std::endl;
+    }
+}
+
+std::vector<std::string> split_lines(std::string const& str)
+{
+    std::vector<std::string> lines;
+    std::istringstream strm(str);
+    std::string line;
+    while (std::getline(strm, line))
+    {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+void verify_lines(std::vector<std::string> const& lines)
+{
+    HPX_TEST_EQ(lines.size(), num_tasks * num_lines);
+
+    // all lines must be there and the lines written by the same task must be
+    // in order
+    std::vector<std::size_t> next_line(num_tasks, 0);
+    for (std::string const& line : lines)
+    {
+        std::size_t const colon = line.find(':');
+        HPX_TEST_NEQ(colon, std::string::npos);
+        if (colon == std::string::npos)
+        {
+            continue;
+        }
+
+        std::size_t const task = std::stoul(line.substr(0, colon));
+        HPX_TEST_LT(task, num_tasks);
+        if (task >= num_tasks)
+        {
+            continue;
+        }
+
+        HPX_TEST_EQ(line, make_line(task, next_line[task]++));
+    }
+}
+
+// The output of a task is collected in order even if the task moved between
+// worker threads.
+void test_order_across_workers()
+{
+    hpx::iostreams::detail::buffered_output_settings settings;
+    settings.flush_interval = std::chrono::milliseconds(0);
+    hpx::iostreams::detail::buffered_output out(settings, []() {});
+
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    std::string expected;
+    for (std::size_t i = 0; i != 20; ++i)
+    {
+        std::string const line = std::to_string(i) + "\n";
+        expected += line;
+
+        // visit the worker threads in reverse order
+        hpx::execution::parallel_executor exec(
+            hpx::threads::thread_priority::normal,
+            hpx::threads::thread_stacksize::default_,
+            hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>(num_threads - 1 - i % num_threads)));
+        hpx::async(exec, [&]() {
+            out.append(hpx::iostreams::detail::buffer(
+                std::vector<char>(line.begin(), line.end())));
+        }).get();
+    }
+
+    std::vector<char> collected;
+    out.collect().append_to(collected);
+    HPX_TEST_EQ(std::string(collected.begin(), collected.end()), expected);
+}
+
+// A scheduled flush does not access the buffered_output once it was stopped.
+void test_pending_flush()
+{
+    std::atomic<int> flushed(0);
+    {
+        hpx::iostreams::detail::buffered_output_settings settings;
+        settings.flush_interval = std::chrono::milliseconds(10);
+        hpx::iostreams::detail::buffered_output out(
+            settings, [&]() { ++flushed; });
+
+        std::string const line = "line\n";
+        out.append(hpx::iostreams::detail::buffer(
+            std::vector<char>(line.begin(), line.end())));
+    }
+
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(50));
+    HPX_TEST_EQ(flushed.load(), 0);
+}
+
+int hpx_main()
+{
+    test_order_across_workers();
+    test_pending_flush();
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t task = 0; task != num_tasks; ++task)
+    {
+        tasks.push_back(hpx::async(&write_lines, task));
+    }
+    hpx::wait_all(tasks);
+
+    // a flush sends all buffered output and waits for it to be written
+    hpx::consolestream << hpx::iostreams::flush_type();
+    hpx::cout << hpx::iostreams::flush_type();
+
+    verify_lines(split_lines(hpx::get_consolestream().str()));
+
+    std::ifstream file(output_file);
+    HPX_TEST(file.is_open());
+    verify_lines(split_lines(std::string(
+        std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>())));
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::init_params init_args;
+    init_args.cfg = {"hpx.iostreams.buffered!=1",
+        "hpx.iostreams.buffer_size!=256",
+        "hpx.iostreams.local_file!=buffered_output_test.$[hpx.locality].txt"};
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+
+    std::remove(output_file.c_str());
+    return hpx::util::report_errors();
+}
+#endif
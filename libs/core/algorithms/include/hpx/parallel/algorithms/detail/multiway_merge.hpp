@@ -0,0 +1,311 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/task_arena.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/algorithms/detail/upper_lower_bound.hpp>
+#include <hpx/parallel/util/transfer.hpp>
+#include <hpx/type_support/identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A loser tree (tournament tree) selecting the smallest of the current
+    // elements of k sorted sequences with log2(k) comparisons per output
+    // element. Equivalent elements are taken from the sequence with the lower
+    // index first, which makes the merge stable.
+    template <typename Iter, typename Comp>
+    class loser_tree
+    {
+    public:
+        loser_tree(std::vector<std::pair<Iter, Iter>> seqs, Comp& comp)
+          : seqs_(HPX_MOVE(seqs))
+          , comp_(comp)
+          , capacity_(1)
+        {
+            while (capacity_ < seqs_.size())
+            {
+                capacity_ <<= 1;
+            }
+
+            // inner nodes store the index of the sequence that lost the
+            // match at that node, tree_[0] stores the overall winner
+            tree_.resize(capacity_);
+
+            std::vector<std::size_t> winners(2 * capacity_);
+            for (std::size_t i = 0; i != capacity_; ++i)
+            {
+                winners[capacity_ + i] = i;
+            }
+
+            for (std::size_t node = capacity_ - 1; node != 0; --node)
+            {
+                std::size_t const lhs = winners[2 * node];
+                std::size_t const rhs = winners[2 * node + 1];
+                if (beats(rhs, lhs))
+                {
+                    winners[node] = rhs;
+                    tree_[node] = lhs;
+                }
+                else
+                {
+                    winners[node] = lhs;
+                    tree_[node] = rhs;
+                }
+            }
+            tree_[0] = winners[1];
+        }
+
+        // Copy the next count elements in sorted order to dest.
+        template <typename OutIter>
+        OutIter copy_n(std::size_t count, OutIter dest)
+        {
+            for (/**/; count != 0; --count)
+            {
+                std::size_t winner = tree_[0];
+                HPX_ASSERT(!exhausted(winner));
+
+                auto& seq = seqs_[winner];
+                *dest = *seq.first;
+                ++dest;
+                ++seq.first;
+
+                // replay the matches on the path from the winner's leaf to
+                // the root
+                for (std::size_t node = (capacity_ + winner) / 2; node != 0;
+                    node /= 2)
+                {
+                    if (beats(tree_[node], winner))
+                    {
+                        std::swap(tree_[node], winner);
+                    }
+                }
+                tree_[0] = winner;
+            }
+            return dest;
+        }
+
+    private:
+        bool exhausted(std::size_t i) const noexcept
+        {
+            return i >= seqs_.size() || seqs_[i].first == seqs_[i].second;
+        }
+
+        // returns whether the current element of sequence lhs has to be
+        // output before the current element of sequence rhs
+        bool beats(std::size_t lhs, std::size_t rhs)
+        {
+            if (exhausted(lhs))
+                return false;
+            if (exhausted(rhs))
+                return true;
+
+            if (HPX_INVOKE(comp_, *seqs_[rhs].first, *seqs_[lhs].first))
+                return false;
+            if (HPX_INVOKE(comp_, *seqs_[lhs].first, *seqs_[rhs].first))
+                return true;
+            return lhs < rhs;
+        }
+
+        std::vector<std::pair<Iter, Iter>> seqs_;
+        Comp& comp_;
+        std::size_t capacity_;
+        std::vector<std::size_t> tree_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sequentially merge count elements from the given sorted sequences into
+    // dest.
+    template <typename Iter, typename OutIter, typename Comp>
+    OutIter sequential_multiway_merge(
+        std::vector<std::pair<Iter, Iter>> seqs, OutIter dest, Comp& comp)
+    {
+        // remove empty sequences, this doesn't change the relative order of
+        // the remaining ones, i.e. the merge stays stable
+        seqs.erase(std::remove_if(seqs.begin(), seqs.end(),
+                       [](auto const& seq) { return seq.first == seq.second; }),
+            seqs.end());
+
+        if (seqs.empty())
+        {
+            return dest;
+        }
+
+        if (seqs.size() == 1)
+        {
+            return util::copy(seqs[0].first, seqs[0].second, dest).out;
+        }
+
+        std::size_t count = 0;
+        for (auto const& seq : seqs)
+        {
+            count += static_cast<std::size_t>(seq.second - seq.first);
+        }
+
+        return loser_tree<Iter, Comp>(HPX_MOVE(seqs), comp)
+            .copy_n(count, dest);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Multi-sequence selection (co-ranking): determine the positions that
+    // split each of the sorted sequences such that the prefixes together hold
+    // exactly the rank smallest elements of all sequences. Equivalent
+    // elements are ordered by the index of their sequence, consistently with
+    // the loser tree above.
+    //
+    // Every iteration picks the weighted median of the middle elements of
+    // the sequences' remaining search windows as the pivot, determines its
+    // rank, and shrinks all windows accordingly. This removes at least a
+    // quarter of the remaining candidates per iteration.
+    //
+    // The scratch space is taken from the arena of the calling HPX thread.
+    // It is released in reverse order of allocation, which allows the arena
+    // to reuse the memory for the next split.
+    template <typename Iter, typename Comp>
+    std::vector<std::size_t> multiway_split(
+        std::vector<std::pair<Iter, Iter>> const& seqs, std::size_t rank,
+        Comp& comp)
+    {
+        std::size_t const k = seqs.size();
+
+        hpx::memory::task_arena_allocator<std::size_t> const alloc(
+            hpx::memory::get_task_arena());
+        using scratch_type = std::vector<std::size_t,
+            hpx::memory::task_arena_allocator<std::size_t>>;
+
+        scratch_type lo(k, 0, alloc);
+        scratch_type hi(k, alloc);
+        std::size_t sum_lo = 0;
+        std::size_t sum_hi = 0;
+        for (std::size_t i = 0; i != k; ++i)
+        {
+            hi[i] = static_cast<std::size_t>(seqs[i].second - seqs[i].first);
+            sum_hi += hi[i];
+        }
+
+        HPX_ASSERT(rank <= sum_hi);
+
+        struct candidate
+        {
+            std::size_t seq;
+            std::size_t pos;
+            std::size_t weight;
+        };
+
+        std::vector<candidate, hpx::memory::task_arena_allocator<candidate>>
+            candidates(alloc);
+        candidates.reserve(k);
+
+        scratch_type pos(k, alloc);
+        while (sum_lo != rank && sum_hi != rank)
+        {
+            // collect the middle elements of all non-empty windows
+            candidates.clear();
+            std::size_t total_weight = 0;
+            for (std::size_t i = 0; i != k; ++i)
+            {
+                if (lo[i] != hi[i])
+                {
+                    candidates.push_back(
+                        {i, lo[i] + (hi[i] - lo[i]) / 2, hi[i] - lo[i]});
+                    total_weight += hi[i] - lo[i];
+                }
+            }
+            HPX_ASSERT(!candidates.empty());
+
+            auto candidate_less = [&](candidate const& lhs,
+                                      candidate const& rhs) {
+                auto const& l = seqs[lhs.seq].first[lhs.pos];
+                auto const& r = seqs[rhs.seq].first[rhs.pos];
+                if (HPX_INVOKE(comp, l, r))
+                    return true;
+                if (HPX_INVOKE(comp, r, l))
+                    return false;
+                return lhs.seq < rhs.seq;
+            };
+            std::sort(candidates.begin(), candidates.end(), candidate_less);
+
+            // the weighted median of the candidates becomes the pivot
+            candidate pivot = candidates.back();
+            std::size_t weight = 0;
+            for (candidate const& c : candidates)
+            {
+                weight += c.weight;
+                if (2 * weight >= total_weight)
+                {
+                    pivot = c;
+                    break;
+                }
+            }
+
+            // determine the number of elements ordered before the pivot
+            auto const& value = seqs[pivot.seq].first[pivot.pos];
+            std::size_t pivot_rank = 0;
+            for (std::size_t i = 0; i != k; ++i)
+            {
+                Iter const first = seqs[i].first;
+                if (i == pivot.seq)
+                {
+                    pos[i] = pivot.pos;
+                }
+                else if (i < pivot.seq)
+                {
+                    pos[i] = static_cast<std::size_t>(
+                        detail::upper_bound(first + lo[i], first + hi[i],
+                            value, comp, hpx::identity_v) -
+                        first);
+                }
+                else
+                {
+                    pos[i] = static_cast<std::size_t>(
+                        detail::lower_bound(first + lo[i], first + hi[i],
+                            value, comp, hpx::identity_v) -
+                        first);
+                }
+                pivot_rank += pos[i];
+            }
+
+            if (pivot_rank < rank)
+            {
+                // the pivot and everything before it belongs to the prefix
+                pos[pivot.seq] = pivot.pos + 1;
+                sum_lo = 0;
+                for (std::size_t i = 0; i != k; ++i)
+                {
+                    lo[i] = pos[i];
+                    sum_lo += lo[i];
+                }
+            }
+            else
+            {
+                // the pivot and everything after it belongs to the suffix
+                sum_hi = 0;
+                for (std::size_t i = 0; i != k; ++i)
+                {
+                    hi[i] = pos[i];
+                    sum_hi += hi[i];
+                }
+            }
+        }
+
+        scratch_type const& result = sum_lo == rank ? lo : hi;
+        return std::vector<std::size_t>(result.begin(), result.end());
+    }
+
+    /// \endcond
+}    // namespace hpx::parallel::detail
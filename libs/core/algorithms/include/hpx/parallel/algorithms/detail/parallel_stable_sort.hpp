@@ -8,14 +8,15 @@
 #pragma once
 
 #include <hpx/assert.hpp>
+#include <hpx/execution/executors/temporary_allocator.hpp>
 #include <hpx/executors/exception_list.hpp>
 #include <hpx/parallel/algorithms/detail/sample_sort.hpp>
 
 #include <cstddef>
 #include <cstdint>
-#include <cstdlib>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -26,17 +27,23 @@ namespace hpx::parallel::detail {
     /// \struct parallel_stable_sort
     ///
     /// This a structure for to implement a parallel stable sort exception safe
-    template <typename Iter, typename Sent, typename Compare>
+    template <typename Iter, typename Sent, typename Compare,
+        typename Allocator =
+            std::allocator<typename std::iterator_traits<Iter>::value_type>>
     struct parallel_stable_sort_helper
     {
         using value_type = typename std::iterator_traits<Iter>::value_type;
+        using allocator_traits = std::allocator_traits<Allocator>;
 
         util::range<Iter, Sent> range_initial;
         Compare comp;
+        Allocator alloc;
         std::size_t nelem;
+        std::size_t nptr;
         value_type* ptr;
 
-        parallel_stable_sort_helper(Iter first, Sent last, Compare cmp);
+        parallel_stable_sort_helper(Iter first, Sent last, Compare cmp,
+            Allocator alloc = Allocator());
 
         // / brief Perform sorting operation
         template <typename Exec>
@@ -49,7 +56,7 @@ namespace hpx::parallel::detail {
         {
             if (ptr != nullptr)
             {
-                std::free(ptr);
+                allocator_traits::deallocate(alloc, ptr, nptr);
             }
         }
     };    // end struct parallel_stable_sort
@@ -59,26 +66,31 @@ namespace hpx::parallel::detail {
     /// \param [in] first : range of elements to sort
     /// \param [in] last : range of elements to sort
     /// \param [in] comp : object for to compare two elements
-    template <typename Iter, typename Sent, typename Compare>
-    parallel_stable_sort_helper<Iter, Sent,
-        Compare>::parallel_stable_sort_helper(Iter first, Sent last,
-        Compare comp)
+    /// \param [in] alloc : allocator used for the temporary buffer
+    template <typename Iter, typename Sent, typename Compare,
+        typename Allocator>
+    parallel_stable_sort_helper<Iter, Sent, Compare,
+        Allocator>::parallel_stable_sort_helper(Iter first, Sent last,
+        Compare comp, Allocator alloc)
       : range_initial(first, last)
       , comp(comp)
+      , alloc(HPX_MOVE(alloc))
       , nelem(range_initial.size())
+      , nptr((nelem + 1) >> 1)
       , ptr(nullptr)
     {
         HPX_ASSERT(range_initial.size() >= 0);
     }
 
-    template <typename Iter, typename Sent, typename Compare>
+    template <typename Iter, typename Sent, typename Compare,
+        typename Allocator>
     template <typename Exec>
-    Iter parallel_stable_sort_helper<Iter, Sent, Compare>::operator()(
-        Exec&& exec, std::uint32_t nthreads, std::size_t chunk_size)
+    Iter parallel_stable_sort_helper<Iter, Sent, Compare,
+        Allocator>::operator()(Exec&& exec, std::uint32_t nthreads,
+        std::size_t chunk_size)
     {
         try
         {
-            std::size_t nptr = (nelem + 1) >> 1;
             Iter last = range_initial.begin() + nelem;
 
             if (nelem < chunk_size || nthreads < 2)
@@ -94,13 +106,8 @@ namespace hpx::parallel::detail {
             }
 
             // leave memory uninitialized, sample_sort will manage construction
-            // etc.
-            ptr = static_cast<value_type*>(
-                std::malloc(sizeof(value_type) * nptr));
-            if (ptr == nullptr)
-            {
-                throw std::bad_alloc();
-            }
+            // etc. The memory is first touched by the tasks that use it.
+            ptr = allocator_traits::allocate(alloc, nptr);
 
             // Parallel Process
             util::range<Iter, Sent> range_first(
@@ -140,11 +147,17 @@ namespace hpx::parallel::detail {
     Iter parallel_stable_sort(Exec&& exec, Iter first, Sent last,
         std::size_t cores, std::size_t chunk_size, Compare&& comp)
     {
-        using parallel_stable_sort_helper_t =
-            parallel_stable_sort_helper<Iter, Sent, std::decay_t<Compare>>;
-
-        parallel_stable_sort_helper_t sorter(
-            first, last, HPX_FORWARD(Compare, comp));
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using allocator_type =
+            hpx::execution::experimental::temporary_allocator_t<Exec,
+                value_type>;
+        using parallel_stable_sort_helper_t = parallel_stable_sort_helper<Iter,
+            Sent, std::decay_t<Compare>, allocator_type>;
+
+        parallel_stable_sort_helper_t sorter(first, last,
+            HPX_FORWARD(Compare, comp),
+            allocator_type(
+                hpx::execution::experimental::get_temporary_allocator(exec)));
 
         return sorter(HPX_FORWARD(Exec, exec), cores, chunk_size);
     }
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <hpx/assert.hpp>
+#include <hpx/execution/executors/temporary_allocator.hpp>
 #include <hpx/iterator_support/counting_iterator.hpp>
 #include <hpx/iterator_support/iterator_range.hpp>
 #include <hpx/modules/async_combinators.hpp>
@@ -21,9 +22,9 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
-#include <cstdlib>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -38,18 +39,22 @@ namespace hpx::parallel::detail {
     ///        safe
     /// \tparam
     /// \remarks
-    template <typename Iter, typename Sent, typename Compare>
+    template <typename Iter, typename Sent, typename Compare,
+        typename Allocator =
+            std::allocator<typename std::iterator_traits<Iter>::value_type>>
     struct sample_sort_helper
     {
         using value_type = typename std::iterator_traits<Iter>::value_type;
         using range_it = util::range<Iter, Sent>;
         using range_buf = util::range<value_type*>;
+        using allocator_traits = std::allocator_traits<Allocator>;
 
         std::uint32_t nthreads;
         std::uint32_t nintervals;
         bool construct = false;
         bool owner = false;
         Compare comp;
+        Allocator alloc;
         range_it global_range;
         range_buf global_buf;
 
@@ -71,7 +76,10 @@ namespace hpx::parallel::detail {
         /// \param [in] cmp : object for to Compare two elements
         /// \param [in] nthreads : define the number of threads to use
         ///              in the process. By default is the number of thread HW
-        sample_sort_helper(Compare cmp, std::uint32_t nthreads);
+        /// \param [in] alloc : allocator used for the temporary buffer if
+        ///              none is passed to the sorting operation
+        sample_sort_helper(Compare cmp, std::uint32_t nthreads,
+            Allocator alloc = Allocator());
 
         /// \brief destructor of the typename. The utility is to destroy the
         ///        temporary buffer used in the sorting process
@@ -139,22 +147,27 @@ namespace hpx::parallel::detail {
     /// \param [in] cmp : object for to Compare two elements
     /// \param [in] nthreads : nthreads object for to define the number of threads
     ///            to use in the process. By default is the number of thread HW
-    template <typename Iter, typename Sent, typename Compare>
-    sample_sort_helper<Iter, Sent, Compare>::sample_sort_helper(
-        Compare cmp, std::uint32_t nthreads)
+    /// \param [in] alloc : allocator used for the temporary buffer
+    template <typename Iter, typename Sent, typename Compare,
+        typename Allocator>
+    sample_sort_helper<Iter, Sent, Compare, Allocator>::sample_sort_helper(
+        Compare cmp, std::uint32_t nthreads, Allocator alloc)
       : nthreads(nthreads)
       , nintervals(0)
       , construct(false)
       , owner(false)
       , comp(cmp)
+      , alloc(HPX_MOVE(alloc))
       , global_buf(nullptr, nullptr)
       , njob(0)
     {
     }
 
-    template <typename Iter, typename Sent, typename Compare>
+    template <typename Iter, typename Sent, typename Compare,
+        typename Allocator>
     template <typename Exec>
-    void sample_sort_helper<Iter, Sent, Compare>::operator()(Exec&& exec,
+    void sample_sort_helper<Iter, Sent, Compare, Allocator>::operator()(
+        Exec&& exec,
         Iter first, Sent last, value_type* paux, std::size_t naux,
         std::size_t chunk_size)
     {
@@ -190,13 +203,9 @@ namespace hpx::parallel::detail {
         }
         else
         {
-            // acquire uninitialized memory
-            value_type* ptr = static_cast<value_type*>(
-                std::malloc(sizeof(value_type) * nelem));
-            if (ptr == nullptr)
-            {
-                throw std::bad_alloc();
-            }
+            // acquire uninitialized memory, the memory is first touched by
+            // the tasks that use it
+            value_type* ptr = allocator_traits::allocate(alloc, nelem);
             global_buf = range_buf(ptr, ptr + nelem);
             owner = true;
         }
@@ -209,8 +218,10 @@ namespace hpx::parallel::detail {
 
     /// \brief destructor of the typename. The utility is to destroy the temporary
     ///        buffer used in the sorting process
-    template <typename Iter, typename Sent, typename Compare>
-    sample_sort_helper<Iter, Sent, Compare>::~sample_sort_helper(void)
+    template <typename Iter, typename Sent, typename Compare,
+        typename Allocator>
+    sample_sort_helper<Iter, Sent, Compare, Allocator>::~sample_sort_helper(
+        void)
     {
         if (construct)
         {
@@ -220,7 +231,8 @@ namespace hpx::parallel::detail {
 
         if (owner)
         {
-            std::free(global_buf.begin());
+            allocator_traits::deallocate(
+                alloc, global_buf.begin(), global_buf.size());
         }
     }
 
@@ -250,10 +262,11 @@ namespace hpx::parallel::detail {
     /// \exception
     /// \return
     /// \remarks
-    template <typename Iter, typename Sent, typename Compare>
+    template <typename Iter, typename Sent, typename Compare,
+        typename Allocator>
     template <typename Exec>
-    void sample_sort_helper<Iter, Sent, Compare>::initial_configuration(
-        Exec& exec)
+    void sample_sort_helper<Iter, Sent, Compare,
+        Allocator>::initial_configuration(Exec& exec)
     {
         std::vector<range_it> vmem_thread;
         std::vector<range_buf> vbuf_thread;
@@ -374,10 +387,16 @@ namespace hpx::parallel::detail {
         std::uint32_t num_threads, Value* paux, std::size_t naux,
         std::size_t chunk_size)
     {
-        using sample_sort_helper_t =
-            sample_sort_helper<Iter, Sent, std::decay_t<Compare>>;
-
-        sample_sort_helper_t sorter(HPX_FORWARD(Compare, comp), num_threads);
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using allocator_type =
+            hpx::execution::experimental::temporary_allocator_t<Exec,
+                value_type>;
+        using sample_sort_helper_t = sample_sort_helper<Iter, Sent,
+            std::decay_t<Compare>, allocator_type>;
+
+        sample_sort_helper_t sorter(HPX_FORWARD(Compare, comp), num_threads,
+            allocator_type(
+                hpx::execution::experimental::get_temporary_allocator(exec)));
         sorter(HPX_FORWARD(Exec, exec), first, last, paux, naux, chunk_size);
     }
 
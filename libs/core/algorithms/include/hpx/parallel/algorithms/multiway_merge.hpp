@@ -0,0 +1,361 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/multiway_merge.hpp
+/// \page hpx::experimental::multiway_merge
+/// \headerfile hpx/algorithm.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx::experimental {
+    // clang-format off
+
+    /// Merges any number of sorted ranges into one sorted range beginning at
+    /// \a dest. The order of equivalent elements in each of the original
+    /// ranges is preserved. For equivalent elements in different ranges, the
+    /// elements from the range appearing earlier in \a ranges precede the
+    /// elements from ranges appearing later. The destination range cannot
+    /// overlap with any of the input ranges. Executed according to the
+    /// policy.
+    ///
+    /// The output range is split into pieces of equal size by determining
+    /// the corresponding positions in all input ranges (multi-sequence
+    /// selection). Every piece is then merged independently using a loser
+    /// tree, i.e. all elements are moved through the memory hierarchy only
+    /// once regardless of the number of input ranges.
+    ///
+    /// \note   Complexity: Performs O(N log(k)) applications of the
+    ///         comparison \a comp, where N is the overall number of elements
+    ///         and k is the number of input ranges.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam Ranges      The type of the range of input ranges (deduced).
+    ///                     The input ranges must expose iterators meeting the
+    ///                     requirements of a random access iterator.
+    /// \tparam RandIter    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a multiway_merge requires \a Comp to
+    ///                     meet the requirements of \a CopyConstructible. This
+    ///                     defaults to std::less<>
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param ranges       Refers to the sorted input ranges the algorithm
+    ///                     will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise. The signature of this
+    ///                     comparison should be equivalent to:
+    ///                     \code
+    ///                     bool comp(const Type1 &a, const Type2 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it. The types \a Type1 and \a Type2 must be such
+    ///                     that objects of the value types of the input ranges
+    ///                     can be converted to both \a Type1 and \a Type2
+    ///
+    /// The assignments in the parallel \a multiway_merge algorithm invoked
+    /// with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a multiway_merge algorithm invoked
+    /// with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a multiway_merge algorithm returns a
+    ///           \a hpx::future<RandIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandIter otherwise.
+    ///           The \a multiway_merge algorithm returns the destination
+    ///           iterator to the end of the destination range.
+    ///
+    template <typename ExPolicy, typename Ranges, typename RandIter,
+        typename Comp = hpx::parallel::detail::less>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, RandIter>
+    multiway_merge(ExPolicy&& policy, Ranges&& ranges, RandIter dest,
+        Comp&& comp = Comp());
+
+    /// Merges any number of sorted ranges into one sorted range beginning at
+    /// \a dest. The order of equivalent elements in each of the original
+    /// ranges is preserved. For equivalent elements in different ranges, the
+    /// elements from the range appearing earlier in \a ranges precede the
+    /// elements from ranges appearing later. The destination range cannot
+    /// overlap with any of the input ranges.
+    ///
+    /// \note   Complexity: Performs O(N log(k)) applications of the
+    ///         comparison \a comp, where N is the overall number of elements
+    ///         and k is the number of input ranges.
+    ///
+    /// \tparam Ranges      The type of the range of input ranges (deduced).
+    ///                     The input ranges must expose iterators meeting the
+    ///                     requirements of a random access iterator.
+    /// \tparam OutIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). This defaults to std::less<>
+    ///
+    /// \param ranges       Refers to the sorted input ranges the algorithm
+    ///                     will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise. The signature of this
+    ///                     comparison should be equivalent to:
+    ///                     \code
+    ///                     bool comp(const Type1 &a, const Type2 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it. The types \a Type1 and \a Type2 must be such
+    ///                     that objects of the value types of the input ranges
+    ///                     can be converted to both \a Type1 and \a Type2
+    ///
+    /// \returns  The \a multiway_merge algorithm returns an \a OutIter.
+    ///           The \a multiway_merge algorithm returns the destination
+    ///           iterator to the end of the destination range.
+    ///
+    template <typename Ranges, typename OutIter,
+        typename Comp = hpx::parallel::detail::less>
+    OutIter multiway_merge(Ranges&& ranges, OutIter dest, Comp&& comp = Comp());
+
+    // clang-format on
+}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/iterator_support/traits/is_range.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/multiway_merge.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // multiway_merge
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        inline constexpr std::size_t multiway_merge_limit_per_task = 1 << 16;
+
+        template <typename Ranges>
+        using multiway_merge_iterator_t =
+            hpx::traits::range_iterator_t<std::remove_reference_t<
+                typename hpx::traits::range_traits<Ranges>::reference>>;
+
+        template <typename Ranges>
+        std::vector<std::pair<multiway_merge_iterator_t<Ranges>,
+            multiway_merge_iterator_t<Ranges>>>
+        get_multiway_merge_sequences(Ranges& ranges)
+        {
+            std::vector<std::pair<multiway_merge_iterator_t<Ranges>,
+                multiway_merge_iterator_t<Ranges>>>
+                seqs;
+
+            for (auto&& range : ranges)
+            {
+                seqs.emplace_back(
+                    hpx::util::begin(range), hpx::util::end(range));
+            }
+            return seqs;
+        }
+
+        template <typename OutIter>
+        struct multiway_merge
+          : public algorithm<multiway_merge<OutIter>, OutIter>
+        {
+            constexpr multiway_merge() noexcept
+              : algorithm<multiway_merge, OutIter>("multiway_merge")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter, typename OutIter_,
+                typename Comp>
+            static OutIter_ sequential(ExPolicy,
+                std::vector<std::pair<Iter, Iter>>&& seqs, OutIter_ dest,
+                Comp&& comp)
+            {
+                return sequential_multiway_merge(HPX_MOVE(seqs), dest, comp);
+            }
+
+            template <typename ExPolicy, typename Iter, typename OutIter_,
+                typename Comp>
+            static util::detail::algorithm_result_t<ExPolicy, OutIter_>
+            parallel(ExPolicy&& policy,
+                std::vector<std::pair<Iter, Iter>>&& seqs, OutIter_ dest,
+                Comp&& comp)
+            {
+                using algorithm_result =
+                    util::detail::algorithm_result<ExPolicy, OutIter_>;
+                constexpr bool has_scheduler_executor =
+                    hpx::execution_policy_has_scheduler_executor_v<ExPolicy>;
+
+                std::size_t count = 0;
+                for (auto const& seq : seqs)
+                {
+                    count += static_cast<std::size_t>(seq.second - seq.first);
+                }
+
+                if constexpr (!has_scheduler_executor)
+                {
+                    if (count == 0)
+                        return algorithm_result::get(HPX_MOVE(dest));
+                }
+
+                // every part produces a contiguous piece of the output of
+                // (almost) equal size
+                std::size_t const cores =
+                    hpx::execution::experimental::processing_units_count(
+                        policy.parameters(), policy.executor(),
+                        hpx::chrono::null_duration, count);
+
+                std::size_t const parts = (std::max)(static_cast<std::size_t>(1),
+                    (std::min)(cores, count / multiway_merge_limit_per_task));
+
+                auto f1 = [seqs = HPX_MOVE(seqs), dest, count, parts,
+                              comp = HPX_FORWARD(Comp, comp)](
+                              hpx::util::counting_iterator<std::size_t>
+                                  part_begin,
+                              std::size_t part_size) -> void {
+                    std::decay_t<Comp> part_comp = comp;
+
+                    std::size_t part = *part_begin;
+                    std::vector<std::size_t> lower =
+                        multiway_split(seqs, part * count / parts, part_comp);
+
+                    for (/**/; part_size != 0; --part_size, ++part)
+                    {
+                        std::size_t const rank = (part + 1) * count / parts;
+                        std::vector<std::size_t> upper =
+                            multiway_split(seqs, rank, part_comp);
+
+                        std::vector<std::pair<Iter, Iter>> slices;
+                        slices.reserve(seqs.size());
+                        for (std::size_t i = 0; i != seqs.size(); ++i)
+                        {
+                            slices.emplace_back(seqs[i].first + lower[i],
+                                seqs[i].first + upper[i]);
+                        }
+
+                        sequential_multiway_merge(HPX_MOVE(slices),
+                            dest + part * count / parts, part_comp);
+
+                        lower = HPX_MOVE(upper);
+                    }
+                };
+
+                auto f2 = [dest, count](auto&&...) mutable -> OutIter_ {
+                    return std::next(dest, count);
+                };
+
+                return util::partitioner<ExPolicy, OutIter_, void>::call(
+                    HPX_FORWARD(ExPolicy, policy),
+                    hpx::util::counting_iterator<std::size_t>(0), parts,
+                    HPX_MOVE(f1), HPX_MOVE(f2));
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::multiway_merge
+    inline constexpr struct multiway_merge_t final
+      : hpx::detail::tag_parallel_algorithm<multiway_merge_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename Ranges, typename RandIter,
+            typename Comp = hpx::parallel::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_range_v<std::decay_t<Ranges>> &&
+                hpx::traits::is_iterator_v<RandIter>
+            )>
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+            RandIter>
+        tag_fallback_invoke(multiway_merge_t, ExPolicy&& policy,
+            Ranges&& ranges, RandIter dest, Comp comp = Comp())
+        {
+            using iterator_type = hpx::parallel::detail::
+                multiway_merge_iterator_t<std::remove_reference_t<Ranges>>;
+
+            static_assert(
+                hpx::traits::is_random_access_iterator_v<iterator_type>,
+                "Requires at least random access iterator.");
+            static_assert(hpx::traits::is_random_access_iterator_v<RandIter>,
+                "Requires at least random access iterator.");
+
+            return hpx::parallel::detail::multiway_merge<RandIter>().call(
+                HPX_FORWARD(ExPolicy, policy),
+                hpx::parallel::detail::get_multiway_merge_sequences(ranges),
+                dest, HPX_MOVE(comp));
+        }
+
+        // clang-format off
+        template <typename Ranges, typename OutIter,
+            typename Comp = hpx::parallel::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_range_v<std::decay_t<Ranges>> &&
+                hpx::traits::is_iterator_v<OutIter>
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(
+            multiway_merge_t, Ranges&& ranges, OutIter dest, Comp comp = Comp())
+        {
+            using iterator_type = hpx::parallel::detail::
+                multiway_merge_iterator_t<std::remove_reference_t<Ranges>>;
+
+            static_assert(
+                hpx::traits::is_random_access_iterator_v<iterator_type>,
+                "Requires at least random access iterator.");
+            static_assert(hpx::traits::is_output_iterator_v<OutIter> ||
+                    hpx::traits::is_forward_iterator_v<OutIter>,
+                "Requires at least output iterator.");
+
+            return hpx::parallel::detail::multiway_merge<OutIter>().call(
+                hpx::execution::seq,
+                hpx::parallel::detail::get_multiway_merge_sequences(ranges),
+                dest, HPX_MOVE(comp));
+        }
+    } multiway_merge{};
+}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
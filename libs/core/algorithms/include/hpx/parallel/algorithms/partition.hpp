@@ -459,6 +459,7 @@ namespace hpx {
 #include <hpx/concepts/concepts.hpp>
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution/executors/temporary_allocator.hpp>
 #include <hpx/executors/exception_list.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/functional/invoke.hpp>
@@ -478,21 +479,23 @@ namespace hpx {
 #include <hpx/parallel/util/transfer.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 #include <hpx/synchronization/spinlock.hpp>
+#include <hpx/type_support/construct_at.hpp>
 #include <hpx/type_support/identity.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
 #include <boost/shared_array.hpp>
-#else
-#include <memory>
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <iterator>
 #include <list>
+#include <memory>
+#include <mutex>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -529,74 +532,66 @@ namespace hpx::parallel {
     namespace detail {
 
         /// \cond NOINTERNAL
-        struct stable_partition_helper
+
+        // Temporary storage used by the parallel stable_partition. The
+        // elements satisfying the predicate are placed in order starting at
+        // the front of the buffer, all other elements are placed in reverse
+        // order starting at its back. This allows to place every element
+        // before the overall number of elements satisfying the predicate is
+        // known.
+        template <typename T, typename Allocator>
+        struct stable_partition_buffer
         {
-            template <typename ExPolicy, typename RandIter, typename F,
-                typename Proj>
-            hpx::future<RandIter> operator()(ExPolicy&& policy, RandIter first,
-                RandIter last, std::size_t size, F&& f, Proj&& proj,
-                std::size_t chunks)
-            {
-                if (chunks < 2)
-                {
-                    return execution::async_execute(policy.executor(),
-                        [first, last, f = HPX_FORWARD(F, f),
-                            proj = HPX_FORWARD(Proj, proj)]() -> RandIter {
-                            return std::stable_partition(first, last,
-                                util::invoke_projected<F, Proj>(f, proj));
-                        });
-                }
+            using allocator_traits = std::allocator_traits<Allocator>;
 
-                std::size_t mid_point = size / 2;
-                chunks /= 2;
+            stable_partition_buffer(Allocator alloc, std::size_t size)
+              : alloc(HPX_MOVE(alloc))
+              , size(size)
+              , data(allocator_traits::allocate(this->alloc, size))
+            {
+            }
 
-                RandIter mid = first;
-                std::advance(mid, mid_point);
+            stable_partition_buffer(stable_partition_buffer const&) = delete;
+            stable_partition_buffer(stable_partition_buffer&&) = delete;
+            stable_partition_buffer& operator=(
+                stable_partition_buffer const&) = delete;
+            stable_partition_buffer& operator=(
+                stable_partition_buffer&&) = delete;
 
-                hpx::future<RandIter> left =
-                    execution::async_execute(policy.executor(), *this, policy,
-                        first, mid, mid_point, f, proj, chunks);
-                hpx::future<RandIter> right =
-                    execution::async_execute(policy.executor(), *this, policy,
-                        mid, last, size - mid_point, f, proj, chunks);
+            ~stable_partition_buffer()
+            {
+                // destroy the elements which were not moved back to the input
+                // range because the algorithm failed
+                for (auto const& [begin, end] : constructed)
+                {
+                    std::destroy(data + begin, data + end);
+                }
+                allocator_traits::deallocate(alloc, data, size);
+            }
 
-                return hpx::dataflow(
-                    policy.executor(),
-                    [mid](hpx::future<RandIter>&& leftf,
-                        hpx::future<RandIter>&& rightf) -> RandIter {
-                        if (leftf.has_exception() || rightf.has_exception())
-                        {
-                            std::list<std::exception_ptr> errors;
-                            if (leftf.has_exception())
-                            {
-                                hpx::parallel::util::detail::
-                                    handle_local_exceptions<ExPolicy>::call(
-                                        leftf.get_exception_ptr(), errors);
-                            }
-                            if (rightf.has_exception())
-                            {
-                                hpx::parallel::util::detail::
-                                    handle_local_exceptions<ExPolicy>::call(
-                                        rightf.get_exception_ptr(), errors);
-                            }
+            // record the elements [begin, end) as being constructed
+            void add_constructed(std::size_t begin, std::size_t end)
+            {
+                if (begin != end)
+                {
+                    std::lock_guard<hpx::spinlock> l(mtx);
+                    constructed.emplace_back(begin, end);
+                }
+            }
 
-                            if (!errors.empty())
-                            {
-                                throw exception_list(HPX_MOVE(errors));
-                            }
-                        }
-                        RandIter first_it = leftf.get();
-                        RandIter last_it = rightf.get();
+            // the ownership of all elements is taken over by the caller
+            void release_constructed() noexcept
+            {
+                std::lock_guard<hpx::spinlock> l(mtx);
+                constructed.clear();
+            }
 
-                        std::rotate(first_it, mid, last_it);
+            Allocator alloc;
+            std::size_t size;
+            T* data;
 
-                        // for some library implementations std::rotate
-                        // does not return the new middle point
-                        std::advance(first_it, std::distance(mid, last_it));
-                        return first_it;
-                    },
-                    HPX_MOVE(left), HPX_MOVE(right));
-            }
+            hpx::spinlock mtx;
+            std::vector<std::pair<std::size_t, std::size_t>> constructed;
         };
 
         template <typename BidirIter, typename Sent, typename F, typename Proj>
@@ -644,6 +639,16 @@ namespace hpx::parallel {
                     first, last, HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
             }
 
+            // The parallel version first partitions all chunks of the input
+            // range independently (step 1). The exclusive prefix sums of the
+            // number of elements per chunk satisfying (and not satisfying)
+            // the predicate determine the final positions of all elements of
+            // a chunk (step 2). Every chunk moves its elements to those
+            // positions in a temporary buffer (step 3) from where they are
+            // moved back to the input range in parallel (step 4). Every
+            // element is moved exactly twice and the predicate is evaluated
+            // once per element (plus a logarithmic number of times per chunk
+            // to find the partition point of the chunk again).
             template <typename ExPolicy, typename RandIter, typename Sent,
                 typename F, typename Proj>
             static util::detail::algorithm_result_t<ExPolicy, RandIter>
@@ -654,59 +659,178 @@ namespace hpx::parallel {
                     util::detail::algorithm_result<ExPolicy, RandIter>;
                 using difference_type =
                     typename std::iterator_traits<RandIter>::difference_type;
+                using value_type =
+                    typename std::iterator_traits<RandIter>::value_type;
+                using executor_type =
+                    typename std::decay_t<ExPolicy>::executor_type;
+                using allocator_type = hpx::execution::experimental::
+                    temporary_allocator_t<executor_type, value_type>;
+                using buffer_type =
+                    stable_partition_buffer<value_type, allocator_type>;
+                using counts_type = std::pair<std::size_t, std::size_t>;
+                using scan_partitioner_type =
+                    util::scan_partitioner<ExPolicy, RandIter, counts_type>;
 
-                future<RandIter> result;
                 auto last_iter = first;
+                difference_type size =
+                    detail::advance_and_get_distance(last_iter, last);
+
+                if (size == 0)
+                    return algorithm_result::get(HPX_MOVE(last_iter));
 
+                std::size_t const cores =
+                    hpx::execution::experimental::processing_units_count(
+                        policy.parameters(), policy.executor(),
+                        hpx::chrono::null_duration, size);
+
+                std::shared_ptr<buffer_type> buffer;
                 try
                 {
-                    // advances last_iter to last and gets distance
-                    difference_type size =
-                        detail::advance_and_get_distance(last_iter, last);
-
-                    if (size == 0)
-                    {
-                        result = hpx::make_ready_future(HPX_MOVE(last_iter));
-                    }
-                    else
-                    {
-                        std::size_t const cores = hpx::execution::experimental::
-                            processing_units_count(policy.parameters(),
-                                policy.executor(), hpx::chrono::null_duration,
-                                size);
-
-                        std::size_t chunk_size =
-                            hpx::execution::experimental::get_chunk_size(
-                                policy.parameters(), policy.executor(),
-                                hpx::chrono::null_duration, cores, size);
-
-                        std::size_t max_chunks = hpx::execution::experimental::
-                            maximal_number_of_chunks(policy.parameters(),
-                                policy.executor(), cores, size);
-
-                        util::detail::adjust_chunk_size_and_max_chunks(
-                            cores, size, chunk_size, max_chunks);
-
-                        result = stable_partition_helper()(
-                            HPX_FORWARD(ExPolicy, policy), first, last_iter,
-                            size, HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj),
-                            max_chunks);
-                    }
+                    buffer = std::make_shared<buffer_type>(
+                        allocator_type(hpx::execution::experimental::
+                                get_temporary_allocator(policy.executor())),
+                        static_cast<std::size_t>(size));
                 }
                 catch (...)
-                {
-                    result = hpx::make_exceptional_future<RandIter>(
-                        std::current_exception());
-                }
-
-                if (result.has_exception())
                 {
                     return algorithm_result::get(
                         detail::handle_exception<ExPolicy, RandIter>::call(
-                            HPX_MOVE(result)));
+                            std::current_exception()));
                 }
 
-                return algorithm_result::get(HPX_MOVE(result));
+                auto f1 = [f, proj](RandIter part_begin,
+                              std::size_t part_size) mutable -> counts_type {
+                    RandIter const mid = stable_partition_seq(
+                        part_begin, std::next(part_begin, part_size), f, proj);
+
+                    auto const true_count = static_cast<std::size_t>(
+                        std::distance(part_begin, mid));
+                    return counts_type(true_count, part_size - true_count);
+                };
+
+                auto f2 = [](counts_type const& prev_sum,
+                              counts_type const& curr) -> counts_type {
+                    return counts_type(prev_sum.first + curr.first,
+                        prev_sum.second + curr.second);
+                };
+
+                auto f3 = [f, proj, buffer](RandIter part_begin,
+                              std::size_t part_size,
+                              counts_type const& offset) mutable -> void {
+                    RandIter const part_end = std::next(part_begin, part_size);
+                    RandIter const mid = std::partition_point(part_begin,
+                        part_end, [&](auto&& value) -> bool {
+                            return HPX_INVOKE(f, HPX_INVOKE(proj, value));
+                        });
+
+                    // If moving an element throws, the elements of this
+                    // chunk constructed so far are destroyed, the elements
+                    // constructed by other chunks are destroyed along with
+                    // the buffer.
+                    std::size_t const true_begin = offset.first;
+                    std::size_t dest = true_begin;
+                    try
+                    {
+                        for (RandIter it = part_begin; it != mid; ++it)
+                        {
+                            hpx::construct_at(
+                                buffer->data + dest, HPX_MOVE(*it));
+                            ++dest;
+                        }
+                    }
+                    catch (...)
+                    {
+                        std::destroy(
+                            buffer->data + true_begin, buffer->data + dest);
+                        throw;
+                    }
+
+                    std::size_t const false_end = buffer->size - offset.second;
+                    std::size_t false_begin = false_end;
+                    try
+                    {
+                        for (RandIter it = mid; it != part_end; ++it)
+                        {
+                            hpx::construct_at(
+                                buffer->data + false_begin - 1, HPX_MOVE(*it));
+                            --false_begin;
+                        }
+                    }
+                    catch (...)
+                    {
+                        std::destroy(buffer->data + true_begin,
+                            buffer->data + dest);
+                        std::destroy(buffer->data + false_begin,
+                            buffer->data + false_end);
+                        throw;
+                    }
+
+                    buffer->add_constructed(true_begin, dest);
+                    buffer->add_constructed(false_begin, false_end);
+                };
+
+                auto f4 = [exec = policy.executor(), cores, first, buffer](
+                              std::vector<counts_type>&& items,
+                              std::vector<hpx::future<void>>&&) mutable
+                    -> RandIter {
+                    std::size_t const true_count = items.back().first;
+                    std::size_t const size = buffer->size;
+                    std::size_t const parts = (std::min)(cores, size);
+
+                    // every part destroys all of its elements in the buffer,
+                    // even if moving one of them back fails
+                    buffer->release_constructed();
+
+                    auto move_back = [&](std::size_t part) {
+                        std::size_t const part_begin = part * size / parts;
+                        std::size_t const part_end = (part + 1) * size / parts;
+
+                        auto source = [&](std::size_t i) {
+                            return buffer->data +
+                                (i < true_count ? i :
+                                                  size - 1 - (i - true_count));
+                        };
+
+                        RandIter dest = std::next(first, part_begin);
+                        std::size_t i = part_begin;
+                        try
+                        {
+                            for (/**/; i != part_end; ++i)
+                            {
+                                value_type* src = source(i);
+                                *dest++ = HPX_MOVE(*src);
+                                std::destroy_at(src);
+                            }
+                        }
+                        catch (...)
+                        {
+                            for (/**/; i != part_end; ++i)
+                            {
+                                std::destroy_at(source(i));
+                            }
+                            throw;
+                        }
+                    };
+
+                    hpx::parallel::execution::bulk_sync_execute(
+                        HPX_MOVE(exec), move_back, parts);
+
+                    return std::next(first, true_count);
+                };
+
+                return scan_partitioner_type::call(
+                    HPX_FORWARD(ExPolicy, policy), first,
+                    static_cast<std::size_t>(size), counts_type(0, 0),
+                    // step 1 partitions every chunk locally
+                    HPX_MOVE(f1),
+                    // step 2 propagates the number of elements from left to
+                    // right
+                    HPX_MOVE(f2),
+                    // step 3 moves the elements of every chunk to their final
+                    // position in the temporary buffer
+                    HPX_MOVE(f3),
+                    // step 4 moves all elements back to the input range
+                    HPX_MOVE(f4));
             }
         };
         /// \endcond
@@ -825,6 +949,56 @@ namespace hpx::parallel {
                 }
             };
 
+            // The blocks are handed out from both ends of the range without
+            // any locking. The number of blocks that are still available is
+            // decremented by every request, and only if that succeeds the
+            // position of the block is determined by incrementing the number
+            // of blocks taken from the respective side. This guarantees that
+            // the blocks taken from the left and from the right never overlap.
+            class block_counter
+            {
+            public:
+                explicit block_counter(std::size_t num_blocks) noexcept
+                  : available_(static_cast<std::int64_t>(num_blocks))
+                {
+                }
+
+                // Returns the index (counted from the left end) of the next
+                // block taken from the left side, if any.
+                bool claim_left(std::size_t& index) noexcept
+                {
+                    if (available_.fetch_sub(1, std::memory_order_relaxed) <= 0)
+                        return false;
+
+                    index = left_.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+
+                // Returns the index (counted from the right end) of the next
+                // block taken from the right side, if any.
+                bool claim_right(std::size_t& index) noexcept
+                {
+                    if (available_.fetch_sub(1, std::memory_order_relaxed) <= 0)
+                        return false;
+
+                    index = right_.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+
+                // The number of blocks taken from the left side. This is
+                // meaningful only after all blocks were handed out and all
+                // partitioning threads have finished.
+                std::size_t left_count() const noexcept
+                {
+                    return left_.load(std::memory_order_relaxed);
+                }
+
+            private:
+                std::atomic<std::int64_t> available_;
+                std::atomic<std::size_t> left_{0};
+                std::atomic<std::size_t> right_{0};
+            };
+
             template <typename Iter, typename Enable = void>
             class block_manager;
 
@@ -838,9 +1012,10 @@ namespace hpx::parallel {
                 block_manager(
                     RandIter first, RandIter last, std::size_t block_size)
                   : first_(first)
-                  , left_(0)
-                  , right_(std::distance(first, last))
+                  , size_(std::distance(first, last))
                   , block_size_(block_size)
+                  , num_blocks_((size_ + block_size - 1) / block_size)
+                  , counter_(num_blocks_)
                 {
                 }
 
@@ -854,58 +1029,48 @@ namespace hpx::parallel {
                 // Get block from the end of left side of boundary.
                 block<RandIter> get_left_block()
                 {
-                    std::lock_guard<decltype(mutex_)> lk(mutex_);
-
-                    if (left_ >= right_)
+                    std::size_t index = 0;
+                    if (!counter_.claim_left(index))
                         return {first_, first_};
 
-                    std::size_t begin_index = left_;
-                    std::size_t end_index =
-                        (std::min)(left_ + block_size_, right_);
-
-                    left_ += end_index - begin_index;
-
-                    RandIter begin_iter = std::next(first_, begin_index);
-                    RandIter end_iter = std::next(first_, end_index);
-
-                    boundary_ = end_iter;
-
-                    return {begin_iter, end_iter, left_block_no_--};
+                    return make_block(
+                        index, -static_cast<std::int64_t>(index) - 1);
                 }
 
                 // Get block from the end of right side of boundary.
                 block<RandIter> get_right_block()
                 {
-                    std::lock_guard<decltype(mutex_)> lk(mutex_);
-
-                    if (left_ >= right_)
+                    std::size_t index = 0;
+                    if (!counter_.claim_right(index))
                         return {first_, first_};
 
-                    std::size_t begin_index =
-                        (std::max)(right_ - block_size_, left_);
-                    std::size_t end_index = right_;
-
-                    right_ -= end_index - begin_index;
-
-                    RandIter begin_iter = std::next(first_, begin_index);
-                    RandIter end_iter = std::next(first_, end_index);
-
-                    boundary_ = begin_iter;
-
-                    return {begin_iter, end_iter, right_block_no_++};
+                    return make_block(num_blocks_ - index - 1,
+                        static_cast<std::int64_t>(index) + 1);
                 }
 
-                RandIter boundary()
+                RandIter boundary() const
                 {
-                    return boundary_;
+                    return std::next(first_,
+                        (std::min)(counter_.left_count() * block_size_, size_));
                 }
 
             private:
-                RandIter first_, boundary_;
-                std::size_t left_, right_;
+                block<RandIter> make_block(
+                    std::size_t index, std::int64_t block_no) const
+                {
+                    std::size_t const begin_index = index * block_size_;
+                    std::size_t const end_index =
+                        (std::min)(begin_index + block_size_, size_);
+
+                    return {std::next(first_, begin_index),
+                        std::next(first_, end_index), block_no};
+                }
+
+                RandIter first_;
+                std::size_t size_;
                 std::size_t block_size_;
-                std::int64_t left_block_no_{-1}, right_block_no_{1};
-                hpx::spinlock mutex_;
+                std::size_t num_blocks_;
+                block_counter counter_;
             };
 
             // block manager for forward access iterator.
@@ -918,13 +1083,12 @@ namespace hpx::parallel {
                 // In constructor, prepare all blocks for fast acquirement of blocks.
                 block_manager(
                     FwdIter first, FwdIter last, std::size_t block_size)
-                  : boundary_(first)
+                  : first_(first)
+                  , last_(last)
                   , blocks_((std::distance(first, last) + block_size - 1) /
                         block_size)
+                  , counter_(blocks_.size())
                 {
-                    left_ = 0;
-                    right_ = blocks_.size();
-
                     if (blocks_.size() == 1)
                     {
                         blocks_.front() = {first, last};
@@ -955,43 +1119,41 @@ namespace hpx::parallel {
                 // Get block from the end of left side of boundary.
                 block<FwdIter> get_left_block()
                 {
-                    std::lock_guard<decltype(mutex_)> lk(mutex_);
-
-                    if (left_ >= right_)
-                        return {boundary_, boundary_};
-
-                    boundary_ = blocks_[left_].last;
-                    blocks_[left_].block_no = left_block_no_--;
+                    std::size_t index = 0;
+                    if (!counter_.claim_left(index))
+                        return {first_, first_};
 
-                    // NOLINTNEXTLINE(bugprone-macro-repeated-side-effects)
-                    return HPX_MOVE(blocks_[left_++]);
+                    // every block is handed out exactly once, no
+                    // synchronization is required for modifying it
+                    blocks_[index].block_no =
+                        -static_cast<std::int64_t>(index) - 1;
+                    return blocks_[index];
                 }
 
-                // // Get block from the end of right side of boundary.
+                // Get block from the end of right side of boundary.
                 block<FwdIter> get_right_block()
                 {
-                    std::lock_guard<decltype(mutex_)> lk(mutex_);
-
-                    if (left_ >= right_)
-                        return {boundary_, boundary_};
-
-                    boundary_ = blocks_[--right_].first;
-                    blocks_[right_].block_no = right_block_no_++;
+                    std::size_t index = 0;
+                    if (!counter_.claim_right(index))
+                        return {first_, first_};
 
-                    return HPX_MOVE(blocks_[right_]);
+                    blocks_[blocks_.size() - index - 1].block_no =
+                        static_cast<std::int64_t>(index) + 1;
+                    return blocks_[blocks_.size() - index - 1];
                 }
 
-                FwdIter boundary()
+                FwdIter boundary() const
                 {
-                    return boundary_;
+                    std::size_t const left_count = counter_.left_count();
+                    return left_count < blocks_.size() ?
+                        blocks_[left_count].first :
+                        last_;
                 }
 
             private:
-                FwdIter boundary_;
+                FwdIter first_, last_;
                 std::vector<block<FwdIter>> blocks_;
-                std::size_t left_, right_;
-                std::int64_t left_block_no_{-1}, right_block_no_{1};
-                hpx::spinlock mutex_;
+                block_counter counter_;
             };
 
             // std::swap_ranges doesn't support overlapped ranges in standard.
@@ -0,0 +1,258 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/allocator_support/task_arena.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/detail/multiway_merge.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// Each element remembers the run it came from and its position inside that
+// run, this allows to verify the stability of the merge.
+using element_type = std::pair<int, std::size_t>;
+
+struct compare_keys
+{
+    bool operator()(element_type const& lhs, element_type const& rhs) const
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+std::vector<std::vector<element_type>> make_runs(
+    std::size_t num_runs, std::size_t max_size, int max_key)
+{
+    std::uniform_int_distribution<std::size_t> size_dist(0, max_size);
+    std::uniform_int_distribution<int> key_dist(0, max_key);
+
+    std::vector<std::vector<element_type>> runs(num_runs);
+    std::size_t id = 0;
+    for (auto& run : runs)
+    {
+        std::size_t const size = size_dist(gen);
+        std::vector<int> keys(size);
+        for (auto& key : keys)
+        {
+            key = key_dist(gen);
+        }
+        std::sort(keys.begin(), keys.end());
+
+        run.reserve(size);
+        for (int key : keys)
+        {
+            run.emplace_back(key, id++);
+        }
+    }
+    return runs;
+}
+
+// The expected result is the stable sort of the concatenation of all runs.
+std::vector<element_type> expected_result(
+    std::vector<std::vector<element_type>> const& runs)
+{
+    std::vector<element_type> result;
+    for (auto const& run : runs)
+    {
+        result.insert(result.end(), run.begin(), run.end());
+    }
+    std::stable_sort(result.begin(), result.end(), compare_keys());
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_multiway_merge_seq(std::size_t num_runs, std::size_t max_size)
+{
+    auto const runs = make_runs(num_runs, max_size, 100);
+    auto const expected = expected_result(runs);
+
+    std::vector<element_type> dest(expected.size());
+    auto result =
+        hpx::experimental::multiway_merge(runs, dest.begin(), compare_keys());
+
+    HPX_TEST(result == dest.end());
+    HPX_TEST(dest == expected);
+}
+
+template <typename ExPolicy>
+void test_multiway_merge(
+    ExPolicy&& policy, std::size_t num_runs, std::size_t max_size)
+{
+    auto const runs = make_runs(num_runs, max_size, 1000);
+    auto const expected = expected_result(runs);
+
+    std::vector<element_type> dest(expected.size());
+    auto result = hpx::experimental::multiway_merge(
+        policy, runs, dest.begin(), compare_keys());
+
+    HPX_TEST(result == dest.end());
+    HPX_TEST(dest == expected);
+}
+
+template <typename ExPolicy>
+void test_multiway_merge_async(
+    ExPolicy&& policy, std::size_t num_runs, std::size_t max_size)
+{
+    auto const runs = make_runs(num_runs, max_size, 1000);
+    auto const expected = expected_result(runs);
+
+    std::vector<element_type> dest(expected.size());
+    auto f = hpx::experimental::multiway_merge(
+        policy, runs, dest.begin(), compare_keys());
+
+    HPX_TEST(f.get() == dest.end());
+    HPX_TEST(dest == expected);
+}
+
+// the default comparison merges plain values
+template <typename ExPolicy>
+void test_multiway_merge_default(ExPolicy&& policy)
+{
+    std::vector<std::vector<int>> runs(17);
+    std::vector<int> expected;
+    for (std::size_t i = 0; i != runs.size(); ++i)
+    {
+        for (int j = 0; j != 20000; ++j)
+        {
+            runs[i].push_back(static_cast<int>(j * runs.size() + i));
+            expected.push_back(static_cast<int>(j * runs.size() + i));
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<int> dest(expected.size());
+    hpx::experimental::multiway_merge(policy, runs, dest.begin());
+
+    HPX_TEST(dest == expected);
+}
+
+void multiway_merge_test()
+{
+    using namespace hpx::execution;
+
+    std::size_t const num_runs[] = {0, 1, 2, 3, 7, 16, 61};
+    for (std::size_t n : num_runs)
+    {
+        test_multiway_merge_seq(n, 1000);
+
+        test_multiway_merge(seq, n, 1000);
+        test_multiway_merge(par, n, 1000);
+        test_multiway_merge(par_unseq, n, 1000);
+
+        // large enough to be split into several parts
+        test_multiway_merge(par, n, 100000);
+
+        test_multiway_merge_async(seq(task), n, 1000);
+        test_multiway_merge_async(par(task), n, 100000);
+    }
+
+    test_multiway_merge_default(seq);
+    test_multiway_merge_default(par);
+}
+
+// all elements being equivalent stresses the tie-breaking of the splitting
+void multiway_merge_equal_keys_test()
+{
+    auto const runs = make_runs(13, 50000, 0);
+    auto const expected = expected_result(runs);
+
+    std::vector<element_type> dest(expected.size());
+    hpx::experimental::multiway_merge(
+        hpx::execution::par, runs, dest.begin(), compare_keys());
+
+    HPX_TEST(dest == expected);
+}
+
+// the scratch space used for splitting the runs is taken from the arena of
+// the calling HPX thread and is reused by subsequent splits
+void multiway_split_arena_test()
+{
+    auto const runs = make_runs(61, 1000, 1000);
+
+    std::vector<std::pair<std::vector<element_type>::const_iterator,
+        std::vector<element_type>::const_iterator>>
+        seqs;
+    std::size_t total = 0;
+    for (auto const& run : runs)
+    {
+        seqs.emplace_back(run.begin(), run.end());
+        total += run.size();
+    }
+
+    hpx::async([&]() {
+        hpx::memory::task_arena* arena = hpx::memory::get_task_arena();
+        HPX_TEST(arena != nullptr);
+        HPX_TEST_EQ(arena->num_slabs(), std::size_t(0));
+
+        compare_keys comp;
+        for (std::size_t i = 0; i != 100; ++i)
+        {
+            std::size_t const rank = total * i / 100;
+            std::vector<std::size_t> const split =
+                hpx::parallel::detail::multiway_split(seqs, rank, comp);
+            HPX_TEST_EQ(std::accumulate(split.begin(), split.end(),
+                            std::size_t(0)),
+                rank);
+        }
+
+        // all splits were served from the same slab
+        HPX_TEST_EQ(arena->num_slabs(), std::size_t(1));
+    }).get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    multiway_merge_test();
+    multiway_merge_equal_keys_test();
+    multiway_split_arena_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
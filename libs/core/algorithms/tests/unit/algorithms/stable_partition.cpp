@@ -76,6 +76,13 @@ void stable_partition_bad_alloc_test()
     test_stable_partition_bad_alloc<std::bidirectional_iterator_tag>();
 }
 
+void stable_partition_throwing_move_test()
+{
+    using namespace hpx::execution;
+
+    test_stable_partition_throwing_move(par);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -89,6 +96,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     stable_partition_test();
     stable_partition_exception_test();
     stable_partition_bad_alloc_test();
+    stable_partition_throwing_move_test();
 
     return hpx::local::finalize();
 }
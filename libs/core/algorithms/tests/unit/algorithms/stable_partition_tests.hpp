@@ -9,10 +9,12 @@
 #include <hpx/modules/testing.hpp>
 #include <hpx/parallel/algorithms/partition.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <iostream>
 #include <iterator>
 #include <numeric>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -313,3 +315,102 @@ void test_stable_partition_bad_alloc_async(ExPolicy p, IteratorTag)
     HPX_TEST(caught_bad_alloc);
     HPX_TEST(returned_from_algorithm);
 }
+
+///////////////////////////////////////////////////////////////////////////////
+// counts its instances, the move constructor throws once moves_left drops
+// below zero
+struct throwing_move
+{
+    static inline std::atomic<std::ptrdiff_t> instances{0};
+    static inline std::atomic<std::ptrdiff_t> moves_left{0};
+
+    explicit throwing_move(int value)
+      : value(value)
+    {
+        ++instances;
+    }
+
+    throwing_move(throwing_move const& rhs)
+      : value(rhs.value)
+    {
+        ++instances;
+    }
+
+    throwing_move(throwing_move&& rhs)
+      : value(rhs.value)
+    {
+        if (--moves_left < 0)
+        {
+            throw std::runtime_error("test");
+        }
+        ++instances;
+    }
+
+    throwing_move& operator=(throwing_move const&) = default;
+    throwing_move& operator=(throwing_move&&) = default;
+
+    ~throwing_move()
+    {
+        --instances;
+    }
+
+    int value;
+};
+
+// all elements moved to the temporary buffer are destroyed if moving one of
+// them fails
+template <typename ExPolicy>
+void test_stable_partition_throwing_move(ExPolicy policy)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    auto pred = [](throwing_move const& t) { return t.value % 2 == 0; };
+
+    // count the number of moves needed to partition the sequence
+    std::ptrdiff_t const max_moves = 1000000000;
+    throwing_move::moves_left = max_moves;
+    {
+        std::vector<throwing_move> c;
+        c.reserve(10007);
+        for (int i = 0; i != 10007; ++i)
+        {
+            c.emplace_back(i);
+        }
+        hpx::stable_partition(policy, std::begin(c), std::end(c), pred);
+    }
+    HPX_TEST_EQ(throwing_move::instances.load(), std::ptrdiff_t(0));
+
+    std::ptrdiff_t const moves = max_moves - throwing_move::moves_left;
+    for (std::ptrdiff_t const fail_at : {moves / 2, moves - 1})
+    {
+        bool caught_exception = false;
+        {
+            std::vector<throwing_move> c;
+            c.reserve(10007);
+            for (int i = 0; i != 10007; ++i)
+            {
+                c.emplace_back(i);
+            }
+
+            throwing_move::moves_left = fail_at;
+            try
+            {
+                hpx::stable_partition(policy, std::begin(c), std::end(c), pred);
+                HPX_TEST(false);
+            }
+            catch (hpx::exception_list const&)
+            {
+                caught_exception = true;
+            }
+            catch (...)
+            {
+                HPX_TEST(false);
+            }
+            throwing_move::moves_left = max_moves;
+        }
+
+        HPX_TEST(caught_exception);
+        HPX_TEST_EQ(throwing_move::instances.load(), std::ptrdiff_t(0));
+    }
+}
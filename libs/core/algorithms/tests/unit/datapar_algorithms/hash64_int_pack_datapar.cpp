@@ -0,0 +1,93 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Hashing keys using hash64_int_pack and the datapar execution policies
+// gives the same results as hashing every key using hash64_int.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/hashing/hash64.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_hash64_int_pack(ExPolicy policy)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    // not a multiple of the vector pack size to exercise the remainder loop
+    std::vector<std::uint64_t> keys(10007);
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        keys[i] = static_cast<std::uint64_t>(std::rand()) * i;
+    }
+
+    std::uint64_t const seed = static_cast<std::uint64_t>(std::rand());
+
+    std::vector<std::uint64_t> hashes(keys.size());
+    hpx::transform(policy, keys.begin(), keys.end(), hashes.begin(),
+        [seed](auto const& k) { return hpx::util::hash64_int_pack(k, seed); });
+
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        HPX_TEST_EQ(hashes[i], hpx::util::hash64_int(keys[i], seed));
+    }
+}
+
+void hash64_int_pack_test()
+{
+    using namespace hpx::execution;
+
+    test_hash64_int_pack(simd);
+    test_hash64_int_pack(par_simd);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    hash64_int_pack_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,212 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::memory {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A monotonic memory resource handing out memory from a list of slabs.
+    ///
+    /// Every HPX thread owns a task_arena which is reset whenever the thread
+    /// terminates (or its thread_data is recycled). Memory allocated from the
+    /// arena is released only when the arena is reset, individual
+    /// deallocations are no-ops, except for deallocating the most recent
+    /// allocation, which is rolled back (thus memory released in reverse
+    /// order of allocation is reused). This makes the arena well suited for
+    /// short-lived temporary allocations that do not outlive the task that
+    /// created them.
+    ///
+    /// Slabs are taken from (and returned to) a cache local to the calling
+    /// OS-thread, which avoids contention on the global allocator.
+    ///
+    /// The arena is not thread-safe. The arena of an HPX thread may be used
+    /// only by that thread, even though it may be resumed on a different
+    /// worker thread after having been suspended. Memory allocated from the
+    /// arena must not be handed to other HPX threads that might outlive the
+    /// owning thread.
+    class HPX_CORE_EXPORT task_arena
+    {
+    public:
+        // size of the slabs used to satisfy allocations
+        static constexpr std::size_t slab_size = 64 * 1024;
+
+        task_arena() noexcept = default;
+
+        task_arena(task_arena const&) = delete;
+        task_arena(task_arena&&) = delete;
+        task_arena& operator=(task_arena const&) = delete;
+        task_arena& operator=(task_arena&&) = delete;
+
+        ~task_arena()
+        {
+            reset();
+        }
+
+        /// Allocate \a bytes bytes of memory aligned to \a alignment.
+        [[nodiscard]] void* allocate(std::size_t bytes,
+            std::size_t alignment = alignof(std::max_align_t))
+        {
+            // alignment is required to be a power of two
+            auto const current = reinterpret_cast<std::uintptr_t>(current_);
+            std::uintptr_t const aligned =
+                (current + alignment - 1) & ~(alignment - 1);
+
+            if (current_ != nullptr &&
+                aligned + bytes <= reinterpret_cast<std::uintptr_t>(end_))
+            {
+                current_ = reinterpret_cast<char*>(aligned + bytes);
+                return reinterpret_cast<void*>(aligned);
+            }
+            return allocate_slow(bytes, alignment);
+        }
+
+        /// Deallocate memory previously allocated from this arena. Only the
+        /// most recent allocation is actually released, all other memory is
+        /// released when the arena is reset.
+        void deallocate(
+            void* p, std::size_t bytes, std::size_t /* alignment */ = 0) noexcept
+        {
+            if (static_cast<char*>(p) + bytes == current_)
+            {
+                current_ = static_cast<char*>(p);
+            }
+        }
+
+        /// Return whether the given memory was allocated from this arena.
+        [[nodiscard]] bool contains(void const* p) const noexcept;
+
+        /// Release all memory allocated from this arena.
+        void reset() noexcept;
+
+        /// Return the number of slabs currently used by this arena.
+        [[nodiscard]] std::size_t num_slabs() const noexcept;
+
+    private:
+        struct slab;
+
+        void* allocate_slow(std::size_t bytes, std::size_t alignment);
+
+        slab* slabs_ = nullptr;
+        char* current_ = nullptr;
+        char* end_ = nullptr;
+    };
+
+    /// Return the arena associated with the currently running HPX thread,
+    /// returns nullptr if called from outside an HPX thread.
+    HPX_CORE_EXPORT task_arena* get_task_arena() noexcept;
+
+    namespace detail {
+
+        using get_task_arena_type = task_arena* (*) () noexcept;
+
+        // The threading subsystem registers the function returning the arena
+        // of the current HPX thread.
+        HPX_CORE_EXPORT void set_get_task_arena(get_task_arena_type f) noexcept;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Standard allocator drawing its memory from the given task_arena. If
+    /// there is none (e.g. outside of HPX threads), memory is allocated using
+    /// the global operator new.
+    ///
+    /// The allocator has to be bound explicitly to the arena of the current
+    /// HPX thread (see get_task_arena). Containers using it must be created
+    /// and destroyed by that thread and must not outlive it. The memory may
+    /// be accessed by other threads while the owning thread is alive.
+    template <typename T>
+    class task_arena_allocator
+    {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = task_arena_allocator<U>;
+        };
+
+        explicit constexpr task_arena_allocator(task_arena* arena) noexcept
+          : arena_(arena)
+        {
+        }
+
+        template <typename U>
+        constexpr task_arena_allocator(    //-V659
+            task_arena_allocator<U> const& rhs) noexcept
+          : arena_(rhs.arena())
+        {
+        }
+
+        [[nodiscard]] T* allocate(std::size_t n)
+        {
+            if (n > (std::numeric_limits<std::size_t>::max)() / sizeof(T))
+            {
+                throw std::bad_array_new_length();
+            }
+
+            if (arena_ != nullptr)
+            {
+                return static_cast<T*>(
+                    arena_->allocate(n * sizeof(T), alignof(T)));
+            }
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            if (arena_ != nullptr)
+            {
+                arena_->deallocate(p, n * sizeof(T), alignof(T));
+            }
+            else
+            {
+                ::operator delete(p);
+            }
+        }
+
+        [[nodiscard]] constexpr task_arena* arena() const noexcept
+        {
+            return arena_;
+        }
+
+        template <typename U>
+        friend constexpr bool operator==(task_arena_allocator const& lhs,
+            task_arena_allocator<U> const& rhs) noexcept
+        {
+            return lhs.arena_ == rhs.arena();
+        }
+
+        template <typename U>
+        friend constexpr bool operator!=(task_arena_allocator const& lhs,
+            task_arena_allocator<U> const& rhs) noexcept
+        {
+            return lhs.arena_ != rhs.arena();
+        }
+
+    private:
+        task_arena* arena_;
+    };
+}    // namespace hpx::memory
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,198 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/task_arena.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace hpx::memory {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Each slab starts with this header, the usable memory follows directly.
+    struct task_arena::slab
+    {
+        slab* next;
+        std::size_t size;    // overall size of the slab, including the header
+
+        char* begin() noexcept
+        {
+            return reinterpret_cast<char*>(this) + header_size();
+        }
+
+        char* end() noexcept
+        {
+            return reinterpret_cast<char*>(this) + size;
+        }
+
+        static constexpr std::size_t header_size() noexcept
+        {
+            return (sizeof(slab) + alignof(std::max_align_t) - 1) &
+                ~(alignof(std::max_align_t) - 1);
+        }
+    };
+
+    namespace {
+
+        // Slabs of the default size are cached per OS-thread to avoid going
+        // back to the global allocator for every task.
+        class slab_cache
+        {
+            static constexpr std::size_t max_cached_slabs = 16;
+
+        public:
+            slab_cache() = default;
+
+            slab_cache(slab_cache const&) = delete;
+            slab_cache(slab_cache&&) = delete;
+            slab_cache& operator=(slab_cache const&) = delete;
+            slab_cache& operator=(slab_cache&&) = delete;
+
+            ~slab_cache()
+            {
+                while (free_ != nullptr)
+                {
+                    void* p = free_;
+                    free_ = free_->next;
+                    ::operator delete(p);
+                }
+            }
+
+            void* get()
+            {
+                if (free_ != nullptr)
+                {
+                    void* p = free_;
+                    free_ = free_->next;
+                    --count_;
+                    return p;
+                }
+                return ::operator new(task_arena::slab_size);
+            }
+
+            void put(void* p) noexcept
+            {
+                if (count_ == max_cached_slabs)
+                {
+                    ::operator delete(p);
+                    return;
+                }
+
+                auto* f = static_cast<free_slab*>(p);
+                f->next = free_;
+                free_ = f;
+                ++count_;
+            }
+
+        private:
+            struct free_slab
+            {
+                free_slab* next;
+            };
+
+            free_slab* free_ = nullptr;
+            std::size_t count_ = 0;
+        };
+
+        slab_cache& get_slab_cache()
+        {
+            thread_local slab_cache cache;
+            return cache;
+        }
+    }    // namespace
+
+    void* task_arena::allocate_slow(std::size_t bytes, std::size_t alignment)
+    {
+        // allocations not fitting into a default sized slab get their own
+        std::size_t const required =
+            slab::header_size() + bytes + alignment - 1;
+
+        void* p = required <= slab_size ? get_slab_cache().get() :
+                                          ::operator new(required);
+
+        auto* s = static_cast<slab*>(p);
+        s->next = slabs_;
+        s->size = required <= slab_size ? slab_size : required;
+        slabs_ = s;
+
+        auto const begin = reinterpret_cast<std::uintptr_t>(s->begin());
+        std::uintptr_t const aligned =
+            (begin + alignment - 1) & ~(alignment - 1);
+
+        current_ = reinterpret_cast<char*>(aligned + bytes);
+        end_ = s->end();
+
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    void task_arena::reset() noexcept
+    {
+        while (slabs_ != nullptr)
+        {
+            slab* s = slabs_;
+            slabs_ = s->next;
+
+            if (s->size == slab_size)
+            {
+                get_slab_cache().put(s);
+            }
+            else
+            {
+                ::operator delete(s);
+            }
+        }
+
+        current_ = nullptr;
+        end_ = nullptr;
+    }
+
+    bool task_arena::contains(void const* p) const noexcept
+    {
+        for (slab* s = slabs_; s != nullptr; s = s->next)
+        {
+            if (p >= s->begin() && p < s->end())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::size_t task_arena::num_slabs() const noexcept
+    {
+        std::size_t count = 0;
+        for (slab const* s = slabs_; s != nullptr; s = s->next)
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        namespace {
+
+            get_task_arena_type get_task_arena_f = nullptr;
+        }    // namespace
+
+        void set_get_task_arena(get_task_arena_type f) noexcept
+        {
+            get_task_arena_f = f;
+        }
+    }    // namespace detail
+
+    task_arena* get_task_arena() noexcept
+    {
+        if (detail::get_task_arena_f != nullptr)
+        {
+            return detail::get_task_arena_f();
+        }
+        return nullptr;
+    }
+}    // namespace hpx::memory
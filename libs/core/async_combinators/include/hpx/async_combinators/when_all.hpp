@@ -124,6 +124,55 @@ namespace hpx {
         typename Container = vector<
             future<typename std::iterator_traits<InputIter>::value_type>>>
     hpx::future<Container> when_all_n(InputIter begin, std::size_t count);
+
+    /// \brief function \a when_all_values creates a future object that
+    ///        becomes ready when all elements in a set of \a future or
+    ///        \a shared_future objects become ready. Other than \a when_all,
+    ///        the returned future holds the values of the given futures.
+    ///
+    /// \param values   [in] A std::vector holding an arbitrary amount of
+    ///                 \a future or \a shared_future objects for which
+    ///                 \a when_all_values should wait.
+    ///
+    /// \tparam Range   The type of the given vector, std::vector<Future>
+    ///                 (possibly cv- or reference-qualified).
+    /// \tparam R       The value type of the futures, i.e.
+    ///                 std::decay_t<future_traits_t<Future>>.
+    ///
+    /// \return   Returns a future holding the values of the given futures:
+    ///           - future<std::vector<R>>: The order of the values in the
+    ///             output vector will be the same as given by the input
+    ///             vector.
+    ///           - future<void>: If the given futures are of type
+    ///             future<void> or shared_future<void>.
+    ///
+    /// \note     If any of the given futures holds an exception, the
+    ///           returned future holds the exception of the first of those
+    ///           (in input order).
+    ///           The futures passed as an lvalue are invalidated (futures) or
+    ///           copied (shared_futures).
+    template <typename Range,
+        typename R = std::decay_t<
+            future_traits_t<typename std::decay_t<Range>::value_type>>>
+    hpx::future<std::conditional_t<std::is_void_v<R>, void, std::vector<R>>>
+    when_all_values(Range&& values);
+
+    /// \copybrief when_all_values(Range&& values)
+    ///
+    /// \param first    [in] The iterator pointing to the first element of a
+    ///                 sequence of \a future or \a shared_future objects for
+    ///                 which \a when_all_values should wait.
+    /// \param last     [in] The iterator pointing to the last element of a
+    ///                 sequence of \a future or \a shared_future objects for
+    ///                 which \a when_all_values should wait.
+    ///
+    /// \return   Returns a future holding the values of the given futures,
+    ///           see when_all_values(Range&& values).
+    template <typename InputIter,
+        typename R = std::decay_t<future_traits_t<
+            typename std::iterator_traits<InputIter>::value_type>>>
+    hpx::future<std::conditional_t<std::is_void_v<R>, void, std::vector<R>>>
+    when_all_values(InputIter first, InputIter last);
 }    // namespace hpx
 
 #else    // DOXYGEN
@@ -133,6 +182,7 @@ namespace hpx {
 #include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/concurrency/stack.hpp>
 #include <hpx/datastructures/tuple.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/functional/tag_invoke.hpp>
 #include <hpx/futures/detail/future_data.hpp>
 #include <hpx/futures/detail/future_transforms.hpp>
@@ -143,9 +193,13 @@ namespace hpx {
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/futures/traits/is_future.hpp>
 #include <hpx/futures/traits/is_future_range.hpp>
+#include <hpx/modules/memory.hpp>
 #include <hpx/pack_traversal/pack_traversal_async.hpp>
+#include <hpx/type_support/unused.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <exception>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -239,6 +293,205 @@ namespace hpx::lcos::detail {
         return hpx::traits::future_access<typename frame_type::type>::create(
             HPX_MOVE(frame));
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Specialized implementation for (possibly very large) std::vectors of
+    // futures: instead of traversing the futures one by one, a callback is
+    // attached to all of them at once. The callbacks share a single atomic
+    // countdown, the last one to fire makes the frame ready. The callbacks
+    // refer to the frame by a plain pointer, thus the frame is the only
+    // allocation needed.
+    template <typename Future, bool Values>
+    struct when_all_vector_result
+    {
+        using type = std::vector<Future>;
+    };
+
+    template <typename Future>
+    struct when_all_vector_result<Future, true>
+    {
+        using value_type = hpx::traits::future_traits_t<Future>;
+        using type = std::conditional_t<std::is_void_v<value_type>, void,
+            std::vector<std::decay_t<value_type>>>;
+    };
+
+    template <typename Future, bool Values>
+    class when_all_vector_frame
+      : public future_data<typename when_all_vector_result<Future, Values>::type>
+    {
+    public:
+        using result_type =
+            typename when_all_vector_result<Future, Values>::type;
+        using type = hpx::future<result_type>;
+        using base_type = hpx::lcos::detail::future_data<result_type>;
+        using init_no_addref = typename base_type::init_no_addref;
+
+        when_all_vector_frame(
+            init_no_addref no_addref, std::vector<Future>&& values) noexcept
+          : base_type(no_addref)
+          , values_(HPX_MOVE(values))
+          , count_(values_.size() + 1)
+        {
+        }
+
+        void attach()
+        {
+            // The pending callbacks keep the frame alive. This reference is
+            // handed over to them once all callbacks have been attached, it
+            // is released by the last of them.
+            hpx::intrusive_ptr<when_all_vector_frame> this_(this);
+
+            // All futures which are ready already are accounted for at once
+            // (together with the additional count preventing the frame from
+            // becoming ready before all callbacks have been attached).
+            std::size_t ready = 1;
+            std::size_t pending = values_.size();
+            hpx::detail::try_catch_exception_ptr(
+                [&]() {
+                    for (auto& f : values_)
+                    {
+                        auto const& state =
+                            hpx::traits::detail::get_shared_state(f);
+                        if (state &&
+                            !state->is_ready(std::memory_order_relaxed))
+                        {
+                            state->execute_deferred();
+
+                            // execute_deferred might have made the future
+                            // ready
+                            if (!state->is_ready(std::memory_order_relaxed))
+                            {
+                                state->set_on_completed(
+                                    [this]() { count_down(1); });
+                                --pending;
+                                continue;
+                            }
+                        }
+                        ++ready;
+                        --pending;
+                    }
+                },
+                [&](std::exception_ptr ep) {
+                    // Account for the futures no callback was attached to,
+                    // the frame is released once the callbacks attached so
+                    // far have fired.
+                    attach_error_ = ep;
+                    this_.detach();
+                    count_down(ready + pending);
+                    std::rethrow_exception(HPX_MOVE(ep));
+                });
+
+            this_.detach();
+            count_down(ready);
+        }
+
+    private:
+        void count_down(std::size_t count)
+        {
+            if (count_.fetch_sub(count, std::memory_order_acq_rel) == count)
+            {
+                // adopt the reference acquired in attach()
+                hpx::intrusive_ptr<when_all_vector_frame> this_(this, false);
+                complete();
+            }
+        }
+
+        void complete()
+        {
+            if (attach_error_)
+            {
+                // not all of the futures may be ready
+                this->set_exception(attach_error_);
+            }
+            else if constexpr (!Values)
+            {
+                this->set_data(HPX_MOVE(values_));
+            }
+            else
+            {
+                for (auto const& f : values_)
+                {
+                    if (f.has_exception())
+                    {
+                        this->set_exception(
+                            hpx::traits::detail::get_shared_state(f)
+                                ->get_exception_ptr());
+                        return;
+                    }
+                }
+
+                if constexpr (std::is_void_v<result_type>)
+                {
+                    this->set_data(hpx::util::unused);
+                }
+                else
+                {
+                    hpx::detail::try_catch_exception_ptr(
+                        [&]() {
+                            result_type result;
+                            result.reserve(values_.size());
+                            for (auto& f : values_)
+                            {
+                                result.push_back(f.get());
+                            }
+                            this->set_data(HPX_MOVE(result));
+                        },
+                        [&](std::exception_ptr ep) {
+                            this->set_exception(HPX_MOVE(ep));
+                        });
+                }
+            }
+        }
+
+        std::vector<Future> values_;
+        std::atomic<std::size_t> count_;
+        std::exception_ptr attach_error_;
+    };
+
+    template <bool Values, typename Future>
+    typename when_all_vector_frame<Future, Values>::type when_all_vector(
+        std::vector<Future>&& values)
+    {
+        using frame_type = when_all_vector_frame<Future, Values>;
+        using init_no_addref = typename frame_type::init_no_addref;
+
+        hpx::intrusive_ptr<frame_type> frame(
+            new frame_type(init_no_addref{}, HPX_MOVE(values)), false);
+        frame->attach();
+
+        return hpx::traits::future_access<typename frame_type::type>::create(
+            HPX_MOVE(frame));
+    }
+
+    template <bool Values, typename Range>
+    decltype(auto) when_all_vector(Range&& values)
+    {
+        if constexpr (std::is_same_v<Range, std::decay_t<Range>>)
+        {
+            // the given vector can be used as the result directly
+            return when_all_vector<Values>(HPX_MOVE(values));
+        }
+        else
+        {
+            return when_all_vector<Values>(
+                hpx::traits::acquire_future_disp()(HPX_FORWARD(Range, values)));
+        }
+    }
+
+    template <typename Range>
+    struct is_future_vector : std::false_type
+    {
+    };
+
+    template <typename Future>
+    struct is_future_vector<std::vector<Future>>
+      : hpx::traits::is_future<Future>
+    {
+    };
+
+    template <typename Range>
+    inline constexpr bool is_future_vector_v =
+        is_future_vector<std::decay_t<Range>>::value;
 }    // namespace hpx::lcos::detail
 
 namespace hpx {
@@ -257,6 +510,15 @@ namespace hpx {
             return hpx::lcos::detail::when_all_impl(HPX_FORWARD(Args, args)...);
         }
 
+        template <typename Range,
+            typename Enable = std::enable_if_t<
+                hpx::lcos::detail::is_future_vector_v<Range>>>
+        friend decltype(auto) tag_invoke(when_all_t, Range&& values)
+        {
+            return hpx::lcos::detail::when_all_vector<false>(
+                HPX_FORWARD(Range, values));
+        }
+
         template <typename Iterator,
             typename Enable =
                 std::enable_if_t<hpx::traits::is_iterator_v<Iterator>>>
@@ -265,7 +527,7 @@ namespace hpx {
         {
             using container_type = std::vector<
                 hpx::lcos::detail::future_iterator_traits_t<Iterator>>;
-            return hpx::lcos::detail::when_all_impl(
+            return hpx::lcos::detail::when_all_vector<false>(
                 hpx::lcos::detail::acquire_future_iterators<Iterator,
                     container_type>(begin, end));
         }
@@ -289,11 +551,39 @@ namespace hpx {
         {
             using container_type = std::vector<
                 hpx::lcos::detail::future_iterator_traits_t<Iterator>>;
-            return hpx::lcos::detail::when_all_impl(
+            return hpx::lcos::detail::when_all_vector<false>(
                 hpx::lcos::detail::acquire_future_n<Iterator, container_type>(
                     begin, count));
         }
     } when_all_n{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    inline constexpr struct when_all_values_t final
+      : hpx::functional::tag<when_all_values_t>
+    {
+    private:
+        template <typename Range,
+            typename Enable = std::enable_if_t<
+                hpx::lcos::detail::is_future_vector_v<Range>>>
+        friend decltype(auto) tag_invoke(when_all_values_t, Range&& values)
+        {
+            return hpx::lcos::detail::when_all_vector<true>(
+                HPX_FORWARD(Range, values));
+        }
+
+        template <typename Iterator,
+            typename Enable =
+                std::enable_if_t<hpx::traits::is_iterator_v<Iterator>>>
+        friend decltype(auto) tag_invoke(
+            when_all_values_t, Iterator begin, Iterator end)
+        {
+            using container_type = std::vector<
+                hpx::lcos::detail::future_iterator_traits_t<Iterator>>;
+            return hpx::lcos::detail::when_all_vector<true>(
+                hpx::lcos::detail::acquire_future_iterators<Iterator,
+                    container_type>(begin, end));
+        }
+    } when_all_values{};
 }    // namespace hpx
 
 #endif    // DOXYGEN
@@ -0,0 +1,207 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int make_int_slowly(int i)
+{
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(10 * (i % 3)));
+    return i;
+}
+
+std::vector<hpx::future<int>> make_futures(std::size_t count)
+{
+    std::vector<hpx::future<int>> futures;
+    futures.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            futures.push_back(hpx::make_ready_future(static_cast<int>(i)));
+        }
+        else
+        {
+            futures.push_back(hpx::async(&make_int_slowly, static_cast<int>(i)));
+        }
+    }
+    return futures;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_when_all_values()
+{
+    std::size_t const count = 100;
+
+    hpx::future<std::vector<int>> r =
+        hpx::when_all_values(make_futures(count));
+    std::vector<int> result = r.get();
+
+    HPX_TEST_EQ(result.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(result[i], static_cast<int>(i));
+    }
+}
+
+void test_when_all_values_lvalue()
+{
+    std::size_t const count = 100;
+
+    std::vector<hpx::future<int>> futures = make_futures(count);
+    std::vector<int> result = hpx::when_all_values(futures).get();
+
+    HPX_TEST_EQ(result.size(), count);
+    for (auto const& f : futures)
+    {
+        HPX_TEST(!f.valid());
+    }
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(result[i], static_cast<int>(i));
+    }
+}
+
+void test_when_all_values_iterators()
+{
+    std::size_t const count = 100;
+
+    std::vector<hpx::future<int>> futures = make_futures(count);
+    std::vector<int> result =
+        hpx::when_all_values(futures.begin(), futures.end()).get();
+
+    HPX_TEST_EQ(result.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(result[i], static_cast<int>(i));
+    }
+}
+
+void test_when_all_values_shared()
+{
+    std::size_t const count = 100;
+
+    std::vector<hpx::shared_future<int>> futures;
+    for (auto&& f : make_futures(count))
+    {
+        futures.push_back(HPX_MOVE(f));
+    }
+
+    std::vector<int> result = hpx::when_all_values(futures).get();
+
+    HPX_TEST_EQ(result.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST(futures[i].valid());
+        HPX_TEST_EQ(result[i], static_cast<int>(i));
+    }
+}
+
+void test_when_all_values_void()
+{
+    std::vector<hpx::future<void>> futures;
+    for (int i = 0; i != 100; ++i)
+    {
+        futures.push_back(hpx::async([i]() { make_int_slowly(i); }));
+    }
+
+    hpx::future<void> r = hpx::when_all_values(HPX_MOVE(futures));
+    r.get();
+    HPX_TEST(!r.valid());
+}
+
+void test_when_all_values_empty()
+{
+    hpx::future<std::vector<int>> r =
+        hpx::when_all_values(std::vector<hpx::future<int>>());
+
+    HPX_TEST(r.is_ready());
+    HPX_TEST(r.get().empty());
+}
+
+void test_when_all_values_exception()
+{
+    std::vector<hpx::future<int>> futures = make_futures(10);
+    futures.push_back(hpx::async([]() -> int {
+        make_int_slowly(1);
+        throw std::runtime_error("first");
+    }));
+    futures.push_back(hpx::make_exceptional_future<int>(
+        std::logic_error("second")));
+
+    hpx::future<std::vector<int>> r = hpx::when_all_values(HPX_MOVE(futures));
+
+    bool caught_exception = false;
+    try
+    {
+        r.get();
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const& e)
+    {
+        HPX_TEST_EQ(std::string(e.what()), std::string("first"));
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+}
+
+void test_when_all_large()
+{
+    std::size_t const count = 100000;
+
+    std::vector<hpx::future<int>> futures;
+    futures.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        futures.push_back(hpx::async([i]() { return static_cast<int>(i); }));
+    }
+
+    // the futures are moved into the result
+    std::vector<hpx::future<int>> result =
+        hpx::when_all(HPX_MOVE(futures)).get();
+
+    HPX_TEST_EQ(result.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST(result[i].is_ready());
+        HPX_TEST_EQ(result[i].get(), static_cast<int>(i));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_when_all_values();
+    test_when_all_values_lvalue();
+    test_when_all_values_iterators();
+    test_when_all_values_shared();
+    test_when_all_values_void();
+    test_when_all_values_empty();
+    test_when_all_values_exception();
+    test_when_all_large();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
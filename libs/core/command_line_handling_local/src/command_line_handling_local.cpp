@@ -633,6 +633,18 @@ namespace hpx::local::detail {
         // handle high-priority threads
         handle_high_priority_threads(vm, ini_config);
 
+        // enable the built-in task profiler
+        if (vm.count("hpx:profile"))
+        {
+            ini_config.emplace_back("hpx.profile.destination=" +
+                vm["hpx:profile"].as<std::string>());
+        }
+        if (vm.count("hpx:profile-interval"))
+        {
+            ini_config.emplace_back("hpx.profile.interval=" +
+                std::to_string(vm["hpx:profile-interval"].as<std::size_t>()));
+        }
+
 #if !defined(HPX_HAVE_DISTRIBUTED_RUNTIME)
         if (debug_clp)
         {
@@ -614,6 +614,14 @@ namespace hpx::local::detail {
             ("hpx:debug-app-log", value<std::string>()->implicit_value("cout"),
                 "enable all messages on the application log channel and send all "
                 "application logs to the target destination")
+            ("hpx:profile", value<std::string>()->implicit_value("hpx.profile"),
+                "sample the HPX threads executed by all worker threads and "
+                "write the collected profile to the given file at shutdown, "
+                "file names ending in '.json' produce a Chrome trace, all "
+                "others produce collapsed stacks (default: hpx.profile)")
+            ("hpx:profile-interval", value<std::size_t>(),
+                "the sampling interval of the task profiler in microseconds "
+                "(default: 1000)")
             // ("hpx:verbose_bench", "For logging benchmarks in detail")
         ;
 
@@ -16,6 +16,7 @@
 #include <hpx/compute_local/host/block_executor.hpp>
 #include <hpx/compute_local/host/target.hpp>
 #include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution/executors/temporary_allocator.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/executors/restricted_thread_pool_executor.hpp>
 #include <hpx/functional/invoke_fused.hpp>
@@ -72,6 +73,12 @@ namespace hpx::compute::host {
             {
             }
 
+            template <typename U>
+            policy_allocator(policy_allocator<U, Policy> const& rhs)
+              : policy_(rhs.policy())
+            {
+            }
+
             policy_type const& policy() const noexcept
             {
                 return policy_;
@@ -110,7 +117,8 @@ namespace hpx::compute::host {
             {
                 try
                 {
-                    hpx::threads::create_topology().deallocate(p, n);
+                    hpx::threads::create_topology().deallocate(
+                        p, n * sizeof(T));
                 }
                 catch (...)
                 {
@@ -299,4 +307,16 @@ namespace hpx::compute::host {
             return this->policy().executor().targets();
         }
     };
+
+    /// Parallel algorithms running on a block_executor allocate their
+    /// temporary data using a block_allocator for the same targets. The
+    /// allocated memory is not touched by the allocator, its pages are placed
+    /// by the tasks of the algorithm that use it first.
+    template <typename Executor>
+    block_allocator<char, Executor> tag_invoke(
+        hpx::execution::experimental::get_temporary_allocator_t,
+        block_executor<Executor> const& exec)
+    {
+        return block_allocator<char, Executor>(exec.targets());
+    }
 }    // namespace hpx::compute::host
@@ -4,17 +4,30 @@
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
 #include <hpx/hpx_init.hpp>
 #include <hpx/modules/compute_local.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <iostream>
+#include <memory>
 #include <random>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename T>
 T* test_block_allocation(
@@ -55,6 +68,36 @@ void test_bulk_allocator(std::size_t count)
     test_block_deallocation(alloc, p, count);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// the allocator has to release all of the memory it has allocated
+void test_block_allocator_release()
+{
+    std::size_t const count = 1024 * 1024;
+
+    hpx::compute::host::block_allocator<double> alloc;
+    double* p = alloc.allocate(count);
+    HPX_TEST(p != nullptr);
+
+    // touch all of the allocated memory
+    alloc.bulk_construct(p, count, 42.0);
+    HPX_TEST(std::all_of(p, p + count, [](double d) { return d == 42.0; }));
+    alloc.bulk_destroy(p, count);
+
+    alloc.deallocate(p, count);
+
+#if defined(__linux__)
+    // the last page of the allocation must have been unmapped as well (the
+    // topology uses mmap/munmap on Linux)
+    auto const page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    char* last_page = reinterpret_cast<char*>(
+        reinterpret_cast<std::size_t>(p + count - 1) & ~(page_size - 1));
+
+    unsigned char vec = 0;
+    HPX_TEST_EQ(mincore(last_page, page_size, &vec), -1);
+    HPX_TEST_EQ(errno, ENOMEM);
+#endif
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 std::atomic<std::size_t> construction_count(0);
 std::atomic<std::size_t> destruction_count(0);
@@ -71,6 +114,48 @@ struct test
     }
 };
 
+///////////////////////////////////////////////////////////////////////////////
+// parallel algorithms running on a block_executor allocate their temporary
+// buffers through a block_allocator
+void test_temporary_allocator(std::mt19937& gen)
+{
+    using executor_type = hpx::compute::host::block_executor<>;
+    using allocator_type =
+        hpx::execution::experimental::temporary_allocator_t<executor_type&,
+            std::pair<int, std::size_t>>;
+
+    static_assert(!std::is_same_v<allocator_type,
+                      std::allocator<std::pair<int, std::size_t>>>,
+        "block_executor should expose a NUMA aware temporary allocator");
+    static_assert(
+        std::is_same_v<hpx::execution::experimental::temporary_allocator_t<
+                           hpx::execution::parallel_executor, int>,
+            std::allocator<int>>,
+        "other executors should use std::allocator");
+
+    executor_type exec(hpx::compute::host::numa_domains());
+
+    // make sure to run the parallel stable sort even if only a few cores are
+    // available
+    std::size_t const count = 300007;
+    std::uniform_int_distribution<> dis(0, 1000);
+
+    std::vector<std::pair<int, std::size_t>> v;
+    v.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        v.emplace_back(dis(gen), i);
+    }
+
+    auto policy = hpx::execution::par.on(exec).with(
+        hpx::execution::experimental::num_cores(4));
+
+    hpx::stable_sort(policy, v.begin(), v.end(),
+        [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+
+    HPX_TEST(std::is_sorted(v.begin(), v.end()));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -96,6 +181,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     test_bulk_allocator<int>(0);
 
+    test_block_allocator_release();
+
+    test_temporary_allocator(gen);
+
     return hpx::finalize();
 }
 
@@ -0,0 +1,220 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Algorithms from "Dynamic Circular Work-Stealing Deque"
+//  by D. Chase and Y. Lev
+//  Link: https://dl.acm.org/doi/10.1145/1073970.1073974
+//
+//  Memory orderings as given in "Correct and Efficient Work-Stealing for Weak
+//  Memory Models" by N. M. Le, A. Pop, A. Cohen and F. Zappa Nardelli
+//  Link: https://dl.acm.org/doi/10.1145/2442516.2442524
+//
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::lockfree {
+
+    // A work-stealing deque based on a growable circular array. Only a single
+    // thread (the owner) may call push_bottom and pop_bottom, any thread may
+    // call steal concurrently. The owner operations don't use any atomic
+    // read-modify-write operations unless a single item is left in the deque,
+    // thieves synchronize through a CAS on the top index.
+    //
+    // Arrays which are replaced when growing the deque are kept alive until
+    // the deque is destroyed as concurrent thieves might still be reading
+    // from them. As the arrays double in size, this is bounded by the size of
+    // the largest array.
+    template <typename T>
+    class chase_lev_deque
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+            "chase_lev_deque requires trivially copyable value types");
+
+        struct array
+        {
+            explicit array(std::int64_t capacity)
+              : mask(capacity - 1)
+              , data(new std::atomic<T>[static_cast<std::size_t>(capacity)])
+            {
+                HPX_ASSERT(capacity > 0 && (capacity & (capacity - 1)) == 0);
+            }
+
+            [[nodiscard]] std::int64_t capacity() const noexcept
+            {
+                return mask + 1;
+            }
+
+            void put(std::int64_t i, T const& val) noexcept
+            {
+                data[static_cast<std::size_t>(i & mask)].store(
+                    val, std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] T get(std::int64_t i) const noexcept
+            {
+                return data[static_cast<std::size_t>(i & mask)].load(
+                    std::memory_order_relaxed);
+            }
+
+            std::int64_t mask;
+            std::unique_ptr<std::atomic<T>[]> data;
+        };
+
+    public:
+        using value_type = T;
+        using size_type = std::int64_t;
+
+        explicit chase_lev_deque(std::size_t initial_capacity = 64)
+        {
+            std::int64_t capacity = 1;
+            while (capacity < static_cast<std::int64_t>(initial_capacity))
+            {
+                capacity <<= 1;
+            }
+
+            arrays_.push_back(std::make_unique<array>(capacity));
+            array_.data_.store(arrays_.back().get(), std::memory_order_relaxed);
+        }
+
+        chase_lev_deque(chase_lev_deque const&) = delete;
+        chase_lev_deque(chase_lev_deque&&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque const&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque&&) = delete;
+
+        ~chase_lev_deque() = default;
+
+        // Add an item at the bottom of the deque, may only be called by the
+        // owner.
+        void push_bottom(T const& val)
+        {
+            std::int64_t const b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_acquire);
+
+            array* a = array_.data_.load(std::memory_order_relaxed);
+            if (b - t > a->capacity() - 1)
+            {
+                a = grow(a, b, t);
+            }
+
+            a->put(b, val);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        // Remove the item most recently added at the bottom of the deque, may
+        // only be called by the owner.
+        bool pop_bottom(T& val) noexcept
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed) - 1;
+            array* a = array_.data_.load(std::memory_order_relaxed);
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // the deque was empty
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            val = a->get(b);
+            if (t == b)
+            {
+                // this is the last item, race against thieves for it
+                bool const result = top_.data_.compare_exchange_strong(t,
+                    t + 1, std::memory_order_seq_cst,
+                    std::memory_order_relaxed);
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return result;
+            }
+            return true;
+        }
+
+        // Remove the oldest item from the top of the deque, may be called by
+        // any thread.
+        bool steal(T& val) noexcept
+        {
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t const b = bottom_.data_.load(std::memory_order_acquire);
+
+            if (t >= b)
+            {
+                return false;
+            }
+
+            // the item has to be read before the CAS, afterwards the owner
+            // may overwrite its slot
+            array* a = array_.data_.load(std::memory_order_acquire);
+            T const result = a->get(t);
+            if (!top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                // lost the race against another thief or the owner
+                return false;
+            }
+
+            val = result;
+            return true;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return size() <= 0;
+        }
+
+        // The number of items in the deque, only accurate if no other thread
+        // is concurrently modifying the deque.
+        [[nodiscard]] size_type size() const noexcept
+        {
+            std::int64_t const b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_relaxed);
+            return b - t;
+        }
+
+        [[nodiscard]] size_type capacity() const noexcept
+        {
+            return array_.data_.load(std::memory_order_relaxed)->capacity();
+        }
+
+    private:
+        array* grow(array* a, std::int64_t b, std::int64_t t)
+        {
+            auto new_array = std::make_unique<array>(2 * a->capacity());
+            for (std::int64_t i = t; i != b; ++i)
+            {
+                new_array->put(i, a->get(i));
+            }
+
+            array* result = new_array.get();
+            arrays_.push_back(HPX_MOVE(new_array));
+            array_.data_.store(result, std::memory_order_release);
+            return result;
+        }
+
+        util::cache_aligned_data<std::atomic<std::int64_t>> top_{0};
+        util::cache_aligned_data<std::atomic<std::int64_t>> bottom_{0};
+        util::cache_aligned_data<std::atomic<array*>> array_{nullptr};
+
+        // all arrays ever used, accessed by the owner only
+        std::vector<std::unique_ptr<array>> arrays_;
+    };
+}    // namespace hpx::lockfree
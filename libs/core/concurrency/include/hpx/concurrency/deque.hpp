@@ -238,6 +238,10 @@ namespace hpx::lockfree {
 
     // TODO: Experiment with memory ordering to see where we can optimize
     // without breaking things.
+    //
+    // If freelist_t is reclaiming_freelist_t, the deque keeps at most
+    // initial_nodes unused nodes, all other nodes are returned to the
+    // allocator once no thread can access them anymore.
     template <typename T, typename freelist_t = caching_freelist_t,
         typename Alloc = std::allocator<T>>
     struct deque
@@ -263,7 +267,10 @@ namespace hpx::lockfree {
         using pool =
             std::conditional_t<std::is_same_v<freelist_t, caching_freelist_t>,
                 caching_freelist<node, node_allocator>,
-                static_freelist<node, node_allocator>>;
+                std::conditional_t<
+                    std::is_same_v<freelist_t, reclaiming_freelist_t>,
+                    reclaiming_freelist<node, node_allocator>,
+                    static_freelist<node, node_allocator>>>;
 
     private:
         anchor anchor_;
@@ -436,6 +443,8 @@ namespace hpx::lockfree {
         // to allocate a new deque node. Complexity: O(Processes)
         bool push_left(T data)
         {
+            [[maybe_unused]] auto const guard = pool_.guard();
+
             // Allocate the new node which we will be inserting.
             node* n = alloc_node(nullptr, nullptr, HPX_MOVE(data));
 
@@ -493,6 +502,8 @@ namespace hpx::lockfree {
         // to allocate a new deque node. Complexity: O(Processes)
         bool push_right(T data)
         {
+            [[maybe_unused]] auto const guard = pool_.guard();
+
             // Allocate the new node which we will be inserting.
             node* n = alloc_node(nullptr, nullptr, HPX_MOVE(data));
 
@@ -549,6 +560,8 @@ namespace hpx::lockfree {
         // Complexity: O(Processes)
         bool pop_left(T& r) noexcept
         {
+            [[maybe_unused]] auto const guard = pool_.guard();
+
             // Loop until we either pop an element or learn that the deque is
             // empty.
             while (true)
@@ -617,6 +630,8 @@ namespace hpx::lockfree {
         // Complexity: O(Processes)
         bool pop_right(T& r) noexcept
         {
+            [[maybe_unused]] auto const guard = pool_.guard();
+
             // Loop until we either pop an element or learn that the deque is
             // empty.
             while (true)
@@ -58,6 +58,31 @@ namespace hpx::lockfree {
         }
     };
 
+    // Keeps at most the initially allocated number of nodes, all other nodes
+    // are released once no thread can access them anymore.
+    template <typename T, typename Alloc = std::allocator<T>>
+    class reclaiming_freelist
+      : public lockfree::detail::freelist_stack<T, Alloc, true>
+    {
+        using base_type = lockfree::detail::freelist_stack<T, Alloc, true>;
+
+    public:
+        explicit reclaiming_freelist(std::size_t n = 0)
+          : lockfree::detail::freelist_stack<T, Alloc, true>(Alloc(), n)
+        {
+        }
+
+        T* allocate()
+        {
+            return this->base_type::template allocate<true, false>();
+        }
+
+        void deallocate(T* n) noexcept
+        {
+            this->base_type::template deallocate<true>(n);
+        }
+    };
+
     struct caching_freelist_t
     {
     };
@@ -65,4 +90,8 @@ namespace hpx::lockfree {
     struct static_freelist_t
     {
     };
+
+    struct reclaiming_freelist_t
+    {
+    };
 }    // namespace hpx::lockfree
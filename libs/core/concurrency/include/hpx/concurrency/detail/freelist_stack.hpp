@@ -15,6 +15,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/aligned_allocator.hpp>
+#include <hpx/concurrency/epoch_reclamation.hpp>
 #include <hpx/concurrency/detail/tagged_ptr.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/type_support/bit_cast.hpp>
@@ -29,7 +30,34 @@
 namespace hpx::lockfree::detail {
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename T, typename Alloc = std::allocator<T>>
+    // Freelists that never release their nodes before being destroyed don't
+    // need to protect the nodes while they are accessed.
+    struct no_reclamation_guard
+    {
+    };
+
+    template <bool Reclaim>
+    struct freelist_reclamation
+    {
+    };
+
+    template <>
+    struct freelist_reclamation<true>
+    {
+        epoch_domain domain;
+
+        // the number of nodes held by the freelist and the number of nodes
+        // the freelist keeps at most, additional nodes are released
+        std::atomic<std::size_t> cached{0};
+        std::atomic<std::size_t> max_cached{0};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // If Reclaim is true, the freelist keeps at most as many nodes as were
+    // reserved, all other nodes are returned to the allocator once no thread
+    // can access them anymore (see guard()).
+    template <typename T, typename Alloc = std::allocator<T>,
+        bool Reclaim = false>
     class freelist_stack : Alloc
     {
         struct freelist_node
@@ -54,6 +82,12 @@ namespace hpx::lockfree::detail {
         template <bool ThreadSafe>
         void reserve(std::size_t count)
         {
+            if constexpr (Reclaim)
+            {
+                reclamation_.max_cached.fetch_add(
+                    count, std::memory_order_relaxed);
+            }
+
             for (std::size_t i = 0; i != count; ++i)
             {
                 T* node = Alloc::allocate(1);
@@ -88,6 +122,11 @@ namespace hpx::lockfree::detail {
 
         ~freelist_stack()
         {
+            if constexpr (Reclaim)
+            {
+                reclamation_.domain.drain();
+            }
+
             tagged_node_ptr current = pool_.load();
 
             while (current)
@@ -104,6 +143,20 @@ namespace hpx::lockfree::detail {
             return pool_.is_lock_free();
         }
 
+        // All thread-safe operations of a data structure that access its
+        // nodes have to hold the returned guard while doing so.
+        [[nodiscard]] auto guard()
+        {
+            if constexpr (Reclaim)
+            {
+                return epoch_guard(reclamation_.domain);
+            }
+            else
+            {
+                return no_reclamation_guard{};
+            }
+        }
+
         constexpr T* get_handle(T* pointer) const noexcept
         {
             return pointer;
@@ -170,6 +223,12 @@ namespace hpx::lockfree::detail {
 
                 if (pool_.compare_exchange_weak(old_pool, new_pool))
                 {
+                    if constexpr (Reclaim)
+                    {
+                        reclamation_.cached.fetch_sub(
+                            1, std::memory_order_relaxed);
+                    }
+
                     void* ptr = old_pool.get_ptr();
                     return static_cast<T*>(ptr);
                 }
@@ -199,6 +258,11 @@ namespace hpx::lockfree::detail {
             tagged_node_ptr new_pool(new_pool_ptr, old_pool.get_next_tag());
 
             pool_.store(new_pool, std::memory_order_relaxed);
+            if constexpr (Reclaim)
+            {
+                reclamation_.cached.fetch_sub(1, std::memory_order_relaxed);
+            }
+
             void* ptr = old_pool.get_ptr();
             return static_cast<T*>(ptr);
         }
@@ -207,6 +271,12 @@ namespace hpx::lockfree::detail {
         template <bool ThreadSafe>
         void deallocate(T* n) noexcept
         {
+            if constexpr (Reclaim)
+            {
+                if (release<ThreadSafe>(n))
+                    return;
+            }
+
             if constexpr (ThreadSafe)
             {
                 deallocate_impl(n);
@@ -218,6 +288,46 @@ namespace hpx::lockfree::detail {
         }
 
     private:
+        static void release_node(void* p, void* self) noexcept
+        {
+            static_cast<freelist_stack*>(self)->Alloc::deallocate(
+                static_cast<T*>(p), 1);
+        }
+
+        // Release the node if the freelist holds enough nodes already. Other
+        // threads might still access the node, thread-safe operations have
+        // to defer releasing it.
+        template <bool ThreadSafe>
+        bool release(T* n) noexcept
+        {
+            auto& r = reclamation_;
+            if (r.cached.load(std::memory_order_relaxed) <
+                r.max_cached.load(std::memory_order_relaxed))
+            {
+                r.cached.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            if constexpr (ThreadSafe)
+            {
+                try
+                {
+                    r.domain.retire(n, &release_node, this);
+                }
+                catch (...)
+                {
+                    // keep the node if it can't be retired
+                    r.cached.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+            }
+            else
+            {
+                Alloc::deallocate(n, 1);
+            }
+            return true;
+        }
+
         void deallocate_impl(T* n) noexcept
         {
             void* node = n;
@@ -247,6 +357,7 @@ namespace hpx::lockfree::detail {
         }
 
         std::atomic<tagged_node_ptr> pool_;
+        HPX_NO_UNIQUE_ADDRESS freelist_reclamation<Reclaim> reclamation_;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -485,6 +596,12 @@ namespace hpx::lockfree::detail {
             return pool_.is_lock_free();
         }
 
+        // the nodes are never released, see freelist_stack::guard()
+        [[nodiscard]] constexpr no_reclamation_guard guard() const noexcept
+        {
+            return {};
+        }
+
         constexpr index_t null_handle() const noexcept
         {
             return static_cast<index_t>(NodeStorage::node_count());
@@ -624,7 +741,7 @@ namespace hpx::lockfree::detail {
 
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, typename Alloc, bool IsCompileTimeSized,
-        bool IsFixedSize, std::size_t Capacity>
+        bool IsFixedSize, std::size_t Capacity, bool Reclaim = false>
     struct select_freelist
     {
         using fixed_sized_storage_type = std::conditional_t<IsCompileTimeSized,
@@ -633,7 +750,7 @@ namespace hpx::lockfree::detail {
 
         using type = std::conditional_t<IsCompileTimeSized || IsFixedSize,
             fixed_size_freelist<T, fixed_sized_storage_type>,
-            freelist_stack<T, Alloc>>;
+            freelist_stack<T, Alloc, Reclaim>>;
     };
 
     template <typename T, bool IsNodeBased>
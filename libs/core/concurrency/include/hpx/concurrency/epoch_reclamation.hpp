@@ -0,0 +1,124 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file epoch_reclamation.hpp
+/// Epoch based memory reclamation (EBR) for lock-free data structures.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::lockfree {
+
+    class epoch_guard;
+
+    /// An epoch_domain defers the destruction of objects that were removed
+    /// from a lock-free data structure until no thread can access them
+    /// anymore. Any code accessing the shared nodes of the data structure
+    /// has to do so while holding an \a epoch_guard for the same domain.
+    /// Nodes that were unlinked from the data structure are handed to
+    /// \a retire and are destroyed once all guards that were active at the
+    /// time of retiring them have been released.
+    ///
+    /// The per-participant bookkeeping is owned by the guard and not by the
+    /// OS-thread that created it. An HPX thread holding a guard may be
+    /// suspended and resumed on a different worker thread. Holding a guard
+    /// across a suspension point is safe, but it delays the reclamation of
+    /// all objects retired in the meantime.
+    class HPX_CORE_EXPORT epoch_domain
+    {
+    public:
+        /// The type of the function used to destroy a retired object, it is
+        /// invoked with the retired pointer and the context passed to
+        /// \a retire.
+        using deleter_type = void (*)(void* p, void* context) noexcept;
+
+        epoch_domain();
+
+        /// Destroys all objects that were retired but not destroyed yet. The
+        /// domain must not be destroyed while a guard is active.
+        ~epoch_domain();
+
+        epoch_domain(epoch_domain const&) = delete;
+        epoch_domain(epoch_domain&&) = delete;
+        epoch_domain& operator=(epoch_domain const&) = delete;
+        epoch_domain& operator=(epoch_domain&&) = delete;
+
+        /// Schedule the object \a p for destruction using \a deleter. This
+        /// must be called only after \a p has been made unreachable for
+        /// threads acquiring a guard afterwards.
+        void retire(void* p, deleter_type deleter, void* context = nullptr);
+
+        /// Schedule the object \a p for destruction using delete.
+        template <typename T>
+        void retire(T* p)
+        {
+            retire(static_cast<void*>(p), &delete_object<T>);
+        }
+
+        /// Try to advance the global epoch and destroy all retired objects
+        /// that are not accessible by any of the active guards anymore.
+        void collect() noexcept;
+
+        /// Destroy all retired objects regardless of the active guards. This
+        /// is safe only if no other thread accesses the domain concurrently.
+        void drain() noexcept;
+
+        /// Return the number of retired objects that have not been destroyed
+        /// yet.
+        [[nodiscard]] std::size_t retired() const noexcept
+        {
+            return retired_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        friend class epoch_guard;
+
+        struct record;
+
+        template <typename T>
+        static void delete_object(void* p, void*) noexcept
+        {
+            delete static_cast<T*>(p);
+        }
+
+        record* acquire();
+        void release(record* r) noexcept;
+
+        bool try_claim(record* r) noexcept;
+        void announce(record* r) noexcept;
+        bool try_advance() noexcept;
+        void reclaim(record* r, bool all = false) noexcept;
+
+        std::atomic<std::uint64_t> epoch_;
+        std::atomic<record*> records_;
+        std::atomic<std::size_t> retired_;
+        std::uint64_t const id_;
+    };
+
+    /// While an epoch_guard is alive none of the objects retired to its
+    /// domain after the guard was acquired will be destroyed. Guards are
+    /// cheap to acquire and may be nested.
+    class HPX_CORE_EXPORT epoch_guard
+    {
+    public:
+        explicit epoch_guard(epoch_domain& domain);
+        ~epoch_guard();
+
+        epoch_guard(epoch_guard const&) = delete;
+        epoch_guard(epoch_guard&&) = delete;
+        epoch_guard& operator=(epoch_guard const&) = delete;
+        epoch_guard& operator=(epoch_guard&&) = delete;
+
+    private:
+        epoch_domain& domain_;
+        epoch_domain::record* record_;
+    };
+}    // namespace hpx::lockfree
@@ -0,0 +1,174 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hazard_pointer.hpp
+/// Hazard pointer based memory reclamation for lock-free data structures.
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace hpx::lockfree {
+
+    namespace detail {
+
+        struct hazard_record
+        {
+            std::atomic<void const*> hazard{nullptr};
+            std::atomic<bool> in_use{true};
+            hazard_record* next = nullptr;
+        };
+    }    // namespace detail
+
+    class hazard_pointer;
+
+    /// A hazard_pointer_domain defers the destruction of retired objects
+    /// for as long as a \a hazard_pointer of the same domain protects them.
+    /// In contrast to an \a epoch_domain, a thread that is delayed while
+    /// protecting an object prevents only the destruction of this object.
+    ///
+    /// The hazard pointer slots are owned by the \a hazard_pointer objects
+    /// and not by the OS-thread that acquired them, no per-thread
+    /// registration is required. An HPX thread may be suspended and resumed
+    /// on a different worker thread while protecting an object.
+    class HPX_CORE_EXPORT hazard_pointer_domain
+    {
+    public:
+        /// The type of the function used to destroy a retired object, it is
+        /// invoked with the retired pointer and the context passed to
+        /// \a retire.
+        using deleter_type = void (*)(void* p, void* context) noexcept;
+
+        hazard_pointer_domain() = default;
+
+        /// Destroys all objects that were retired but not destroyed yet. The
+        /// domain must not be destroyed while a hazard pointer is in use.
+        ~hazard_pointer_domain();
+
+        hazard_pointer_domain(hazard_pointer_domain const&) = delete;
+        hazard_pointer_domain(hazard_pointer_domain&&) = delete;
+        hazard_pointer_domain& operator=(hazard_pointer_domain const&) = delete;
+        hazard_pointer_domain& operator=(hazard_pointer_domain&&) = delete;
+
+        /// Schedule the object \a p for destruction using \a deleter. This
+        /// must be called only after \a p has been made unreachable for
+        /// hazard pointers protecting it afterwards.
+        void retire(void* p, deleter_type deleter, void* context = nullptr);
+
+        /// Schedule the object \a p for destruction using delete.
+        template <typename T>
+        void retire(T* p)
+        {
+            retire(static_cast<void*>(const_cast<std::remove_cv_t<T>*>(p)),
+                &delete_object<std::remove_cv_t<T>>);
+        }
+
+        /// Destroy all retired objects that are not protected by any hazard
+        /// pointer.
+        void collect();
+
+        /// Return the number of retired objects that have not been destroyed
+        /// yet.
+        [[nodiscard]] std::size_t retired() const noexcept
+        {
+            return retired_count_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        friend class hazard_pointer;
+
+        struct retired_object
+        {
+            void* p;
+            deleter_type deleter;
+            void* context;
+        };
+
+        template <typename T>
+        static void delete_object(void* p, void*) noexcept
+        {
+            delete static_cast<T*>(p);
+        }
+
+        detail::hazard_record* acquire();
+        void release(detail::hazard_record* r) noexcept;
+
+        void scan(std::vector<retired_object>& objects);
+
+        std::atomic<detail::hazard_record*> records_{nullptr};
+        std::atomic<std::size_t> record_count_{0};
+
+        hpx::util::spinlock mtx_;
+        std::vector<retired_object> retired_;
+        std::atomic<std::size_t> retired_count_{0};
+    };
+
+    /// A hazard_pointer owns a slot of a \a hazard_pointer_domain that can
+    /// be used to protect one object at a time from being destroyed.
+    class HPX_CORE_EXPORT hazard_pointer
+    {
+    public:
+        explicit hazard_pointer(hazard_pointer_domain& domain);
+        ~hazard_pointer();
+
+        hazard_pointer(hazard_pointer const&) = delete;
+        hazard_pointer(hazard_pointer&&) = delete;
+        hazard_pointer& operator=(hazard_pointer const&) = delete;
+        hazard_pointer& operator=(hazard_pointer&&) = delete;
+
+        /// Load the pointer stored in \a src and protect the object it
+        /// refers to. The returned object stays valid until the protection
+        /// is reset, even if it is retired concurrently.
+        template <typename T>
+        T* protect(std::atomic<T*> const& src) noexcept
+        {
+            return protect(src, [](T* p) noexcept { return p; });
+        }
+
+        /// Load the value stored in \a src and protect the object that is
+        /// referenced by \a get_pointer(value), this allows to protect the
+        /// objects referred to by tagged pointers.
+        template <typename Ptr, typename F>
+        Ptr protect(std::atomic<Ptr> const& src, F&& get_pointer) noexcept
+        {
+            Ptr p = src.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                record_->hazard.store(
+                    get_pointer(p), std::memory_order_seq_cst);
+
+                Ptr const current = src.load(std::memory_order_seq_cst);
+                if (current == p)
+                    return p;
+                p = current;
+            }
+        }
+
+        /// Protect the object \a p. The caller has to make sure that \a p
+        /// was not retired before the protection became visible.
+        template <typename T>
+        void reset_protection(T const* p) noexcept
+        {
+            record_->hazard.store(p, std::memory_order_seq_cst);
+        }
+
+        /// Stop protecting the currently protected object.
+        void reset_protection() noexcept
+        {
+            record_->hazard.store(nullptr, std::memory_order_release);
+        }
+
+    private:
+        hazard_pointer_domain& domain_;
+        detail::hazard_record* record_;
+    };
+}    // namespace hpx::lockfree
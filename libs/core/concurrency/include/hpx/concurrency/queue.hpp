@@ -29,7 +29,8 @@ namespace hpx::lockfree {
      * popping is lock-free,
      *  construction/destruction has to be synchronized. It uses a freelist for
      *  memory management, freed nodes are pushed to the freelist and not
-     *  returned to the OS before the queue is destroyed.
+     *  returned to the OS before the queue is destroyed (unless
+     *  \c ReclaimNodes is true).
      *
      *  \b Policies:
      *  - \ref hpx::lockfree::fixed_sized, defaults to \c
@@ -51,13 +52,21 @@ namespace hpx::lockfree {
      *    hpx::lockfree::allocator<std::allocator<void>> \n Specifies the
      *    allocator that is used for the internal freelist
      *
+     *  - \c ReclaimNodes, defaults to \c false \n If true, the freelist
+     *    keeps at most as many nodes as were reserved, all other nodes are
+     *    returned to the allocator using epoch based reclamation (see
+     *    \c hpx::lockfree::epoch_domain). This bounds the memory held by the
+     *    queue after bursts at the cost of additional synchronization.
+     *    Only supported for queues that are not fixed-sized.
+     *
      *  \b Requirements:
      *   - T must have a copy constructor
      *   - T must have a trivial assignment operator
      *   - T must have a trivial destructor
      */
     template <typename T, typename Allocator = std::allocator<T>,
-        std::size_t Capacity = 0, bool IsFixedSize = false>
+        std::size_t Capacity = 0, bool IsFixedSize = false,
+        bool ReclaimNodes = false>
     class queue
     {
     private:
@@ -69,6 +78,9 @@ namespace hpx::lockfree {
         static constexpr bool node_based = !(has_capacity || fixed_sized);
         static constexpr bool compile_time_sized = has_capacity;
 
+        static_assert(node_based || !ReclaimNodes,
+            "fixed-sized queues can't release their nodes");
+
         // the queue uses one dummy node
         static constexpr std::size_t capacity = Capacity + 1;
 
@@ -116,7 +128,7 @@ namespace hpx::lockfree {
             Allocator>::template rebind_alloc<node>;
 
         using pool_t = typename detail::select_freelist<node, node_allocator,
-            compile_time_sized, fixed_sized, capacity>::type;
+            compile_time_sized, fixed_sized, capacity, ReclaimNodes>::type;
 
         using tagged_node_handle = typename pool_t::tagged_node_handle;
         using handle_type = typename detail::select_tagged_handle<node,
@@ -342,6 +354,8 @@ namespace hpx::lockfree {
         template <bool Bounded, typename T_>
         bool do_push(T_&& t)
         {
+            [[maybe_unused]] auto const guard = pool.guard();
+
             node* n = pool.template construct<true, Bounded>(
                 HPX_FORWARD(T_, t), pool.null_handle());
             handle_type node_handle = pool.get_handle(n);
@@ -460,6 +474,8 @@ namespace hpx::lockfree {
         bool pop(U& ret) noexcept(
             noexcept(std::is_nothrow_constructible_v<U, T>))
         {
+            [[maybe_unused]] auto const guard = pool.guard();
+
             for (;;)
             {
                 tagged_node_handle head = head_.load(std::memory_order_acquire);
@@ -29,7 +29,8 @@ namespace hpx::lockfree {
      * popping is lock-free,
      *  construction/destruction has to be synchronized. It uses a freelist for
      *  memory management, freed nodes are pushed to the freelist and not
-     *  returned to the OS before the stack is destroyed.
+     *  returned to the OS before the stack is destroyed (unless
+     *  \c ReclaimNodes is true).
      *
      *  \b Policies:
      *
@@ -52,12 +53,20 @@ namespace hpx::lockfree {
      *    hpx::lockfree::allocator<std::allocator<void>> <br> Specifies the
      *    allocator that is used for the internal freelist
      *
+     *  - \c ReclaimNodes, defaults to \c false <br> If true, the freelist
+     *    keeps at most as many nodes as were reserved, all other nodes are
+     *    returned to the allocator using epoch based reclamation (see
+     *    \c hpx::lockfree::epoch_domain). This bounds the memory held by the
+     *    stack after bursts at the cost of additional synchronization.
+     *    Only supported for stacks that are not fixed-sized.
+     *
      *  \b Requirements:
      *  - T must have a copy constructor
      *
      */
     template <typename T, typename Allocator = std::allocator<T>,
-        std::size_t Capacity = 0, bool IsFixedSize = false>
+        std::size_t Capacity = 0, bool IsFixedSize = false,
+        bool ReclaimNodes = false>
     class stack
     {
     private:
@@ -69,6 +78,9 @@ namespace hpx::lockfree {
         static constexpr bool compile_time_sized = has_capacity;
         static constexpr std::size_t capacity = Capacity;
 
+        static_assert(node_based || !ReclaimNodes,
+            "fixed-sized stacks can't release their nodes");
+
         struct node
         {
             template <typename T_,
@@ -100,7 +112,7 @@ namespace hpx::lockfree {
             Allocator>::template rebind_alloc<node>;
 
         using pool_t = typename detail::select_freelist<node, node_allocator,
-            compile_time_sized, fixed_sized, capacity>::type;
+            compile_time_sized, fixed_sized, capacity, ReclaimNodes>::type;
         using tagged_node_handle = typename pool_t::tagged_node_handle;
 
         // check compile-time capacity
@@ -373,6 +385,8 @@ namespace hpx::lockfree {
         template <bool Bounded, typename T_>
         bool do_push(T_&& t)
         {
+            [[maybe_unused]] auto const guard = pool.guard();
+
             node* newnode =
                 pool.template construct<true, Bounded>(HPX_FORWARD(T_, t));
             if (newnode == nullptr)
@@ -385,6 +399,8 @@ namespace hpx::lockfree {
         template <bool Bounded, typename ConstIterator>
         ConstIterator do_push(ConstIterator begin, ConstIterator end)
         {
+            [[maybe_unused]] auto const guard = pool.guard();
+
             ConstIterator ret;
 
             auto top_end_pair =
@@ -582,6 +598,8 @@ namespace hpx::lockfree {
         template <typename F>
         bool consume_one(F&& f)
         {
+            [[maybe_unused]] auto const guard = pool.guard();
+
             tagged_node_handle old_tos = tos.load(std::memory_order_consume);
 
             for (;;)
@@ -637,6 +655,8 @@ namespace hpx::lockfree {
         template <typename F>
         std::size_t consume_all_atomic(F&& f)
         {
+            [[maybe_unused]] auto const guard = pool.guard();
+
             std::size_t element_count = 0;
             tagged_node_handle old_tos = tos.load(std::memory_order_consume);
 
@@ -691,6 +711,8 @@ namespace hpx::lockfree {
         template <typename F>
         std::size_t consume_all_atomic_reversed(F&& f)
         {
+            [[maybe_unused]] auto const guard = pool.guard();
+
             std::size_t element_count = 0;
             tagged_node_handle old_tos = tos.load(std::memory_order_consume);
 
@@ -0,0 +1,264 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/epoch_reclamation.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hpx::lockfree {
+
+    namespace {
+
+        // the number of objects a record collects before it tries to
+        // advance the epoch
+        constexpr std::size_t retire_threshold = 64;
+
+        std::atomic<std::uint64_t> next_domain_id(1);
+
+        // The record used last by this OS-thread. This is only a hint to
+        // find a free record quickly, guards store the record they own.
+        struct record_cache
+        {
+            std::uint64_t domain = 0;
+            void* record = nullptr;
+        };
+
+        thread_local record_cache last_record;
+
+        // a record is owned by a guard if its state is not zero, the upper
+        // bits hold the epoch that was observed by the owner
+        constexpr std::uint64_t make_state(std::uint64_t epoch) noexcept
+        {
+            return (epoch << 1) | 1;
+        }
+
+        struct retired_object
+        {
+            void* p;
+            epoch_domain::deleter_type deleter;
+            void* context;
+            std::uint64_t epoch;
+        };
+    }    // namespace
+
+    struct alignas(threads::get_cache_line_size()) epoch_domain::record
+    {
+        std::atomic<std::uint64_t> state{0};
+        record* next = nullptr;
+
+        // accessed only by the owner of the record, the epochs are ordered
+        std::vector<retired_object> retired;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    epoch_domain::epoch_domain()
+      : epoch_(0)
+      , records_(nullptr)
+      , retired_(0)
+      , id_(next_domain_id++)
+    {
+    }
+
+    epoch_domain::~epoch_domain()
+    {
+        drain();
+
+        record* r = records_.load(std::memory_order_acquire);
+        while (r != nullptr)
+        {
+            record* next = r->next;
+            delete r;
+            r = next;
+        }
+    }
+
+    void epoch_domain::retire(void* p, deleter_type deleter, void* context)
+    {
+        record* r = acquire();
+        try
+        {
+            r->retired.push_back(retired_object{
+                p, deleter, context, epoch_.load(std::memory_order_seq_cst)});
+        }
+        catch (...)
+        {
+            release(r);
+            throw;
+        }
+        retired_.fetch_add(1, std::memory_order_relaxed);
+
+        if (r->retired.size() >= retire_threshold)
+        {
+            try_advance();
+            reclaim(r);
+        }
+        release(r);
+    }
+
+    void epoch_domain::collect() noexcept
+    {
+        // objects can be destroyed after the epoch was advanced twice
+        if (try_advance())
+            try_advance();
+
+        for (record* r = records_.load(std::memory_order_acquire); r != nullptr;
+            r = r->next)
+        {
+            if (try_claim(r))
+            {
+                reclaim(r);
+                r->state.store(0, std::memory_order_release);
+            }
+        }
+    }
+
+    void epoch_domain::drain() noexcept
+    {
+        for (record* r = records_.load(std::memory_order_acquire); r != nullptr;
+            r = r->next)
+        {
+            reclaim(r, true);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    epoch_domain::record* epoch_domain::acquire()
+    {
+        record_cache& cache = last_record;
+        if (cache.domain == id_)
+        {
+            auto* r = static_cast<record*>(cache.record);
+            if (try_claim(r))
+                return r;
+        }
+
+        for (record* r = records_.load(std::memory_order_acquire); r != nullptr;
+            r = r->next)
+        {
+            if (try_claim(r))
+            {
+                cache = record_cache{id_, r};
+                return r;
+            }
+        }
+
+        // all records are in use, add a new one
+        auto* r = new record;
+        r->state.store(make_state(epoch_.load(std::memory_order_relaxed)),
+            std::memory_order_relaxed);
+        r->next = records_.load(std::memory_order_relaxed);
+        while (!records_.compare_exchange_weak(r->next, r,
+            std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+        }
+        announce(r);
+
+        cache = record_cache{id_, r};
+        return r;
+    }
+
+    void epoch_domain::release(record* r) noexcept
+    {
+        if (!r->retired.empty())
+            reclaim(r);
+
+        r->state.store(0, std::memory_order_release);
+        last_record = record_cache{id_, r};
+    }
+
+    bool epoch_domain::try_claim(record* r) noexcept
+    {
+        std::uint64_t expected = 0;
+        if (r->state.load(std::memory_order_relaxed) != 0 ||
+            !r->state.compare_exchange_strong(expected,
+                make_state(epoch_.load(std::memory_order_relaxed)),
+                std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return false;
+        }
+
+        announce(r);
+        return true;
+    }
+
+    // Make sure the epoch stored in the record is the current one. An epoch
+    // that was advanced after we read it but before the record was updated
+    // might have been advanced without taking this record into account.
+    void epoch_domain::announce(record* r) noexcept
+    {
+        std::uint64_t announced = r->state.load(std::memory_order_relaxed) >> 1;
+        for (;;)
+        {
+            std::uint64_t const current =
+                epoch_.load(std::memory_order_seq_cst);
+            if (current == announced)
+                break;
+
+            r->state.store(make_state(current), std::memory_order_seq_cst);
+            announced = current;
+        }
+    }
+
+    // The epoch can be advanced only if all owned records have observed the
+    // current epoch.
+    bool epoch_domain::try_advance() noexcept
+    {
+        std::uint64_t current = epoch_.load(std::memory_order_seq_cst);
+        for (record* r = records_.load(std::memory_order_seq_cst); r != nullptr;
+            r = r->next)
+        {
+            std::uint64_t const state =
+                r->state.load(std::memory_order_seq_cst);
+            if (state != 0 && (state >> 1) != current)
+                return false;
+        }
+
+        // if this fails, the epoch was advanced by another thread
+        epoch_.compare_exchange_strong(
+            current, current + 1, std::memory_order_seq_cst);
+        return true;
+    }
+
+    // Objects retired during epoch e might still be accessed by guards that
+    // have observed epoch e - 1, they can be destroyed in epoch e + 2.
+    void epoch_domain::reclaim(record* r, bool all) noexcept
+    {
+        std::uint64_t const current = epoch_.load(std::memory_order_seq_cst);
+
+        auto& objects = r->retired;
+        std::size_t count = 0;
+        while (count != objects.size() &&
+            (all || objects[count].epoch + 2 <= current))
+        {
+            retired_object const& obj = objects[count];
+            obj.deleter(obj.p, obj.context);
+            ++count;
+        }
+
+        if (count != 0)
+        {
+            objects.erase(objects.begin(),
+                objects.begin() + static_cast<std::ptrdiff_t>(count));
+            retired_.fetch_sub(count, std::memory_order_relaxed);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    epoch_guard::epoch_guard(epoch_domain& domain)
+      : domain_(domain)
+      , record_(domain.acquire())
+    {
+    }
+
+    epoch_guard::~epoch_guard()
+    {
+        domain_.release(record_);
+    }
+}    // namespace hpx::lockfree
@@ -0,0 +1,160 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/hazard_pointer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::lockfree {
+
+    namespace {
+
+        // the minimal number of retired objects before the hazard pointers
+        // are scanned
+        constexpr std::size_t scan_threshold = 64;
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    hazard_pointer_domain::~hazard_pointer_domain()
+    {
+        for (retired_object const& obj : retired_)
+        {
+            obj.deleter(obj.p, obj.context);
+        }
+
+        detail::hazard_record* r = records_.load(std::memory_order_acquire);
+        while (r != nullptr)
+        {
+            detail::hazard_record* next = r->next;
+            delete r;
+            r = next;
+        }
+    }
+
+    void hazard_pointer_domain::retire(
+        void* p, deleter_type deleter, void* context)
+    {
+        std::vector<retired_object> objects;
+        {
+            std::unique_lock<hpx::util::spinlock> l(mtx_);
+
+            retired_.push_back(retired_object{p, deleter, context});
+            retired_count_.fetch_add(1, std::memory_order_relaxed);
+
+            // scanning is amortized over a number of retired objects that
+            // grows with the number of hazard pointers
+            std::size_t const threshold = (std::max)(scan_threshold,
+                2 * record_count_.load(std::memory_order_relaxed));
+            if (retired_.size() < threshold)
+                return;
+
+            std::swap(objects, retired_);
+        }
+
+        scan(objects);
+    }
+
+    void hazard_pointer_domain::collect()
+    {
+        std::vector<retired_object> objects;
+        {
+            std::unique_lock<hpx::util::spinlock> l(mtx_);
+            std::swap(objects, retired_);
+        }
+
+        scan(objects);
+    }
+
+    // Destroy all objects that are not protected, the remaining objects are
+    // handed back to the domain.
+    void hazard_pointer_domain::scan(std::vector<retired_object>& objects)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::vector<void const*> hazards;
+        hazards.reserve(record_count_.load(std::memory_order_relaxed));
+        for (detail::hazard_record* r =
+                 records_.load(std::memory_order_acquire);
+            r != nullptr; r = r->next)
+        {
+            if (void const* p = r->hazard.load(std::memory_order_seq_cst))
+                hazards.push_back(p);
+        }
+        std::sort(hazards.begin(), hazards.end());
+
+        auto const protected_end = std::partition(objects.begin(),
+            objects.end(), [&](retired_object const& obj) {
+                return std::binary_search(
+                    hazards.begin(), hazards.end(), obj.p);
+            });
+
+        std::size_t const count =
+            static_cast<std::size_t>(objects.end() - protected_end);
+        for (auto it = protected_end; it != objects.end(); ++it)
+        {
+            it->deleter(it->p, it->context);
+        }
+        objects.erase(protected_end, objects.end());
+        retired_count_.fetch_sub(count, std::memory_order_relaxed);
+
+        if (!objects.empty())
+        {
+            std::unique_lock<hpx::util::spinlock> l(mtx_);
+            retired_.insert(retired_.end(), objects.begin(), objects.end());
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    detail::hazard_record* hazard_pointer_domain::acquire()
+    {
+        for (detail::hazard_record* r =
+                 records_.load(std::memory_order_acquire);
+            r != nullptr; r = r->next)
+        {
+            bool expected = false;
+            if (!r->in_use.load(std::memory_order_relaxed) &&
+                r->in_use.compare_exchange_strong(expected, true,
+                    std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return r;
+            }
+        }
+
+        // all records are in use, add a new one
+        auto* r = new detail::hazard_record;
+        r->next = records_.load(std::memory_order_relaxed);
+        while (!records_.compare_exchange_weak(r->next, r,
+            std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+        record_count_.fetch_add(1, std::memory_order_relaxed);
+        return r;
+    }
+
+    void hazard_pointer_domain::release(detail::hazard_record* r) noexcept
+    {
+        r->hazard.store(nullptr, std::memory_order_release);
+        r->in_use.store(false, std::memory_order_release);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hazard_pointer::hazard_pointer(hazard_pointer_domain& domain)
+      : domain_(domain)
+      , record_(domain.acquire())
+    {
+    }
+
+    hazard_pointer::~hazard_pointer()
+    {
+        domain_.release(record_);
+    }
+}    // namespace hpx::lockfree
@@ -0,0 +1,135 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the overhead of the epoch based and hazard pointer based memory
+// reclamation compared to lock-free data structures that never release their
+// nodes. This does not require any external library (see
+// tests/performance/local/libcds_hazard_pointer_overhead.cpp).
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+#if HPX_DEBUG
+constexpr std::uint64_t NUM_TESTS = 100000;
+#else
+constexpr std::uint64_t NUM_TESTS = 10000000;
+#endif
+
+template <typename F>
+double measure(std::size_t num_tasks, F const& f)
+{
+    std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async(f));
+    }
+    hpx::wait_all(tasks);
+
+    std::uint64_t const end = hpx::chrono::high_resolution_clock::now();
+    return static_cast<double>(end - start) / 1e9;
+}
+
+void print_result(
+    std::string const& name, std::size_t num_tasks, double elapsed)
+{
+    double const ops = static_cast<double>(num_tasks * NUM_TESTS);
+    std::cout << name << ": " << (ops / elapsed) << " [op/s] ("
+              << (elapsed / ops) << " [s/op])\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// push and pop a number of elements, the nodes of the stack are released
+// after each burst if reclamation is enabled
+template <typename Stack>
+void stack_bursts(std::string const& name, std::size_t num_tasks)
+{
+    constexpr std::uint64_t burst = 100;
+
+    Stack stk(burst);
+    double const elapsed = measure(num_tasks, [&]() {
+        for (std::uint64_t i = 0; i != NUM_TESTS / burst; ++i)
+        {
+            for (std::uint64_t j = 0; j != burst; ++j)
+            {
+                stk.push(j);
+            }
+
+            std::uint64_t value;
+            for (std::uint64_t j = 0; j != burst; ++j)
+            {
+                stk.pop(value);
+            }
+        }
+    });
+    print_result(name, num_tasks, elapsed);
+}
+
+void epoch_guards(std::size_t num_tasks)
+{
+    hpx::lockfree::epoch_domain domain;
+    double const elapsed = measure(num_tasks, [&]() {
+        for (std::uint64_t i = 0; i != NUM_TESTS; ++i)
+        {
+            hpx::lockfree::epoch_guard guard(domain);
+        }
+    });
+    print_result("epoch_guard", num_tasks, elapsed);
+}
+
+void hazard_pointers(std::size_t num_tasks)
+{
+    hpx::lockfree::hazard_pointer_domain domain;
+    std::atomic<std::uint64_t*> shared(new std::uint64_t(42));
+
+    double const elapsed = measure(num_tasks, [&]() {
+        hpx::lockfree::hazard_pointer hp(domain);
+        for (std::uint64_t i = 0; i != NUM_TESTS; ++i)
+        {
+            hp.protect(shared);
+            hp.reset_protection();
+        }
+    });
+    print_result("hazard_pointer::protect", num_tasks, elapsed);
+
+    delete shared.load();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::size_t const num_tasks = hpx::get_os_thread_count();
+
+    using stack_type = hpx::lockfree::stack<std::uint64_t>;
+    using reclaiming_stack_type = hpx::lockfree::stack<std::uint64_t,
+        std::allocator<std::uint64_t>, 0, false, true>;
+
+    stack_bursts<stack_type>("stack", num_tasks);
+    stack_bursts<reclaiming_stack_type>("stack (reclaiming)", num_tasks);
+
+    epoch_guards(num_tasks);
+    hazard_pointers(num_tasks);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    return hpx::local::init(hpx_main, argc, argv);
+}
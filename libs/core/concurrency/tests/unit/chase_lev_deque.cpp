@@ -0,0 +1,150 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/concurrency/chase_lev_deque.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+void test_basic()
+{
+    hpx::lockfree::chase_lev_deque<std::int64_t> q(4);
+
+    std::int64_t val = -1;
+    HPX_TEST(q.empty());
+    HPX_TEST(!q.pop_bottom(val));
+    HPX_TEST(!q.steal(val));
+
+    // the deque has to grow several times
+    for (std::int64_t i = 0; i != 100; ++i)
+    {
+        q.push_bottom(i);
+    }
+    HPX_TEST_EQ(q.size(), 100);
+    HPX_TEST_LTE(static_cast<std::int64_t>(100), q.capacity());
+
+    // the owner pops the most recently pushed items
+    HPX_TEST(q.pop_bottom(val));
+    HPX_TEST_EQ(val, 99);
+    HPX_TEST(q.pop_bottom(val));
+    HPX_TEST_EQ(val, 98);
+
+    // thieves steal the oldest items
+    HPX_TEST(q.steal(val));
+    HPX_TEST_EQ(val, 0);
+    HPX_TEST(q.steal(val));
+    HPX_TEST_EQ(val, 1);
+
+    for (std::int64_t i = 97; i != 1; --i)
+    {
+        HPX_TEST(q.pop_bottom(val));
+        HPX_TEST_EQ(val, i);
+    }
+
+    HPX_TEST(q.empty());
+    HPX_TEST(!q.pop_bottom(val));
+    HPX_TEST(!q.steal(val));
+
+    // the deque is usable after having been emptied
+    q.push_bottom(42);
+    HPX_TEST(q.steal(val));
+    HPX_TEST_EQ(val, 42);
+    HPX_TEST(q.empty());
+}
+
+void test_concurrent()
+{
+    constexpr std::int64_t num_items = 100000;
+    std::size_t const num_thieves = 3;
+
+    hpx::lockfree::chase_lev_deque<std::int64_t> q;
+    std::vector<std::atomic<int>> seen(num_items);
+    for (auto& s : seen)
+    {
+        s.store(0, std::memory_order_relaxed);
+    }
+
+    std::atomic<bool> done(false);
+
+    std::vector<hpx::future<void>> thieves;
+    for (std::size_t i = 0; i != num_thieves; ++i)
+    {
+        thieves.push_back(hpx::async([&]() {
+            std::int64_t val;
+            while (!done.load())
+            {
+                if (q.steal(val))
+                {
+                    ++seen[val];
+                }
+                else
+                {
+                    hpx::this_thread::yield();
+                }
+            }
+            while (q.steal(val))
+            {
+                ++seen[val];
+            }
+        }));
+    }
+
+    // the owner pushes all items and pops every other one itself
+    hpx::async([&]() {
+        std::int64_t val;
+        for (std::int64_t i = 0; i != num_items; ++i)
+        {
+            q.push_bottom(i);
+            if (i % 2 == 0 && q.pop_bottom(val))
+            {
+                ++seen[val];
+            }
+            if (i % 1000 == 0)
+            {
+                hpx::this_thread::yield();
+            }
+        }
+        while (q.pop_bottom(val))
+        {
+            ++seen[val];
+        }
+        done = true;
+    }).get();
+
+    hpx::wait_all(thieves);
+
+    // every item was taken exactly once
+    std::size_t errors = 0;
+    for (auto const& s : seen)
+    {
+        if (s.load() != 1)
+        {
+            ++errors;
+        }
+    }
+    HPX_TEST_EQ(errors, static_cast<std::size_t>(0));
+    HPX_TEST(q.empty());
+}
+
+int hpx_main()
+{
+    test_basic();
+    test_concurrent();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
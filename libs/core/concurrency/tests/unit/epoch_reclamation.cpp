@@ -0,0 +1,258 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/init.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "test_common.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> destroyed_objects(0);
+
+struct tracked_object
+{
+    ~tracked_object()
+    {
+        ++destroyed_objects;
+    }
+};
+
+void test_guard_delays_destruction()
+{
+    hpx::lockfree::epoch_domain domain;
+    destroyed_objects = 0;
+
+    {
+        hpx::lockfree::epoch_guard guard(domain);
+
+        domain.retire(new tracked_object);
+        HPX_TEST_EQ(domain.retired(), static_cast<std::size_t>(1));
+
+        // the object might still be accessed by the active guard
+        domain.collect();
+        HPX_TEST_EQ(destroyed_objects.load(), static_cast<std::size_t>(0));
+        HPX_TEST_EQ(domain.retired(), static_cast<std::size_t>(1));
+
+        // guards can be nested
+        hpx::lockfree::epoch_guard nested_guard(domain);
+    }
+
+    domain.collect();
+    HPX_TEST_EQ(destroyed_objects.load(), static_cast<std::size_t>(1));
+    HPX_TEST_EQ(domain.retired(), static_cast<std::size_t>(0));
+
+    // the remaining objects are destroyed with the domain
+    {
+        hpx::lockfree::epoch_domain d;
+        hpx::lockfree::epoch_guard guard(d);
+        d.retire(new tracked_object);
+    }
+    HPX_TEST_EQ(destroyed_objects.load(), static_cast<std::size_t>(2));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// HPX threads may hold a guard while being suspended and may be resumed on a
+// different worker thread.
+void test_guard_across_suspension()
+{
+    hpx::lockfree::epoch_domain domain;
+    destroyed_objects = 0;
+
+    constexpr int num_tasks = 64;
+    constexpr int num_objects = 100;
+
+    hpx::experimental::task_group tasks;
+    for (int i = 0; i != num_tasks; ++i)
+    {
+        tasks.run([&]() {
+            for (int j = 0; j != num_objects; ++j)
+            {
+                hpx::lockfree::epoch_guard guard(domain);
+                domain.retire(new tracked_object);
+                hpx::this_thread::yield();
+            }
+        });
+    }
+    tasks.wait();
+
+    domain.collect();
+    HPX_TEST_EQ(domain.retired(), static_cast<std::size_t>(0));
+    HPX_TEST_EQ(destroyed_objects.load(),
+        static_cast<std::size_t>(num_tasks * num_objects));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Count the nodes allocated by the data structures.
+std::atomic<std::ptrdiff_t> allocated_nodes(0);
+
+template <typename T>
+struct counting_allocator : std::allocator<T>
+{
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = counting_allocator<U>;
+    };
+
+    counting_allocator() = default;
+
+    template <typename U>
+    explicit counting_allocator(counting_allocator<U> const&) noexcept
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        allocated_nodes += static_cast<std::ptrdiff_t>(n);
+        return std::allocator<T>::allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        allocated_nodes -= static_cast<std::ptrdiff_t>(n);
+        std::allocator<T>::deallocate(p, n);
+    }
+};
+
+template <typename Stack>
+void push_and_pop_burst(Stack& stk, long count)
+{
+    for (long i = 0; i != count; ++i)
+    {
+        stk.push(i);
+    }
+
+    long out;
+    while (stk.pop(out))
+    {
+    }
+}
+
+void test_stack_releases_nodes()
+{
+    constexpr long burst = 10000;
+
+    // nodes are kept by the default stack
+    {
+        hpx::lockfree::stack<long, counting_allocator<long>> stk(16);
+        push_and_pop_burst(stk, burst);
+        HPX_TEST_EQ(allocated_nodes.load(), static_cast<std::ptrdiff_t>(burst));
+    }
+    HPX_TEST_EQ(allocated_nodes.load(), static_cast<std::ptrdiff_t>(0));
+
+    // only the reserved nodes (and a small number of retired nodes) are
+    // kept if reclamation is enabled
+    {
+        hpx::lockfree::stack<long, counting_allocator<long>, 0, false, true>
+            stk(16);
+        push_and_pop_burst(stk, burst);
+        HPX_TEST_LT(allocated_nodes.load(), burst / 10);
+
+        // unsynchronized operations release the nodes immediately
+        for (long i = 0; i != burst; ++i)
+        {
+            stk.unsynchronized_push(i);
+        }
+
+        long out;
+        while (stk.unsynchronized_pop(out))
+        {
+        }
+        HPX_TEST_LT(allocated_nodes.load(), burst / 10);
+    }
+    HPX_TEST_EQ(allocated_nodes.load(), static_cast<std::ptrdiff_t>(0));
+}
+
+void test_queue_releases_nodes()
+{
+    constexpr long burst = 10000;
+
+    {
+        hpx::lockfree::queue<long, counting_allocator<long>, 0, false, true> q(
+            16);
+        push_and_pop_burst(q, burst);
+        HPX_TEST_LT(allocated_nodes.load(), burst / 10);
+    }
+    HPX_TEST_EQ(allocated_nodes.load(), static_cast<std::ptrdiff_t>(0));
+}
+
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+void test_deque_releases_nodes()
+{
+    constexpr long burst = 10000;
+
+    {
+        hpx::lockfree::deque<long, hpx::lockfree::reclaiming_freelist_t,
+            counting_allocator<long>>
+            dq(16);
+
+        for (long i = 0; i != burst; ++i)
+        {
+            HPX_TEST(i % 2 ? dq.push_left(i) : dq.push_right(i));
+        }
+
+        long out;
+        for (long i = 0; i != burst; ++i)
+        {
+            HPX_TEST(i % 2 ? dq.pop_left(out) : dq.pop_right(out));
+        }
+        HPX_TEST(dq.empty());
+        HPX_TEST_LT(allocated_nodes.load(), burst / 10);
+    }
+    HPX_TEST_EQ(allocated_nodes.load(), static_cast<std::ptrdiff_t>(0));
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+void test_stack_stress()
+{
+    using tester_type = queue_stress_tester<false>;
+    std::unique_ptr<tester_type> tester(new tester_type(4, 4));
+
+    hpx::lockfree::stack<long, std::allocator<long>, 0, false, true> stk(16);
+    tester->run(stk);
+}
+
+void test_queue_stress()
+{
+    using tester_type = queue_stress_tester<false>;
+    std::unique_ptr<tester_type> tester(new tester_type(4, 4));
+
+    hpx::lockfree::queue<long, std::allocator<long>, 0, false, true> q(16);
+    tester->run(q);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map&)
+{
+    test_guard_delays_destruction();
+    test_guard_across_suspension();
+
+    test_stack_releases_nodes();
+    test_queue_releases_nodes();
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+    test_deque_releases_nodes();
+#endif
+
+    test_stack_stress();
+    test_queue_stress();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char** argv)
+{
+    hpx::local::init(hpx_main, argc, argv);
+    return hpx::util::report_errors();
+}
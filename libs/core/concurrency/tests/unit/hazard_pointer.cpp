@@ -0,0 +1,140 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/init.hpp>
+#include <hpx/modules/algorithms.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> destroyed_objects(0);
+
+struct tracked_object
+{
+    static constexpr std::uint64_t alive = 0x600dcafe;
+
+    explicit tracked_object(std::uint64_t v)
+      : value(v)
+    {
+    }
+
+    ~tracked_object()
+    {
+        state = 0;
+        ++destroyed_objects;
+    }
+
+    std::uint64_t value;
+    std::uint64_t state = alive;
+};
+
+void test_protect()
+{
+    hpx::lockfree::hazard_pointer_domain domain;
+    destroyed_objects = 0;
+
+    std::atomic<tracked_object*> shared(new tracked_object(1));
+    {
+        hpx::lockfree::hazard_pointer hp(domain);
+        tracked_object* p = hp.protect(shared);
+        HPX_TEST_EQ(p->value, static_cast<std::uint64_t>(1));
+
+        // replace and retire the protected object
+        domain.retire(shared.exchange(new tracked_object(2)));
+        domain.collect();
+        HPX_TEST_EQ(destroyed_objects.load(), static_cast<std::size_t>(0));
+        HPX_TEST_EQ(p->state, tracked_object::alive);
+
+        // the object is destroyed once it is not protected anymore
+        hp.reset_protection();
+        domain.collect();
+        HPX_TEST_EQ(destroyed_objects.load(), static_cast<std::size_t>(1));
+        HPX_TEST_EQ(domain.retired(), static_cast<std::size_t>(0));
+    }
+
+    // the remaining objects are destroyed with the domain
+    domain.retire(shared.exchange(nullptr));
+    HPX_TEST_EQ(domain.retired(), static_cast<std::size_t>(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Readers protect the current object and access it while writers replace and
+// retire it. HPX threads may be suspended while protecting an object and may
+// be resumed on a different worker thread.
+void test_concurrent_replace()
+{
+    destroyed_objects = 0;
+
+    constexpr int num_readers = 8;
+    constexpr int num_writers = 4;
+    constexpr int num_iterations = 2000;
+
+    std::size_t created_objects = 1;
+    {
+        hpx::lockfree::hazard_pointer_domain domain;
+        std::atomic<tracked_object*> shared(new tracked_object(0));
+        std::atomic<int> invalid_reads(0);
+
+        hpx::experimental::task_group tasks;
+        for (int i = 0; i != num_readers; ++i)
+        {
+            tasks.run([&]() {
+                hpx::lockfree::hazard_pointer hp(domain);
+                for (int j = 0; j != num_iterations; ++j)
+                {
+                    tracked_object* p = hp.protect(shared);
+                    if (j % 16 == 0)
+                        hpx::this_thread::yield();
+                    if (p->state != tracked_object::alive)
+                        ++invalid_reads;
+                    hp.reset_protection();
+                }
+            });
+        }
+
+        for (int i = 0; i != num_writers; ++i)
+        {
+            tasks.run([&, i]() {
+                for (int j = 0; j != num_iterations; ++j)
+                {
+                    auto* p = new tracked_object(
+                        static_cast<std::uint64_t>(i * num_iterations + j));
+                    domain.retire(shared.exchange(p));
+                }
+            });
+        }
+        created_objects += num_writers * num_iterations;
+
+        tasks.wait();
+        HPX_TEST_EQ(invalid_reads.load(), 0);
+
+        domain.collect();
+        HPX_TEST_EQ(domain.retired(), static_cast<std::size_t>(0));
+
+        delete shared.load();
+    }
+    HPX_TEST_EQ(destroyed_objects.load(), created_objects);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map&)
+{
+    test_protect();
+    test_concurrent_replace();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char** argv)
+{
+    hpx::local::init(hpx_main, argc, argv);
+    return hpx::util::report_errors();
+}
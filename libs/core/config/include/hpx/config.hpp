@@ -443,4 +443,10 @@
 #define HPX_HAVE_MAX_CPU_COUNT 64
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Size of the inline buffer used to store the function of an HPX thread
+#if !defined(HPX_HAVE_THREAD_FUNCTION_STORAGE_SIZE)
+#define HPX_HAVE_THREAD_FUNCTION_STORAGE_SIZE 64
+#endif
+
 // clang-format on
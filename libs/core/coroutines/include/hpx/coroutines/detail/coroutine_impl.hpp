@@ -36,6 +36,7 @@
 #include <hpx/coroutines/detail/context_base.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/coroutines/thread_id_type.hpp>
+#include <hpx/functional/inplace_move_only_function.hpp>
 #include <hpx/functional/move_only_function.hpp>
 
 #include <cstddef>
@@ -60,7 +61,8 @@ namespace hpx::threads::coroutines::detail {
         using result_type = std::pair<thread_schedule_state, thread_id_type>;
         using arg_type = thread_restart_state;
 
-        using functor_type = hpx::move_only_function<result_type(arg_type)>;
+        using functor_type = hpx::util::small_move_only_function<
+            result_type(arg_type), HPX_HAVE_THREAD_FUNCTION_STORAGE_SIZE>;
 
         coroutine_impl(functor_type&& f, thread_id_type id,
             std::ptrdiff_t stack_size) noexcept
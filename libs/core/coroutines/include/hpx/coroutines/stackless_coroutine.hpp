@@ -15,6 +15,7 @@
 #include <hpx/coroutines/thread_id_type.hpp>
 #include <hpx/functional/detail/reset_function.hpp>
 #include <hpx/functional/experimental/scope_exit.hpp>
+#include <hpx/functional/inplace_move_only_function.hpp>
 #include <hpx/functional/move_only_function.hpp>
 #if defined(HPX_HAVE_THREAD_LOCAL_STORAGE)
 #include <hpx/coroutines/detail/tss.hpp>
@@ -57,7 +58,8 @@ namespace hpx::threads::coroutines {
         using result_type = std::pair<thread_schedule_state, thread_id_type>;
         using arg_type = thread_restart_state;
 
-        using functor_type = hpx::move_only_function<result_type(arg_type)>;
+        using functor_type = hpx::util::small_move_only_function<
+            result_type(arg_type), HPX_HAVE_THREAD_FUNCTION_STORAGE_SIZE>;
 
         stackless_coroutine(functor_type&& f, thread_id_type id,
             std::ptrdiff_t /*stack_size*/ = default_stack_size) noexcept
@@ -249,7 +249,13 @@ namespace hpx::threads {
         /// on a breadth-first basis (i.e. consecutively scheduled threads are
         /// placed on the neighboring cores). Threads are being scheduled in
         /// reverse order.
-        breadth_first_reverse = 6
+        breadth_first_reverse = 6,
+
+        /// A hint that tells bulk executors to spawn their worker threads
+        /// along the machine topology (grouped by NUMA domain and L3 cache)
+        /// instead of launching all of them from the calling thread. The work
+        /// is distributed as for depth_first.
+        topology_aware = 8
     };
 
     ///////////////////////////////////////////////////////////////////////////
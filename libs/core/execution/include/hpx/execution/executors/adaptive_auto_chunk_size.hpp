@@ -0,0 +1,186 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/adaptive_auto_chunk_size.hpp
+/// \page hpx::execution::experimental::adaptive_auto_chunk_size
+/// \headerfile hpx/execution.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace hpx::execution::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces and then assigned to threads.
+    /// The number of loop iterations combined is determined by timing the
+    /// first loop iterations on the calling thread: starting with a single
+    /// iteration, the number of timed iterations is doubled until the
+    /// measurement is long enough to be meaningful. The remaining iterations
+    /// are combined such that each chunk runs for (approximately) the
+    /// specified amount of time.
+    ///
+    /// Inexpensive loop bodies are combined into at most one chunk per core,
+    /// which minimizes the scheduling overhead. Expensive loop bodies are
+    /// split into many small chunks, which allows to balance irregular
+    /// workloads.
+    ///
+    struct adaptive_auto_chunk_size
+    {
+    public:
+        /// Construct an \a adaptive_auto_chunk_size executor parameters object
+        ///
+        /// \note Default constructed \a adaptive_auto_chunk_size executor
+        ///       parameter types will use 200 microseconds as the time for
+        ///       which any of the scheduled chunks should run.
+        ///
+        constexpr adaptive_auto_chunk_size() noexcept
+          : chunk_time_(200000)
+        {
+        }
+
+        /// Construct an \a adaptive_auto_chunk_size executor parameters object
+        ///
+        /// \param rel_time     [in] The time duration any of the scheduled
+        ///                     chunks should run for.
+        ///
+        explicit adaptive_auto_chunk_size(
+            hpx::chrono::steady_duration const& rel_time) noexcept
+          : chunk_time_(static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    rel_time.value())
+                    .count()))
+        {
+        }
+
+        /// \cond NOINTERNAL
+        // This executor parameters type synchronously invokes the provided
+        // testing function in order to approximate the chunk-size.
+        using invokes_testing_function = std::true_type;
+
+        // Estimate execution time for one iteration
+        template <typename Executor, typename F>
+        friend std::chrono::nanoseconds tag_override_invoke(
+            hpx::execution::experimental::measure_iteration_t,
+            adaptive_auto_chunk_size const& this_, Executor&&, F&& f,
+            std::size_t count)
+        {
+            // A measurement is considered meaningful if it runs for at least
+            // a tenth of the targeted chunk time. Don't time more than a small
+            // fraction of all iterations as this runs sequentially.
+            std::uint64_t const min_measurement = this_.chunk_time_ / 10;
+            std::size_t const max_iterations = (std::max)(
+                static_cast<std::size_t>(1), count / max_measured_fraction);
+
+            using hpx::chrono::high_resolution_clock;
+
+            std::size_t measured = 0;
+            std::uint64_t elapsed = 0;
+            for (std::size_t n = 1; measured < max_iterations; n *= 2)
+            {
+                std::uint64_t const t = high_resolution_clock::now();
+
+                std::size_t const test_chunk_size =
+                    f((std::min)(n, max_iterations - measured));
+                if (test_chunk_size == 0)
+                {
+                    break;
+                }
+
+                elapsed += high_resolution_clock::now() - t;
+                measured += test_chunk_size;
+
+                if (elapsed >= min_measurement)
+                {
+                    break;
+                }
+            }
+
+            if (measured == 0)
+            {
+                return std::chrono::nanoseconds(0);
+            }
+
+            // return execution time for one iteration, at least 1ns
+            return std::chrono::nanoseconds(
+                (std::max)(elapsed / measured, static_cast<std::uint64_t>(1)));
+        }
+
+        // Estimate a chunk size based on the measured iteration time.
+        template <typename Executor>
+        friend std::size_t tag_override_invoke(
+            hpx::execution::experimental::get_chunk_size_t,
+            adaptive_auto_chunk_size const& this_, Executor&&,
+            hpx::chrono::steady_duration const& iteration_duration,
+            std::size_t cores, std::size_t count) noexcept
+        {
+            if (cores == 0)
+            {
+                cores = 1;
+            }
+
+            // no measurement available, create 4 chunks per core
+            auto const ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                iteration_duration.value())
+                                .count();
+            if (ns <= 0)
+            {
+                return (std::max)(static_cast<std::size_t>(1),
+                    (count + 4 * cores - 1) / (4 * cores));
+            }
+
+            // combine as many iterations as needed to run for the targeted
+            // time, but don't create fewer chunks than there are cores
+            std::size_t const chunk_size = static_cast<std::size_t>(
+                this_.chunk_time_ / static_cast<std::uint64_t>(ns));
+            return (std::clamp)(chunk_size, static_cast<std::size_t>(1),
+                (std::max)(static_cast<std::size_t>(1),
+                    (count + cores - 1) / cores));
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const /* version */)
+        {
+            // clang-format off
+            ar & chunk_time_;
+            // clang-format on
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        // at most 1/max_measured_fraction of all iterations are timed
+        static constexpr std::size_t max_measured_fraction = 64;
+
+        // target time for one chunk (nanoseconds)
+        std::uint64_t chunk_time_;
+        /// \endcond
+    };
+
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<
+        hpx::execution::experimental::adaptive_auto_chunk_size> : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace hpx::execution::experimental
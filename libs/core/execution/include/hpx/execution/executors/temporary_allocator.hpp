@@ -0,0 +1,82 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/concepts/has_member_xxx.hpp>
+#include <hpx/execution_base/traits/is_executor.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::execution::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        // define member traits
+        HPX_HAS_MEMBER_XXX_TRAIT_DEF(get_temporary_allocator)
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Retrieve the allocator the parallel algorithms should use for their
+    /// temporary data (scratch buffers) if they are run on the given
+    /// executor.
+    ///
+    /// \param exec  [in] The executor object to use to extract the
+    ///              requested information for.
+    ///
+    /// \note Executors that place their tasks onto specific NUMA domains
+    ///       return an allocator that does not touch the allocated memory,
+    ///       leaving it to the tasks that use the memory to place its pages
+    ///       (first touch). The algorithms rebind the returned allocator to
+    ///       the value type they need to store.
+    ///
+    /// \note If the executor does not expose this information, this call
+    ///       will return a std::allocator.
+    ///
+    inline constexpr struct get_temporary_allocator_t final
+      : hpx::functional::detail::tag_fallback<get_temporary_allocator_t>
+    {
+    private:
+        // clang-format off
+        template <typename Executor,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_executor_any_v<Executor>
+            )>
+        // clang-format on
+        friend HPX_FORCEINLINE decltype(auto) tag_fallback_invoke(
+            get_temporary_allocator_t, Executor&& /*exec*/) noexcept
+        {
+            return std::allocator<char>{};
+        }
+
+        // clang-format off
+        template <typename Executor,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_executor_any_v<Executor> &&
+                detail::has_get_temporary_allocator_v<Executor>
+            )>
+        // clang-format on
+        friend HPX_FORCEINLINE decltype(auto) tag_invoke(
+            get_temporary_allocator_t, Executor&& exec)
+        {
+            return HPX_FORWARD(Executor, exec).get_temporary_allocator();
+        }
+    } get_temporary_allocator{};
+
+    /// The type of the allocator for objects of type \a T returned by
+    /// get_temporary_allocator for the given executor type.
+    template <typename Executor, typename T>
+    using temporary_allocator_t =
+        typename std::allocator_traits<std::decay_t<decltype(
+            get_temporary_allocator(std::declval<Executor>()))>>::
+            template rebind_alloc<T>;
+}    // namespace hpx::execution::experimental
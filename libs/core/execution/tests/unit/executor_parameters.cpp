@@ -122,6 +122,20 @@ void test_auto_chunk_size()
     }
 }
 
+void test_adaptive_auto_chunk_size()
+{
+    {
+        hpx::execution::experimental::adaptive_auto_chunk_size aacs;
+        parameters_test(aacs);
+    }
+
+    {
+        hpx::execution::experimental::adaptive_auto_chunk_size aacs(
+            std::chrono::microseconds(10));
+        parameters_test(aacs);
+    }
+}
+
 void test_persistent_auto_chunk_size()
 {
     {
@@ -217,6 +231,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_adaptive_static_chunk_size();
     test_guided_chunk_size();
     test_auto_chunk_size();
+    test_adaptive_auto_chunk_size();
     test_persistent_auto_chunk_size();
     test_num_cores();
 
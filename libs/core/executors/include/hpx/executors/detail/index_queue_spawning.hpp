@@ -27,6 +27,7 @@
 #include <hpx/resource_partitioner/detail/partitioner.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #include <hpx/topology/cpu_mask.hpp>
+#include <hpx/topology/topology.hpp>
 #include <hpx/type_support/pack.hpp>
 
 #include <algorithm>
@@ -34,6 +35,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <new>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -362,6 +364,171 @@ namespace hpx::parallel::execution::detail {
             }
         }
 
+        struct spawn_parameters
+        {
+            std::uint32_t size;
+            std::uint32_t chunk_size;
+            bool needs_wraparound;
+            bool reverse_placement;
+            bool allow_stealing;
+        };
+
+        struct topology_worker
+        {
+            std::size_t numa_node;
+            std::size_t l3_cache;
+            std::uint32_t worker_thread;
+        };
+
+        enum class topology_level
+        {
+            numa_node,
+            l3_cache,
+            worker
+        };
+
+        // Spawn the task for one worker thread, report errors through the
+        // shared state.
+        void spawn_worker(hpx::threads::thread_description const& desc,
+            threads::thread_pool_base* pool, spawn_parameters const& params,
+            std::uint32_t const worker_thread)
+        {
+            task_function<index_queue_bulk_state> task{
+                hpx::intrusive_ptr<index_queue_bulk_state>(this), params.size,
+                params.chunk_size, worker_thread, params.reverse_placement,
+                params.allow_stealing};
+
+            try
+            {
+                do_work_task(
+                    desc, pool, false, params.needs_wraparound, task);
+            }
+            catch (std::bad_alloc const&)
+            {
+                bad_alloc_thrown = true;
+                task.finish();
+            }
+            catch (...)
+            {
+                task.store_exception(std::current_exception());
+                task.finish();
+            }
+        }
+
+        // Spawn the worker tasks for the given (sorted) sequence of worker
+        // threads. On each topology level one task per group of worker
+        // threads is launched (on the first core of the group), which in turn
+        // spawns the tasks for the next level. Levels that consist of a single
+        // group are handled directly by the current task.
+        void spawn_topology_level(hpx::threads::thread_description const& desc,
+            threads::thread_pool_base* pool, spawn_parameters const& params,
+            std::vector<topology_worker> const& workers,
+            topology_level const level)
+        {
+            if (level == topology_level::worker)
+            {
+                for (topology_worker const& w : workers)
+                {
+                    spawn_worker(desc, pool, params, w.worker_thread);
+                }
+                return;
+            }
+
+            auto const group = [level](topology_worker const& w) {
+                return level == topology_level::numa_node ? w.numa_node :
+                                                            w.l3_cache;
+            };
+            topology_level const next_level =
+                level == topology_level::numa_node ? topology_level::l3_cache :
+                                                     topology_level::worker;
+
+            if (group(workers.front()) == group(workers.back()))
+            {
+                spawn_topology_level(desc, pool, params, workers, next_level);
+                return;
+            }
+
+            auto post_policy = hpx::execution::experimental::with_stacksize(
+                policy, threads::thread_stacksize::small_);
+
+            auto it = workers.begin();
+            while (it != workers.end())
+            {
+                auto const group_end = std::find_if(it, workers.end(),
+                    [&](topology_worker const& w) {
+                        return group(w) != group(*it);
+                    });
+
+                std::vector<topology_worker> group_workers(it, group_end);
+                it = group_end;
+
+                // launch the spawning task on the first core of the group
+                hpx::threads::thread_schedule_hint const hint(
+                    static_cast<std::int16_t>(
+                        wrapped_pu_num(group_workers.front().worker_thread,
+                            params.needs_wraparound) +
+                        first_thread));
+
+                try
+                {
+                    hpx::detail::post_policy_dispatch<Launch>::call(
+                        hpx::execution::experimental::with_hint(
+                            post_policy, hint),
+                        desc, pool,
+                        [state = hpx::intrusive_ptr<index_queue_bulk_state>(
+                             this),
+                            desc, pool, params, next_level,
+                            group_workers]() {
+                            state->spawn_topology_level(
+                                desc, pool, params, group_workers, next_level);
+                        });
+                }
+                catch (...)
+                {
+                    // fall back to spawning the group directly
+                    spawn_topology_level(
+                        desc, pool, params, group_workers, next_level);
+                }
+            }
+        }
+
+        void spawn_topology_aware(hpx::threads::thread_description const& desc,
+            threads::thread_pool_base* pool, spawn_parameters const& params,
+            std::vector<std::uint32_t> const& worker_threads)
+        {
+            if (worker_threads.empty())
+            {
+                return;
+            }
+
+            auto const& rp = hpx::resource::get_partitioner();
+            auto const& topo = hpx::threads::create_topology();
+
+            std::vector<topology_worker> workers;
+            workers.reserve(worker_threads.size());
+            for (std::uint32_t const worker_thread : worker_threads)
+            {
+                std::size_t const pu_num = rp.get_pu_num(
+                    wrapped_pu_num(worker_thread, params.needs_wraparound) +
+                    first_thread);    //-V106
+                workers.push_back(topology_worker{
+                    topo.get_numa_node_number(pu_num),
+                    topo.get_l3_cache_number(pu_num), worker_thread});
+            }
+
+            // keep the order of the worker threads inside of each group, this
+            // keeps consecutive chunks on neighboring cores
+            std::stable_sort(workers.begin(), workers.end(),
+                [](topology_worker const& lhs, topology_worker const& rhs) {
+                    return lhs.numa_node < rhs.numa_node ||
+                        (lhs.numa_node == rhs.numa_node &&
+                            lhs.l3_cache < rhs.l3_cache);
+                });
+
+            spawn_topology_level(
+                desc, pool, params, workers, topology_level::numa_node);
+        }
+
     public:
         template <typename F_, typename... Ts_>
         index_queue_bulk_state(std::size_t const first_thread_,
@@ -460,6 +627,21 @@ namespace hpx::parallel::execution::detail {
             bool const allow_stealing =
                 !hpx::threads::do_not_share_function(hint.sharing_mode());
 
+            // Distribute the spawning of the worker tasks along the machine
+            // topology instead of launching all of them from this thread, if
+            // requested. This is done only if no explicit thread was given, as
+            // otherwise all tasks end up on the same core anyways.
+            bool const topology_aware_spawning =
+                hint.placement_mode() == placement::topology_aware &&
+                hint.mode == hpx::threads::thread_schedule_hint_mode::none &&
+                hint.hint == -1;
+
+            std::vector<std::uint32_t> topology_worker_threads;
+            if (topology_aware_spawning)
+            {
+                topology_worker_threads.reserve(num_threads);
+            }
+
             // clang-format off
             for (std::uint32_t pu = 0;
                 worker_thread != num_threads && pu != num_pus; ++pu)
@@ -485,8 +667,10 @@ namespace hpx::parallel::execution::detail {
                     continue;
                 }
 
-                // don't double-book core that runs main thread
-                if (main_thread_ok && main_pu_num == pu_num)
+                // don't double-book core that runs main thread, unless there
+                // are more worker threads than cores anyways
+                if (main_thread_ok && !needs_wraparound &&
+                    main_pu_num == pu_num)
                 {
                     continue;
                 }
@@ -498,11 +682,18 @@ namespace hpx::parallel::execution::detail {
                 }
 
                 // Schedule task for this worker thread
-                do_work_task(desc, pool, false, needs_wraparound,
-                    task_function<index_queue_bulk_state>{
-                        hpx::intrusive_ptr<index_queue_bulk_state>(this), size,
-                        chunk_size, worker_thread, reverse_placement,
-                        allow_stealing});
+                if (topology_aware_spawning)
+                {
+                    topology_worker_threads.push_back(worker_thread);
+                }
+                else
+                {
+                    do_work_task(desc, pool, false, needs_wraparound,
+                        task_function<index_queue_bulk_state>{
+                            hpx::intrusive_ptr<index_queue_bulk_state>(this),
+                            size, chunk_size, worker_thread, reverse_placement,
+                            allow_stealing});
+                }
 
                 ++worker_thread;
             }
@@ -511,6 +702,14 @@ namespace hpx::parallel::execution::detail {
             // the PU-mask
             HPX_ASSERT(worker_thread == num_threads);
 
+            if (topology_aware_spawning)
+            {
+                spawn_topology_aware(desc, pool,
+                    spawn_parameters{size, chunk_size, needs_wraparound,
+                        reverse_placement, allow_stealing},
+                    topology_worker_threads);
+            }
+
             // the main thread should have been associated with a queue
             if (main_thread_ok)
             {
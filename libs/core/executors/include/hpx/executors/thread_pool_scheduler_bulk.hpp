@@ -28,6 +28,8 @@
 #include <hpx/execution_base/completion_signatures.hpp>
 #include <hpx/execution_base/receiver.hpp>
 #include <hpx/execution_base/sender.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/executors/sequenced_executor.hpp>
 #include <hpx/executors/thread_pool_scheduler.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/functional/detail/tag_fallback_invoke.hpp>
@@ -144,10 +146,19 @@ namespace hpx::execution::experimental::detail {
 #endif
             using index_pack_type = hpx::detail::fused_index_pack_t<Ts>;
 
-            auto const i_begin =
-                static_cast<std::size_t>(index) * task_f->chunk_size;
-            auto const i_end =
-                (std::min)(i_begin + task_f->chunk_size, task_f->size);
+            std::size_t i_begin;
+            std::size_t i_end;
+            if constexpr (OperationState::has_parameters)
+            {
+                // the chunks were computed from the execution parameters
+                i_begin = op_state->chunk_offsets[index];
+                i_end = op_state->chunk_offsets[index + 1];
+            }
+            else
+            {
+                i_begin = static_cast<std::size_t>(index) * task_f->chunk_size;
+                i_end = (std::min)(i_begin + task_f->chunk_size, task_f->size);
+            }
 
             auto it = std::next(hpx::util::begin(op_state->shape), i_begin);
             for (std::uint32_t i = i_begin; i != i_end; (void) ++it, ++i)
@@ -444,6 +455,110 @@ namespace hpx::execution::experimental::detail {
             }
         }
 
+        // Sequentially run the iterations [first, last) on the calling thread.
+        void run_iterations(std::size_t first, std::size_t last) const
+        {
+            hpx::visit(
+                [&](auto& ts) {
+                    using values_type = std::decay_t<decltype(ts)>;
+                    if constexpr (!std::is_same_v<values_type, hpx::monostate>)
+                    {
+                        using index_pack_type =
+                            hpx::detail::fused_index_pack_t<values_type>;
+
+                        auto it = std::next(
+                            hpx::util::begin(op_state->shape), first);
+                        for (std::size_t i = first; i != last; (void) ++it, ++i)
+                        {
+                            bulk_scheduler_invoke_helper(
+                                index_pack_type{}, op_state->f, *it, ts);
+                        }
+                    }
+                },
+                op_state->ts);
+        }
+
+        // Split the iterations into chunks as requested by the execution
+        // parameters. Parameters which measure the execution time of the
+        // iterations run the first iterations on the calling thread, the
+        // remaining iterations are split into chunks. Returns the number of
+        // chunks.
+        std::uint32_t init_chunks_from_parameters(std::uint32_t const size)
+        {
+            namespace ex = hpx::execution::experimental;
+
+            auto& params = op_state->params;
+            using parameters_type = std::decay_t<decltype(params)>;
+
+            // the parameters are invoked as if the iterations were run by a
+            // sequenced executor, i.e. any measurements are performed inline
+            hpx::execution::sequenced_executor exec;
+
+            std::size_t first = 0;
+            auto test_function = [&](std::size_t test_chunk_size) {
+                test_chunk_size = (std::min)(test_chunk_size, size - first);
+                run_iterations(first, first + test_chunk_size);
+                first += test_chunk_size;
+                return test_chunk_size;
+            };
+
+            auto const iteration_duration =
+                ex::measure_iteration(params, exec, test_function, size);
+
+            std::size_t const cores = op_state->num_worker_threads;
+            std::size_t remaining = size - first;
+
+            auto& offsets = op_state->chunk_offsets;
+            offsets.clear();
+            offsets.push_back(static_cast<std::uint32_t>(first));
+
+            auto const next_chunk_size = [&](std::size_t count) {
+                std::size_t const chunk_size = ex::get_chunk_size(
+                    params, exec, iteration_duration, cores, count);
+                if (chunk_size == 0)
+                {
+                    return static_cast<std::size_t>(
+                        get_bulk_scheduler_chunk_size(
+                            static_cast<std::uint32_t>(cores), count));
+                }
+                return (std::min)(chunk_size, count);
+            };
+
+            if constexpr (ex::extract_has_variable_chunk_size_v<
+                              parameters_type>)
+            {
+                // the parameters are asked for the size of each chunk
+                while (remaining != 0)
+                {
+                    std::size_t const chunk_size = next_chunk_size(remaining);
+                    offsets.push_back(
+                        static_cast<std::uint32_t>(offsets.back() + chunk_size));
+                    remaining -= chunk_size;
+                }
+            }
+            else if (remaining != 0)
+            {
+                std::size_t chunk_size = next_chunk_size(remaining);
+
+                std::size_t const max_chunks = ex::maximal_number_of_chunks(
+                    params, exec, cores, remaining);
+                if (max_chunks != 0 &&
+                    (remaining + chunk_size - 1) / chunk_size > max_chunks)
+                {
+                    chunk_size = (remaining + max_chunks - 1) / max_chunks;
+                }
+
+                for (std::size_t i = first + chunk_size; i < size;
+                     i += chunk_size)
+                {
+                    offsets.push_back(static_cast<std::uint32_t>(i));
+                }
+                offsets.push_back(size);
+            }
+
+            return static_cast<std::uint32_t>(offsets.size() - 1);
+        }
+
         using range_value_type =
             hpx::traits::iter_value_t<hpx::traits::range_iterator_t<Shape>>;
 
@@ -460,10 +575,31 @@ namespace hpx::execution::experimental::detail {
                 return;
             }
 
+            // Store sent values in the operation state
+            op_state->ts.template emplace<hpx::tuple<Ts...>>(
+                HPX_FORWARD(Ts, ts)...);
+
             // Calculate chunk size and number of chunks
-            std::uint32_t chunk_size = get_bulk_scheduler_chunk_size(
-                op_state->num_worker_threads, size);
-            std::uint32_t num_chunks = (size + chunk_size - 1) / chunk_size;
+            std::uint32_t chunk_size = 0;
+            std::uint32_t num_chunks = 0;
+            if constexpr (OperationState::has_parameters)
+            {
+                num_chunks = init_chunks_from_parameters(size);
+                if (num_chunks == 0)
+                {
+                    // all iterations were run while measuring
+                    auto visitor =
+                        set_value_end_loop_visitor<OperationState>{op_state};
+                    hpx::visit(HPX_MOVE(visitor), HPX_MOVE(op_state->ts));
+                    return;
+                }
+            }
+            else
+            {
+                chunk_size = get_bulk_scheduler_chunk_size(
+                    op_state->num_worker_threads, size);
+                num_chunks = (size + chunk_size - 1) / chunk_size;
+            }
 
             // launch only as many tasks as we have chunks
             std::size_t const num_pus = op_state->num_worker_threads;
@@ -479,10 +615,6 @@ namespace hpx::execution::experimental::detail {
             HPX_ASSERT(hpx::threads::count(op_state->pu_mask) ==
                 op_state->num_worker_threads);
 
-            // Store sent values in the operation state
-            op_state->ts.template emplace<hpx::tuple<Ts...>>(
-                HPX_FORWARD(Ts, ts)...);
-
             // thread placement
             hpx::threads::thread_schedule_hint const hint =
                 hpx::execution::experimental::get_hint(op_state->scheduler);
@@ -619,7 +751,13 @@ namespace hpx::execution::experimental::detail {
     // in this file is not chosen) it will be reused as one of the worker
     // threads.
     //
-    template <typename Policy, typename Sender, typename Shape, typename F>
+    // If execution parameters are given, those are used to determine the
+    // chunk sizes instead. Parameters measuring the execution time of the
+    // iterations (e.g. auto_chunk_size) run the first iterations on the
+    // thread that calls set_value before the remaining chunks are scheduled.
+    //
+    template <typename Policy, typename Sender, typename Shape, typename F,
+        typename Parameters = hpx::execution::experimental::null_parameters_t>
     class thread_pool_bulk_sender
     {
     private:
@@ -628,6 +766,7 @@ namespace hpx::execution::experimental::detail {
         HPX_NO_UNIQUE_ADDRESS std::decay_t<Shape> shape;
         HPX_NO_UNIQUE_ADDRESS std::decay_t<F> f;
         hpx::threads::mask_type pu_mask;
+        HPX_NO_UNIQUE_ADDRESS std::decay_t<Parameters> params;
 
     public:
         template <typename Sender_, typename Shape_, typename F_>
@@ -657,6 +796,29 @@ namespace hpx::execution::experimental::detail {
         {
         }
 
+        // clang-format off
+        template <typename Sender_, typename Shape_, typename F_,
+            typename Parameters_,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_executor_parameters_v<
+                    std::decay_t<Parameters_>>
+            )>
+        // clang-format on
+        thread_pool_bulk_sender(thread_pool_policy_scheduler<Policy>&& sched,
+            Sender_&& sender, Shape_&& shape, F_&& f, Parameters_&& params)
+          : scheduler(HPX_MOVE(sched))
+          , sender(HPX_FORWARD(Sender_, sender))
+          , shape(HPX_FORWARD(Shape_, shape))
+          , f(HPX_FORWARD(F_, f))
+          , pu_mask(detail::full_mask(
+                hpx::execution::experimental::get_first_core(scheduler),
+                hpx::execution::experimental::processing_units_count(
+                    hpx::execution::experimental::null_parameters, scheduler,
+                    hpx::chrono::null_duration, 0)))
+          , params(HPX_FORWARD(Parameters_, params))
+        {
+        }
+
         thread_pool_bulk_sender(thread_pool_bulk_sender&&) = default;
         thread_pool_bulk_sender(thread_pool_bulk_sender const&) = default;
         thread_pool_bulk_sender& operator=(thread_pool_bulk_sender&&) = default;
@@ -769,6 +931,10 @@ namespace hpx::execution::experimental::detail {
         template <typename Receiver>
         struct operation_state
         {
+            static constexpr bool has_parameters = !std::is_same_v<
+                std::decay_t<Parameters>,
+                hpx::execution::experimental::null_parameters_t>;
+
             using operation_state_type =
                 hpx::execution::experimental::connect_result_t<Sender,
                     bulk_receiver<operation_state, F, Shape>>;
@@ -793,11 +959,17 @@ namespace hpx::execution::experimental::detail {
             std::atomic<bool> bad_alloc_thrown{false};
             hpx::exception_list exceptions;
 
+            HPX_NO_UNIQUE_ADDRESS std::decay_t<Parameters> params;
+
+            // the first iteration of each chunk followed by the end of the
+            // last chunk, used only if execution parameters are given
+            std::vector<std::uint32_t> chunk_offsets;
+
             template <typename Scheduler_, typename Sender_, typename Shape_,
-                typename F_, typename Receiver_>
+                typename F_, typename Receiver_, typename Parameters_>
             operation_state(Scheduler_&& scheduler, Sender_&& sender,
                 Shape_&& shape, F_&& f, hpx::threads::mask_type pumask,
-                Receiver_&& receiver)
+                Receiver_&& receiver, Parameters_&& params)
               : scheduler(HPX_FORWARD(Scheduler_, scheduler))
               , op_state(hpx::execution::experimental::connect(
                     HPX_FORWARD(Sender_, sender),
@@ -813,6 +985,7 @@ namespace hpx::execution::experimental::detail {
               , shape(HPX_FORWARD(Shape_, shape))
               , f(HPX_FORWARD(F_, f))
               , receiver(HPX_FORWARD(Receiver_, receiver))
+              , params(HPX_FORWARD(Parameters_, params))
             {
                 tasks_remaining.data_.store(
                     num_worker_threads, std::memory_order_relaxed);
@@ -833,7 +1006,7 @@ namespace hpx::execution::experimental::detail {
             return operation_state<std::decay_t<Receiver>>{
                 HPX_MOVE(s.scheduler), HPX_MOVE(s.sender), HPX_MOVE(s.shape),
                 HPX_MOVE(s.f), HPX_MOVE(s.pu_mask),
-                HPX_FORWARD(Receiver, receiver)};
+                HPX_FORWARD(Receiver, receiver), HPX_MOVE(s.params)};
         }
 
         template <typename Receiver>
@@ -842,7 +1015,7 @@ namespace hpx::execution::experimental::detail {
         {
             return operation_state<std::decay_t<Receiver>>{s.scheduler,
                 s.sender, s.shape, s.f, s.pu_mask,
-                HPX_FORWARD(Receiver, receiver)};
+                HPX_FORWARD(Receiver, receiver), s.params};
         }
     };
 }    // namespace hpx::execution::experimental::detail
@@ -904,4 +1077,94 @@ namespace hpx::execution::experimental {
                 HPX_FORWARD(F, f)};
         }
     }
+
+    // Bulk customizations accepting execution parameters which control how
+    // the iterations are split into chunks, e.g.:
+    //
+    //     bulk(schedule(sched), auto_chunk_size(), n, f)
+    //
+    // clang-format off
+    template <typename Policy, typename Sender, typename Parameters,
+        typename Shape, typename F,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_executor_parameters_v<std::decay_t<Parameters>> &&
+            !std::is_integral_v<Shape>
+        )>
+    // clang-format on
+    constexpr auto tag_invoke(bulk_t,
+        thread_pool_policy_scheduler<Policy> scheduler, Sender&& sender,
+        Parameters&& params, Shape const& shape, F&& f)
+    {
+        if constexpr (std::is_same_v<Policy, launch::sync_policy>)
+        {
+            // fall back to non-bulk scheduling if sync execution was requested
+            return detail::bulk_sender<Sender, Shape, F>{
+                HPX_FORWARD(Sender, sender), shape, HPX_FORWARD(F, f)};
+        }
+        else
+        {
+            return detail::thread_pool_bulk_sender<Policy, Sender, Shape, F,
+                std::decay_t<Parameters>>{HPX_MOVE(scheduler),
+                HPX_FORWARD(Sender, sender), shape, HPX_FORWARD(F, f),
+                HPX_FORWARD(Parameters, params)};
+        }
+    }
+
+    // clang-format off
+    template <typename Policy, typename Sender, typename Parameters,
+        typename Count, typename F,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_executor_parameters_v<std::decay_t<Parameters>> &&
+            std::is_integral_v<Count>
+        )>
+    // clang-format on
+    constexpr decltype(auto) tag_invoke(bulk_t,
+        thread_pool_policy_scheduler<Policy> scheduler, Sender&& sender,
+        Parameters&& params, Count const& count, F&& f)
+    {
+        if constexpr (std::is_same_v<Policy, launch::sync_policy>)
+        {
+            // fall back to non-bulk scheduling if sync execution was requested
+            return tag_invoke(bulk_t{}, HPX_MOVE(scheduler),
+                HPX_FORWARD(Sender, sender), count, HPX_FORWARD(F, f));
+        }
+        else
+        {
+            return detail::thread_pool_bulk_sender<Policy, Sender,
+                hpx::util::counting_shape<Count>, F, std::decay_t<Parameters>>{
+                HPX_MOVE(scheduler), HPX_FORWARD(Sender, sender),
+                hpx::util::counting_shape(count), HPX_FORWARD(F, f),
+                HPX_FORWARD(Parameters, params)};
+        }
+    }
+
+#if !defined(HPX_HAVE_STDEXEC)
+    // Allow for execution parameters to be passed to bulk for senders that
+    // complete on a thread_pool_scheduler:
+    //
+    //     bulk(transfer_just(sched, v), auto_chunk_size(), n, f)
+    //
+    // clang-format off
+    template <typename Sender, typename Parameters, typename Shape,
+        typename F,
+        HPX_CONCEPT_REQUIRES_(
+            is_sender_v<Sender> &&
+            hpx::traits::is_executor_parameters_v<std::decay_t<Parameters>> &&
+            hpx::execution::experimental::detail::
+                is_completion_scheduler_tag_invocable_v<
+                    hpx::execution::experimental::set_value_t, Sender,
+                    bulk_t, Parameters, Shape, F>
+        )>
+    // clang-format on
+    constexpr auto tag_invoke(bulk_t, Sender&& sender, Parameters&& params,
+        Shape const& shape, F&& f)
+    {
+        auto scheduler = hpx::execution::experimental::get_completion_scheduler<
+            hpx::execution::experimental::set_value_t>(sender);
+
+        return tag_invoke(bulk_t{}, HPX_MOVE(scheduler),
+            HPX_FORWARD(Sender, sender), HPX_FORWARD(Parameters, params), shape,
+            HPX_FORWARD(F, f));
+    }
+#endif
 }    // namespace hpx::execution::experimental
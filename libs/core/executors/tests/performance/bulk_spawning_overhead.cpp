@@ -0,0 +1,103 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the time needed to run an (almost) empty bulk operation on a given
+// number of cores. The worker tasks are either all spawned by the calling
+// thread or, if selected through the topology_aware placement hint, along the
+// machine topology.
+
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+double measure(
+    std::size_t num_cores, std::size_t repetitions, bool topology_aware)
+{
+    hpx::threads::thread_schedule_hint hint;
+    if (topology_aware)
+    {
+        hint.placement_mode(
+            hpx::threads::thread_placement_hint::topology_aware);
+    }
+
+    auto exec = hpx::execution::experimental::with_processing_units_count(
+        hpx::execution::experimental::with_hint(
+            hpx::execution::parallel_executor(), hint),
+        num_cores);
+
+    // one element per core
+    std::vector<std::size_t> shape(num_cores);
+    std::iota(shape.begin(), shape.end(), 0);
+
+    std::atomic<std::size_t> count(0);
+    auto const f = [&](std::size_t) {
+        count.fetch_add(1, std::memory_order_relaxed);
+    };
+
+    // warm up
+    hpx::parallel::execution::bulk_async_execute(exec, f, shape).get();
+
+    std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i != repetitions; ++i)
+    {
+        hpx::parallel::execution::bulk_async_execute(exec, f, shape).get();
+    }
+    std::uint64_t const end = hpx::chrono::high_resolution_clock::now();
+
+    return static_cast<double>(end - start) / 1e9 /
+        static_cast<double>(repetitions);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    auto const repetitions = vm["repetitions"].as<std::size_t>();
+    auto max_cores = vm["max-cores"].as<std::size_t>();
+    if (max_cores == 0)
+    {
+        max_cores = hpx::get_num_worker_threads();
+    }
+
+    std::cout << "cores,flat spawning [s],topology aware spawning [s]\n";
+    for (std::size_t num_cores = 1; num_cores <= max_cores; num_cores *= 2)
+    {
+        std::cout << num_cores << "," << measure(num_cores, repetitions, false)
+                  << "," << measure(num_cores, repetitions, true) << "\n";
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("repetitions", value<std::size_t>()->default_value(1000),
+         "number of bulk operations to run for each number of cores")
+        ("max-cores", value<std::size_t>()->default_value(0),
+         "largest number of cores to use (default: number of worker "
+         "threads), may exceed the number of worker threads")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
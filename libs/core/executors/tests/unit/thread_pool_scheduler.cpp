@@ -2086,6 +2086,91 @@ void test_bulk()
     }
 }
 
+#if !defined(HPX_HAVE_STDEXEC)
+template <typename Parameters>
+void test_bulk_parameters(Parameters&& params)
+{
+    std::vector<int> const ns = {0, 1, 10, 43, 10007};
+
+    for (int n : ns)
+    {
+        std::vector<int> v(n, 0);
+        tt::sync_wait(ex::bulk(ex::schedule(ex::thread_pool_scheduler{}),
+            params, n, [&](int i) { ++v[i]; }));
+
+        for (int i = 0; i < n; ++i)
+        {
+            HPX_TEST_EQ(v[i], 1);
+        }
+    }
+
+    for (int n : ns)
+    {
+        std::vector<int> v(n, -1);
+        auto v_out = hpx::get<0>(*tt::sync_wait(ex::bulk(
+            ex::transfer_just(ex::thread_pool_scheduler{}, std::move(v)),
+            params, n, [](int i, std::vector<int>& v) { v[i] = i; })));
+
+        for (int i = 0; i < n; ++i)
+        {
+            HPX_TEST_EQ(v_out[i], i);
+        }
+    }
+
+    {
+        std::unordered_set<std::string> string_map;
+        std::vector<std::string> v = {"hello", "brave", "new", "world"};
+
+        hpx::mutex mtx;
+        tt::sync_wait(ex::bulk(ex::schedule(ex::thread_pool_scheduler{}),
+            params, v, [&](std::string const& s) {
+                std::lock_guard lk(mtx);
+                string_map.insert(s);
+            }));
+
+        for (auto const& s : v)
+        {
+            HPX_TEST(string_map.find(s) != string_map.end());
+        }
+    }
+
+    // exceptions thrown while measuring are reported, too
+    for (int i_fail : {0, 5000})
+    {
+        bool caught_exception = false;
+        try
+        {
+            tt::sync_wait(ex::bulk(ex::schedule(ex::thread_pool_scheduler{}),
+                params, 10007, [i_fail](int i) {
+                    if (i == i_fail)
+                    {
+                        throw std::runtime_error("error");
+                    }
+                }));
+        }
+        catch (std::runtime_error const& e)
+        {
+            caught_exception = true;
+            HPX_TEST(std::string(e.what()).find("error") == 0);
+        }
+        HPX_TEST(caught_exception);
+    }
+}
+
+void test_bulk_parameters()
+{
+    test_bulk_parameters(ex::static_chunk_size(7));
+    test_bulk_parameters(ex::dynamic_chunk_size(3));
+    test_bulk_parameters(ex::adaptive_static_chunk_size());
+    test_bulk_parameters(ex::guided_chunk_size(2));
+    test_bulk_parameters(ex::auto_chunk_size());
+    test_bulk_parameters(ex::persistent_auto_chunk_size());
+    test_bulk_parameters(ex::adaptive_auto_chunk_size());
+    test_bulk_parameters(
+        ex::adaptive_auto_chunk_size(std::chrono::microseconds(1)));
+}
+#endif
+
 void test_completion_scheduler()
 {
     namespace ex = hpx::execution::experimental;
@@ -2226,6 +2311,9 @@ int hpx_main()
     test_let_error();
     test_detach();
     test_bulk();
+#if !defined(HPX_HAVE_STDEXEC)
+    test_bulk_parameters();
+#endif
     test_completion_scheduler();
 
     return hpx::local::finalize();
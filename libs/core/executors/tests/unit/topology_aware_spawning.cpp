@@ -0,0 +1,163 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The worker tasks of a bulk operation are spawned along the machine topology
+// if the topology_aware placement hint is given. More worker threads than
+// processing units can be requested, which allows to test this on any machine.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/topology.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_topology()
+{
+    auto const& topo = hpx::threads::create_topology();
+
+    std::size_t const num_l3_caches = topo.get_number_of_l3_caches();
+    HPX_TEST_LTE(static_cast<std::size_t>(1), num_l3_caches);
+    HPX_TEST_LTE(num_l3_caches, topo.get_number_of_pus());
+
+    // all processing units of a core share the same L3 cache
+    for (std::size_t pu = 0; pu != topo.get_number_of_pus(); ++pu)
+    {
+        for (std::size_t other = 0; other != topo.get_number_of_pus(); ++other)
+        {
+            if (topo.get_core_number(pu) == topo.get_core_number(other))
+            {
+                HPX_TEST_EQ(topo.get_l3_cache_number(pu),
+                    topo.get_l3_cache_number(other));
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::threads::thread_schedule_hint topology_aware_hint()
+{
+    hpx::threads::thread_schedule_hint hint;
+    hint.placement_mode(hpx::threads::thread_placement_hint::topology_aware);
+    return hint;
+}
+
+auto make_executor(std::size_t num_cores, bool topology_aware)
+{
+    hpx::threads::thread_schedule_hint hint;
+    if (topology_aware)
+    {
+        hint = topology_aware_hint();
+    }
+    return hpx::execution::experimental::with_processing_units_count(
+        hpx::execution::experimental::with_hint(
+            hpx::execution::parallel_executor(), hint),
+        num_cores);
+}
+
+void test_bulk(std::size_t num_cores, std::size_t size, bool topology_aware)
+{
+    auto exec = make_executor(num_cores, topology_aware);
+
+    std::vector<std::size_t> shape(size);
+    std::iota(shape.begin(), shape.end(), 0);
+
+    std::vector<std::atomic<std::size_t>> executed(size);
+    hpx::parallel::execution::bulk_async_execute(
+        exec, [&](std::size_t i) { ++executed[i]; }, shape)
+        .get();
+
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        HPX_TEST_EQ(executed[i].load(), static_cast<std::size_t>(1));
+    }
+}
+
+void test_bulk_exception(std::size_t num_cores, bool topology_aware)
+{
+    auto exec = make_executor(num_cores, topology_aware);
+
+    std::vector<std::size_t> shape(1000);
+    std::iota(shape.begin(), shape.end(), 0);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::execution::bulk_async_execute(
+            exec,
+            [](std::size_t i) {
+                if (i == 999)
+                    throw std::runtime_error("test");
+            },
+            shape)
+            .get();
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.size(), static_cast<std::size_t>(1));
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+}
+
+void test_for_each(std::size_t num_cores)
+{
+    std::vector<std::size_t> values(10007, 0);
+    hpx::for_each(
+        hpx::execution::experimental::with_hint(
+            hpx::execution::par.with(
+                hpx::execution::experimental::num_cores(num_cores)),
+            topology_aware_hint()),
+        values.begin(), values.end(), [](std::size_t& v) { ++v; });
+
+    HPX_TEST_EQ(std::accumulate(values.begin(), values.end(),
+                    static_cast<std::size_t>(0)),
+        values.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_topology();
+
+    // topology aware spawning is used only if it was selected
+    for (bool topology_aware : {false, true})
+    {
+        for (std::size_t num_cores : {1, 8, 16, 17, 64})
+        {
+            test_bulk(num_cores, 1, topology_aware);
+            test_bulk(num_cores, 15, topology_aware);
+            test_bulk(num_cores, 10007, topology_aware);
+            test_bulk_exception(num_cores, topology_aware);
+        }
+    }
+
+    for (std::size_t num_cores : {8, 16, 17, 64})
+    {
+        test_for_each(num_cores);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,371 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/detail/basic_function.hpp>
+#include <hpx/functional/detail/empty_function.hpp>
+#include <hpx/functional/detail/vtable/callable_vtable.hpp>
+#include <hpx/functional/detail/vtable/vtable.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/traits/get_function_address.hpp>
+#include <hpx/functional/traits/get_function_annotation.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::util::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Other than function_base, the inplace functions never relocate the
+    // stored object using memcpy, they move construct it instead. This allows
+    // for storing arbitrary (nothrow move constructible) objects in the
+    // (potentially large) inline buffer.
+    struct inplace_vtable
+    {
+        template <typename T>
+        static void _move(void* to, void* from) noexcept
+        {
+            T& f = vtable::get<T>(from);
+            ::new (to) T(HPX_MOVE(f));
+            std::destroy_at(std::addressof(f));
+        }
+        void (*move)(void*, void*) noexcept;
+
+        template <typename T>
+        static void _destroy(void* obj) noexcept
+        {
+            std::destroy_at(std::addressof(vtable::get<T>(obj)));
+        }
+        void (*destroy)(void*) noexcept;
+
+        template <typename T>
+        explicit constexpr inplace_vtable(construct_vtable<T>) noexcept
+          : move(&inplace_vtable::_move<T>)
+          , destroy(&inplace_vtable::_destroy<T>)
+        {
+        }
+    };
+
+    template <typename Sig>
+    struct inplace_function_vtable
+      : inplace_vtable
+      , callable_info_vtable
+      , callable_vtable<Sig>
+    {
+        template <typename T>
+        explicit constexpr inplace_function_vtable(construct_vtable<T>) noexcept
+          : inplace_vtable(construct_vtable<T>())
+          , callable_info_vtable(construct_vtable<T>())
+          , callable_vtable<Sig>(construct_vtable<T>())
+        {
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Callables not fitting into the inline buffer of an inplace function
+    // allowing for heap allocation are stored through this wrapper.
+    template <typename F>
+    struct heap_stored_function
+    {
+        template <typename F_>
+        explicit heap_stored_function(F_&& f)
+          : f(std::make_unique<F>(HPX_FORWARD(F_, f)))
+        {
+        }
+
+        template <typename... Ts>
+        decltype(auto) operator()(Ts&&... vs)
+        {
+            return HPX_INVOKE(*f, HPX_FORWARD(Ts, vs)...);
+        }
+
+        std::unique_ptr<F> f;
+    };
+
+    template <typename F, std::size_t Capacity>
+    inline constexpr bool fits_inplace_function_storage_v =
+        sizeof(F) <= Capacity && alignof(F) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<F>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Move-only function wrapper storing the target in an inline buffer of
+    // Capacity bytes. If HeapFallback is false, targets not fitting into the
+    // buffer are rejected at compile time, otherwise those are allocated on
+    // the heap.
+    template <typename Sig, std::size_t Capacity, bool HeapFallback>
+    class basic_inplace_function;
+
+    template <typename Sig, std::size_t Capacity, bool HeapFallback>
+    [[nodiscard]] bool is_empty_function(
+        basic_inplace_function<Sig, Capacity, HeapFallback> const& f) noexcept
+    {
+        return f.empty();
+    }
+
+    template <typename R, typename... Ts, std::size_t Capacity,
+        bool HeapFallback>
+    class basic_inplace_function<R(Ts...), Capacity, HeapFallback>
+    {
+        using vtable = inplace_function_vtable<R(Ts...)>;
+
+    public:
+        using result_type = R;
+
+        static constexpr std::size_t capacity = Capacity;
+
+        constexpr basic_inplace_function(std::nullptr_t = nullptr) noexcept
+          : vptr(get_empty_vtable())
+        {
+        }
+
+        basic_inplace_function(basic_inplace_function const&) = delete;
+        basic_inplace_function& operator=(
+            basic_inplace_function const&) = delete;
+
+        basic_inplace_function(basic_inplace_function&& other) noexcept
+          : vptr(other.vptr)
+        {
+            vptr->move(storage, other.storage);
+            other.vptr = get_empty_vtable();
+        }
+
+        basic_inplace_function& operator=(
+            basic_inplace_function&& other) noexcept
+        {
+            if (this != &other)
+            {
+                vptr->destroy(storage);
+                vptr = other.vptr;
+                vptr->move(storage, other.storage);
+                other.vptr = get_empty_vtable();
+            }
+            return *this;
+        }
+
+        // the split SFINAE prevents MSVC from eagerly instantiating things
+        template <typename F, typename FD = std::decay_t<F>,
+            typename Enable1 = std::enable_if_t<
+                !std::is_same_v<FD, basic_inplace_function>>,
+            typename Enable2 =
+                std::enable_if_t<is_invocable_r_v<R, FD&, Ts...>>>
+        basic_inplace_function(F&& f)
+          : vptr(get_empty_vtable())
+        {
+            assign(HPX_FORWARD(F, f));
+        }
+
+        // the split SFINAE prevents MSVC from eagerly instantiating things
+        template <typename F, typename FD = std::decay_t<F>,
+            typename Enable1 = std::enable_if_t<
+                !std::is_same_v<FD, basic_inplace_function>>,
+            typename Enable2 =
+                std::enable_if_t<is_invocable_r_v<R, FD&, Ts...>>>
+        basic_inplace_function& operator=(F&& f)
+        {
+            assign(HPX_FORWARD(F, f));
+            return *this;
+        }
+
+        basic_inplace_function& operator=(std::nullptr_t) noexcept
+        {
+            reset();
+            return *this;
+        }
+
+        ~basic_inplace_function()
+        {
+            vptr->destroy(storage);
+        }
+
+        void assign(std::nullptr_t) noexcept
+        {
+            reset();
+        }
+
+        template <typename F>
+        void assign(F&& f)
+        {
+            using T = std::decay_t<F>;
+
+            reset();
+            if (detail::is_empty_function(f))
+            {
+                return;
+            }
+
+            if constexpr (fits_inplace_function_storage_v<T, Capacity>)
+            {
+                ::new (static_cast<void*>(storage)) T(HPX_FORWARD(F, f));
+                vptr = get_vtable<T>();
+            }
+            else
+            {
+                static_assert(HeapFallback,
+                    "the callable does not fit into the inline storage of "
+                    "this function object (it is too large, over-aligned, or "
+                    "not nothrow move constructible)");
+
+                using heap_type = heap_stored_function<T>;
+                ::new (static_cast<void*>(storage))
+                    heap_type(HPX_FORWARD(F, f));
+                vptr = get_vtable<heap_type>();
+            }
+        }
+
+        void reset() noexcept
+        {
+            vptr->destroy(storage);
+            vptr = get_empty_vtable();
+        }
+
+        void swap(basic_inplace_function& f) noexcept
+        {
+            basic_inplace_function tmp(HPX_MOVE(f));
+            f = HPX_MOVE(*this);
+            *this = HPX_MOVE(tmp);
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return vptr == get_empty_vtable();
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return !empty();
+        }
+
+        HPX_FORCEINLINE R operator()(Ts... vs) const
+        {
+            return vptr->invoke(storage, HPX_FORWARD(Ts, vs)...);
+        }
+
+        [[nodiscard]] std::size_t get_function_address() const
+        {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+            return empty() ? 0 : vptr->get_function_address(storage);
+#else
+            return 0;
+#endif
+        }
+
+        [[nodiscard]] char const* get_function_annotation() const
+        {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+            return empty() ? nullptr : vptr->get_function_annotation(storage);
+#else
+            return nullptr;
+#endif
+        }
+
+        [[nodiscard]] util::itt::string_handle get_function_annotation_itt()
+            const
+        {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION) && HPX_HAVE_ITTNOTIFY != 0 &&        \
+    !defined(HPX_HAVE_APEX)
+            return empty() ? util::itt::string_handle{} :
+                             vptr->get_function_annotation_itt(storage);
+#else
+            return util::itt::string_handle{};
+#endif
+        }
+
+    private:
+        [[nodiscard]] static constexpr vtable const* get_empty_vtable() noexcept
+        {
+            return detail::get_vtable<vtable, empty_function>();
+        }
+
+        template <typename T>
+        [[nodiscard]] static constexpr vtable const* get_vtable() noexcept
+        {
+            return detail::get_vtable<vtable, T>();
+        }
+
+        vtable const* vptr;
+        alignas(std::max_align_t) mutable unsigned char storage[Capacity];
+    };
+}    // namespace hpx::util::detail
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::traits {
+
+    template <typename F>
+    struct get_function_address<util::detail::heap_stored_function<F>>
+    {
+        [[nodiscard]] static std::size_t call(
+            util::detail::heap_stored_function<F> const& f) noexcept
+        {
+            return get_function_address<F>::call(*f.f);
+        }
+    };
+
+    template <typename F>
+    struct get_function_annotation<util::detail::heap_stored_function<F>>
+    {
+        [[nodiscard]] static char const* call(
+            util::detail::heap_stored_function<F> const& f) noexcept
+        {
+            return get_function_annotation<F>::call(*f.f);
+        }
+    };
+
+    template <typename Sig, std::size_t Capacity, bool HeapFallback>
+    struct get_function_address<
+        util::detail::basic_inplace_function<Sig, Capacity, HeapFallback>>
+    {
+        [[nodiscard]] static std::size_t call(
+            util::detail::basic_inplace_function<Sig, Capacity,
+                HeapFallback> const& f) noexcept
+        {
+            return f.get_function_address();
+        }
+    };
+
+    template <typename Sig, std::size_t Capacity, bool HeapFallback>
+    struct get_function_annotation<
+        util::detail::basic_inplace_function<Sig, Capacity, HeapFallback>>
+    {
+        [[nodiscard]] static char const* call(
+            util::detail::basic_inplace_function<Sig, Capacity,
+                HeapFallback> const& f) noexcept
+        {
+            return f.get_function_annotation();
+        }
+    };
+
+#if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
+    template <typename F>
+    struct get_function_annotation_itt<util::detail::heap_stored_function<F>>
+    {
+        [[nodiscard]] static util::itt::string_handle call(
+            util::detail::heap_stored_function<F> const& f) noexcept
+        {
+            return get_function_annotation_itt<F>::call(*f.f);
+        }
+    };
+
+    template <typename Sig, std::size_t Capacity, bool HeapFallback>
+    struct get_function_annotation_itt<
+        util::detail::basic_inplace_function<Sig, Capacity, HeapFallback>>
+    {
+        [[nodiscard]] static util::itt::string_handle call(
+            util::detail::basic_inplace_function<Sig, Capacity,
+                HeapFallback> const& f) noexcept
+        {
+            return f.get_function_annotation_itt();
+        }
+    };
+#endif
+}    // namespace hpx::traits
+#endif
@@ -0,0 +1,47 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file inplace_move_only_function.hpp
+/// \page hpx::inplace_move_only_function
+/// \headerfile hpx/functional.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/detail/basic_inplace_function.hpp>
+
+#include <cstddef>
+
+namespace hpx {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Class template hpx::inplace_move_only_function is a general-purpose
+    /// polymorphic function wrapper similar to hpx::move_only_function. Other
+    /// than hpx::move_only_function, it stores its target in an inline
+    /// buffer of \a Capacity bytes and never allocates memory. Constructing
+    /// an hpx::inplace_move_only_function from a Callable that is larger
+    /// than \a Capacity, that is over-aligned, or that is not nothrow move
+    /// constructible is rejected at compile time.
+    ///
+    /// hpx::inplace_move_only_function satisfies the requirements of
+    /// MoveConstructible and MoveAssignable, but does not satisfy
+    /// CopyConstructible or CopyAssignable. Invoking an empty
+    /// hpx::inplace_move_only_function throws an hpx::exception with the
+    /// error code hpx::error::bad_function_call.
+    template <typename Sig, std::size_t Capacity = 8 * sizeof(void*)>
+    using inplace_move_only_function =
+        util::detail::basic_inplace_function<Sig, Capacity, false>;
+}    // namespace hpx
+
+namespace hpx::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Same as hpx::inplace_move_only_function, except that targets not
+    // fitting into the inline buffer are allocated on the heap.
+    template <typename Sig, std::size_t Capacity = 8 * sizeof(void*)>
+    using small_move_only_function =
+        util::detail::basic_inplace_function<Sig, Capacity, true>;
+}    // namespace hpx::util
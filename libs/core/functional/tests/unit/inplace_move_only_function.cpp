@@ -0,0 +1,179 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/functional/inplace_move_only_function.hpp>
+#include <hpx/functional/move_only_function.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+// counts the live instances to verify the stored objects are destroyed
+int alive = 0;
+
+struct counted
+{
+    counted()
+    {
+        ++alive;
+    }
+    counted(counted const&)
+    {
+        ++alive;
+    }
+    counted(counted&&) noexcept
+    {
+        ++alive;
+    }
+    ~counted()
+    {
+        --alive;
+    }
+};
+
+void test_inplace_basics()
+{
+    hpx::inplace_move_only_function<int(int)> f;
+    HPX_TEST(f.empty());
+    HPX_TEST(!f);
+
+    f = [](int i) { return i + 1; };
+    HPX_TEST(!f.empty());
+    HPX_TEST_EQ(f(41), 42);
+
+    f.reset();
+    HPX_TEST(f.empty());
+
+    bool caught_exception = false;
+    try
+    {
+        f(0);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::bad_function_call);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void test_inplace_move_only_target()
+{
+    // the target is move-only and owns a resource
+    auto p = std::make_unique<int>(42);
+    hpx::inplace_move_only_function<int()> f = [p = HPX_MOVE(p)]() {
+        return *p;
+    };
+    HPX_TEST_EQ(f(), 42);
+
+    hpx::inplace_move_only_function<int()> g(HPX_MOVE(f));
+    HPX_TEST(f.empty());    //-V1001
+    HPX_TEST_EQ(g(), 42);
+
+    f = HPX_MOVE(g);
+    HPX_TEST(g.empty());    //-V1001
+    HPX_TEST_EQ(f(), 42);
+}
+
+void test_inplace_non_trivially_relocatable()
+{
+    // std::string may point into its own storage (short string
+    // optimization), moving the function must move construct the target
+    std::string const str("short");
+    hpx::inplace_move_only_function<std::string(), 64> f =
+        [s = std::string(str)]() { return s; };
+
+    hpx::inplace_move_only_function<std::string(), 64> g(HPX_MOVE(f));
+    HPX_TEST_EQ(g(), str);
+
+    hpx::inplace_move_only_function<std::string(), 64> h;
+    h = HPX_MOVE(g);
+    HPX_TEST_EQ(h(), str);
+
+    f.swap(h);
+    HPX_TEST(h.empty());
+    HPX_TEST_EQ(f(), str);
+}
+
+void test_inplace_lifetime()
+{
+    {
+        counted c;
+        hpx::inplace_move_only_function<void()> f = [c]() {};
+        HPX_TEST_EQ(alive, 2);
+
+        hpx::inplace_move_only_function<void()> g(HPX_MOVE(f));
+        HPX_TEST_EQ(alive, 2);
+
+        g = nullptr;
+        HPX_TEST_EQ(alive, 1);
+    }
+    HPX_TEST_EQ(alive, 0);
+}
+
+void test_inplace_capacity()
+{
+    // a target using the full capacity is stored inline
+    std::array<char, 8 * sizeof(void*)> data{};
+    data[0] = 'a';
+    hpx::inplace_move_only_function<char()> f = [data]() { return data[0]; };
+    HPX_TEST_EQ(f(), 'a');
+
+    static_assert(sizeof(hpx::inplace_move_only_function<char(), 128>) >= 128,
+        "the capacity is configurable");
+}
+
+void test_small_heap_fallback()
+{
+    // targets not fitting into the inline buffer are allocated on the heap
+    std::array<int, 64> data{};
+    data[63] = 42;
+
+    counted c;
+    hpx::util::small_move_only_function<int(), 16> f = [data, c]() {
+        return data[63];
+    };
+    HPX_TEST_EQ(alive, 2);
+    HPX_TEST_EQ(f(), 42);
+
+    hpx::util::small_move_only_function<int(), 16> g(HPX_MOVE(f));
+    HPX_TEST_EQ(alive, 2);
+    HPX_TEST_EQ(g(), 42);
+
+    g.reset();
+    HPX_TEST_EQ(alive, 1);
+}
+
+void test_wrap_move_only_function()
+{
+    hpx::move_only_function<int()> empty;
+    hpx::inplace_move_only_function<int()> f = HPX_MOVE(empty);
+    HPX_TEST(f.empty());
+
+    hpx::move_only_function<int()> g = []() { return 42; };
+    f = HPX_MOVE(g);
+    HPX_TEST(!f.empty());
+    HPX_TEST_EQ(f(), 42);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_inplace_basics();
+    test_inplace_move_only_target();
+    test_inplace_non_trivially_relocatable();
+    test_inplace_lifetime();
+    test_inplace_capacity();
+    test_small_heap_fallback();
+    test_wrap_move_only_function();
+
+    return hpx::util::report_errors();
+}
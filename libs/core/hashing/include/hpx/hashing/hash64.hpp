@@ -0,0 +1,290 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// The byte sequence hash is based on wyhash (final version 4) by Wang Yi,
+// released into the public domain: https://github.com/wangyi-fudan/wyhash
+//
+// The integer hash is based on the rrmxmx mixer by Pelle Evensen:
+// https://mostlymangling.blogspot.com/2019/01/better-stronger-mixer-and-test-procedure.html
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#if defined(HPX_MSVC) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace hpx::util {
+
+    namespace detail {
+
+        inline constexpr std::uint64_t hash64_secret[4] = {
+            0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+            0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull};
+
+        inline constexpr std::uint64_t hash64_int_multiplier =
+            0x9fb21c651e98df25ull;
+
+        // 64x64->128 bit multiplication, returns the low half in a and the
+        // high half in b
+        HPX_FORCEINLINE void hash64_mum(
+            std::uint64_t& a, std::uint64_t& b) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            __extension__ using uint128_t = unsigned __int128;
+            uint128_t const r = static_cast<uint128_t>(a) * b;
+            a = static_cast<std::uint64_t>(r);
+            b = static_cast<std::uint64_t>(r >> 64);
+#elif defined(HPX_MSVC) && defined(_M_X64)
+            a = _umul128(a, b, &b);
+#else
+            std::uint64_t const ha = a >> 32, hb = b >> 32;
+            std::uint64_t const la = static_cast<std::uint32_t>(a);
+            std::uint64_t const lb = static_cast<std::uint32_t>(b);
+            std::uint64_t const rh = ha * hb, rm0 = ha * lb, rm1 = hb * la,
+                                rl = la * lb;
+            std::uint64_t const t = rl + (rm0 << 32);
+            std::uint64_t const lo = t + (rm1 << 32);
+            std::uint64_t const c = (t < rl) + (lo < t);
+            a = lo;
+            b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+        }
+
+        HPX_FORCEINLINE std::uint64_t hash64_mix(
+            std::uint64_t a, std::uint64_t b) noexcept
+        {
+            hash64_mum(a, b);
+            return a ^ b;
+        }
+
+        // the byte order of the input is not normalized, i.e. the hash
+        // values of byte sequences depend on the endianness of the platform
+        HPX_FORCEINLINE std::uint64_t hash64_read8(
+            unsigned char const* p) noexcept
+        {
+            std::uint64_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        HPX_FORCEINLINE std::uint64_t hash64_read4(
+            unsigned char const* p) noexcept
+        {
+            std::uint32_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        HPX_FORCEINLINE std::uint64_t hash64_read3(
+            unsigned char const* p, std::size_t k) noexcept
+        {
+            return (static_cast<std::uint64_t>(p[0]) << 16) |
+                (static_cast<std::uint64_t>(p[k >> 1]) << 8) | p[k - 1];
+        }
+
+        // This is applied element-wise if T is a vector pack type (datapar),
+        // it uses only operations that are available for vector packs of
+        // 64 bit unsigned integers.
+        template <typename T>
+        constexpr T hash64_int_mix(T v, T const& seed) noexcept
+        {
+            v ^= seed;
+            v ^= ((v >> 49) | (v << 15)) ^ ((v >> 24) | (v << 40));
+            v *= hash64_int_multiplier;
+            v ^= (v >> 35);
+            v *= hash64_int_multiplier;
+            return v ^ (v >> 28);
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Calculate a 64 bit hash value for the given sequence of bytes. The
+    /// hash values are identical for all processes using the same \a seed
+    /// on platforms of the same endianness.
+    ///
+    /// \param data  [in] Pointer to the first byte to hash.
+    /// \param size  [in] The number of bytes to hash.
+    /// \param seed  [in] The seed to use, see \a random_hash_seed.
+    ///
+    inline std::uint64_t hash64_bytes(void const* data, std::size_t size,
+        std::uint64_t seed = 0) noexcept
+    {
+        using detail::hash64_mix;
+        using detail::hash64_read8;
+        using detail::hash64_secret;
+
+        auto const* p = static_cast<unsigned char const*>(data);
+        seed ^= hash64_mix(seed ^ hash64_secret[0], hash64_secret[1]);
+
+        std::uint64_t a = 0, b = 0;
+        if (size <= 16)
+        {
+            if (size >= 4)
+            {
+                std::size_t const offset = (size >> 3) << 2;
+                a = (detail::hash64_read4(p) << 32) |
+                    detail::hash64_read4(p + offset);
+                b = (detail::hash64_read4(p + size - 4) << 32) |
+                    detail::hash64_read4(p + size - 4 - offset);
+            }
+            else if (size > 0)
+            {
+                a = detail::hash64_read3(p, size);
+            }
+        }
+        else
+        {
+            std::size_t i = size;
+            if (i >= 48)
+            {
+                // three independent dependency chains
+                std::uint64_t see1 = seed, see2 = seed;
+                do
+                {
+                    seed = hash64_mix(hash64_read8(p) ^ hash64_secret[1],
+                        hash64_read8(p + 8) ^ seed);
+                    see1 = hash64_mix(hash64_read8(p + 16) ^ hash64_secret[2],
+                        hash64_read8(p + 24) ^ see1);
+                    see2 = hash64_mix(hash64_read8(p + 32) ^ hash64_secret[3],
+                        hash64_read8(p + 40) ^ see2);
+                    p += 48;
+                    i -= 48;
+                } while (i >= 48);
+                seed ^= see1 ^ see2;
+            }
+
+            while (i > 16)
+            {
+                seed = hash64_mix(hash64_read8(p) ^ hash64_secret[1],
+                    hash64_read8(p + 8) ^ seed);
+                i -= 16;
+                p += 16;
+            }
+
+            a = hash64_read8(p + i - 16);
+            b = hash64_read8(p + i - 8);
+        }
+
+        a ^= hash64_secret[1];
+        b ^= seed;
+        detail::hash64_mum(a, b);
+        return hash64_mix(a ^ hash64_secret[0] ^ size, b ^ hash64_secret[1]);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Calculate a 64 bit hash value for the given integer. Different keys
+    /// are mapped to different hash values for the same \a seed.
+    ///
+    /// \param key   [in] The integer to hash.
+    /// \param seed  [in] The seed to use, see \a random_hash_seed.
+    ///
+    constexpr std::uint64_t hash64_int(
+        std::uint64_t key, std::uint64_t seed = 0) noexcept
+    {
+        return detail::hash64_int_mix(key, seed);
+    }
+
+    /// Calculate the 64 bit hash values for all elements of the given vector
+    /// pack of 64 bit unsigned integers, this is equivalent to applying
+    /// \a hash64_int to every element. Together with the datapar execution
+    /// policies this allows to hash large numbers of keys using SIMD
+    /// instructions, for instance:
+    ///
+    /// \code
+    ///     hpx::transform(hpx::execution::par_simd, keys.begin(), keys.end(),
+    ///         hashes.begin(), [seed](auto const& k) {
+    ///             return hpx::util::hash64_int_pack(k, seed);
+    ///         });
+    /// \endcode
+    ///
+    template <typename Pack>
+    constexpr Pack hash64_int_pack(Pack const& keys, std::uint64_t seed = 0)
+    {
+        return detail::hash64_int_mix(Pack(keys), Pack(seed));
+    }
+
+    /// Calculate the 64 bit hash values for \a count integer keys. The
+    /// result for every key is identical to calling \a hash64_int for it.
+    /// The loop is written such that it can be vectorized by the compiler.
+    ///
+    /// \param keys    [in] Pointer to the first key.
+    /// \param count   [in] The number of keys to hash.
+    /// \param hashes  [out] Pointer to the storage for the \a count hash
+    ///                values, must not overlap with the keys.
+    /// \param seed    [in] The seed to use, see \a random_hash_seed.
+    ///
+    template <typename Key>
+    void hash64_int_bulk(Key const* HPX_RESTRICT keys, std::size_t count,
+        std::uint64_t* HPX_RESTRICT hashes, std::uint64_t seed = 0) noexcept
+    {
+        static_assert(std::is_integral_v<Key> || std::is_enum_v<Key>,
+            "hash64_int_bulk requires integral (or enumeration) keys");
+
+        HPX_IVDEP HPX_VECTORIZE for (std::size_t i = 0; i != count; ++i)
+        {
+            hashes[i] = detail::hash64_int_mix(
+                static_cast<std::uint64_t>(keys[i]), seed);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Return the seed to use for hash tables that could be attacked by
+    /// feeding them with colliding keys. The seed is chosen randomly once
+    /// per process. It can be set explicitly using the environment variable
+    /// HPX_HASH_SEED, which is required if hash values have to agree between
+    /// localities.
+    HPX_CORE_EXPORT std::uint64_t random_hash_seed() noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The hash64 class is a function object calculating seeded 64 bit hash
+    /// values for integers, enumerations, and strings. It can be used as the
+    /// hash function of unordered containers.
+    class hash64
+    {
+    public:
+        using is_transparent = void;
+
+        /// Use the process wide random seed, see \a random_hash_seed.
+        hash64() noexcept
+          : seed_(random_hash_seed())
+        {
+        }
+
+        explicit constexpr hash64(std::uint64_t seed) noexcept
+          : seed_(seed)
+        {
+        }
+
+        template <typename T,
+            typename Enable =
+                std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>>
+        constexpr std::uint64_t operator()(T key) const noexcept
+        {
+            return hash64_int(static_cast<std::uint64_t>(key), seed_);
+        }
+
+        std::uint64_t operator()(std::string_view key) const noexcept
+        {
+            return hash64_bytes(key.data(), key.size(), seed_);
+        }
+
+        constexpr std::uint64_t seed() const noexcept
+        {
+            return seed_;
+        }
+
+    private:
+        std::uint64_t seed_;
+    };
+}    // namespace hpx::util
@@ -0,0 +1,58 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/hashing/hash64.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+
+namespace hpx::util {
+
+    namespace {
+
+        std::uint64_t generate_hash_seed() noexcept
+        {
+            if (char const* env = std::getenv("HPX_HASH_SEED"))
+            {
+                char* end = nullptr;
+                std::uint64_t const seed = std::strtoull(env, &end, 0);
+                if (end != env && *end == '\0')
+                    return seed;
+            }
+
+            std::uint64_t seed = 0;
+            try
+            {
+                std::random_device rd;
+                seed = (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+            }
+            catch (...)
+            {
+                // no source of randomness, fall through
+            }
+
+            // the random device might be deterministic on some platforms,
+            // additionally mix in the time and the address of a local
+            // variable (ASLR)
+            auto const now = static_cast<std::uint64_t>(
+                std::chrono::high_resolution_clock::now()
+                    .time_since_epoch()
+                    .count());
+            return hash64_int(seed ^ now,
+                static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(
+                    &seed)));
+        }
+    }    // namespace
+
+    std::uint64_t random_hash_seed() noexcept
+    {
+        static std::uint64_t const seed = generate_hash_seed();
+        return seed;
+    }
+}    // namespace hpx::util
@@ -0,0 +1,152 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hashing/hash64.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_hash64_bytes()
+{
+    // all prefixes of a string (covering all code paths) hash differently
+    std::string const str(200, 'x');
+    std::set<std::uint64_t> hashes;
+    for (std::size_t i = 0; i != str.size(); ++i)
+    {
+        hashes.insert(hpx::util::hash64_bytes(str.data(), i));
+    }
+    HPX_TEST_EQ(hashes.size(), str.size());
+
+    // the result does not depend on the alignment of the data
+    std::vector<char> buffer(str.size() + 8);
+    for (std::size_t offset = 0; offset != 8; ++offset)
+    {
+        std::memcpy(buffer.data() + offset, str.data(), str.size());
+        for (std::size_t i : {3, 8, 17, 63, 64, 199})
+        {
+            HPX_TEST_EQ(hpx::util::hash64_bytes(buffer.data() + offset, i),
+                hpx::util::hash64_bytes(str.data(), i));
+        }
+    }
+
+    // every byte influences the result
+    std::string key = "the quick brown fox jumps over the lazy dog";
+    std::uint64_t const h = hpx::util::hash64_bytes(key.data(), key.size());
+    for (char& c : key)
+    {
+        c ^= 1;
+        HPX_TEST_NEQ(hpx::util::hash64_bytes(key.data(), key.size()), h);
+        c ^= 1;
+    }
+    HPX_TEST_EQ(hpx::util::hash64_bytes(key.data(), key.size()), h);
+
+    // the seed influences the result
+    HPX_TEST_NEQ(hpx::util::hash64_bytes(key.data(), key.size(), 1), h);
+    HPX_TEST_NEQ(hpx::util::hash64_bytes("", 0, 1),
+        hpx::util::hash64_bytes("", 0, 2));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_hash64_int()
+{
+    static_assert(hpx::util::hash64_int(42) == hpx::util::hash64_int(42, 0));
+
+    // different keys produce different hashes (the mixer is a bijection)
+    std::unordered_set<std::uint64_t> hashes;
+    for (std::uint64_t i = 0; i != 10000; ++i)
+    {
+        hashes.insert(hpx::util::hash64_int(i, 17));
+    }
+    HPX_TEST_EQ(hashes.size(), static_cast<std::size_t>(10000));
+
+    // flipping a single bit of the key flips roughly half of the bits of
+    // the hash value
+    std::size_t flipped = 0;
+    std::size_t const num_keys = 1000;
+    for (std::uint64_t key = 0; key != num_keys; ++key)
+    {
+        std::uint64_t const h = hpx::util::hash64_int(key, 17);
+        for (int bit = 0; bit != 64; ++bit)
+        {
+            std::uint64_t const diff =
+                h ^ hpx::util::hash64_int(key ^ (std::uint64_t(1) << bit), 17);
+            for (std::uint64_t d = diff; d != 0; d &= d - 1)
+            {
+                ++flipped;
+            }
+        }
+    }
+    double const ratio =
+        static_cast<double>(flipped) / static_cast<double>(num_keys * 64 * 64);
+    HPX_TEST_LT(0.45, ratio);
+    HPX_TEST_LT(ratio, 0.55);
+
+    // the seed influences the result
+    HPX_TEST_NEQ(hpx::util::hash64_int(42, 1), hpx::util::hash64_int(42, 2));
+
+    // vector packs are hashed element-wise, this includes scalars
+    HPX_TEST_EQ(hpx::util::hash64_int_pack(std::uint64_t(42), 1),
+        hpx::util::hash64_int(42, 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Key>
+void test_hash64_int_bulk()
+{
+    std::vector<Key> keys(1027);
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        keys[i] = static_cast<Key>(i * 7919);
+    }
+
+    std::vector<std::uint64_t> hashes(keys.size());
+    hpx::util::hash64_int_bulk(keys.data(), keys.size(), hashes.data(), 5);
+
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        HPX_TEST_EQ(hashes[i],
+            hpx::util::hash64_int(static_cast<std::uint64_t>(keys[i]), 5));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_hash64()
+{
+    // the default constructed function objects all use the same seed
+    HPX_TEST_EQ(hpx::util::hash64().seed(), hpx::util::random_hash_seed());
+    HPX_TEST_EQ(hpx::util::hash64()(42), hpx::util::hash64()(42));
+
+    hpx::util::hash64 const hasher(3);
+    HPX_TEST_EQ(hasher(42), hpx::util::hash64_int(42, 3));
+    HPX_TEST_EQ(hasher("key"), hpx::util::hash64_bytes("key", 3, 3));
+    HPX_TEST_EQ(hasher(std::string("key")), hasher("key"));
+
+    std::unordered_set<std::string, hpx::util::hash64> set;
+    set.insert("one");
+    set.insert("two");
+    HPX_TEST(set.find("one") != set.end());
+    HPX_TEST(set.find("three") == set.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_hash64_bytes();
+    test_hash64_int();
+    test_hash64_int_bulk<std::uint64_t>();
+    test_hash64_int_bulk<std::int32_t>();
+    test_hash64_int_bulk<std::uint16_t>();
+    test_hash64();
+
+    return hpx::util::report_errors();
+}
@@ -7,4 +7,5 @@
 #pragma once
 
 #include <hpx/synchronization/lock_types.hpp>
+#include <hpx/synchronization/reader_biased_shared_mutex.hpp>
 #include <hpx/synchronization/shared_mutex.hpp>
@@ -8,6 +8,7 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/assert.hpp>
+#include <hpx/allocator_support/task_arena.hpp>
 #include <hpx/command_line_handling_local/command_line_handling_local.hpp>
 #include <hpx/coroutines/detail/context_impl.hpp>
 #include <hpx/execution/detail/execution_parameter_callbacks.hpp>
@@ -29,6 +30,7 @@
 #include <hpx/program_options/parsers.hpp>
 #include <hpx/program_options/variables_map.hpp>
 #include <hpx/resource_partitioner/partitioner.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime_local/custom_exception_info.hpp>
 #include <hpx/runtime_local/debugging.hpp>
@@ -402,6 +404,8 @@ namespace hpx {
                 hpx::threads::detail::set_get_default_timer_service(
                     &hpx::detail::get_default_timer_service);
                 hpx::threads::detail::set_get_locality_id(&get_locality_id);
+                hpx::memory::detail::set_get_task_arena(
+                    &hpx::threads::detail::get_self_task_arena);
                 hpx::parallel::execution::detail::set_get_pu_mask(
                     &hpx::detail::get_pu_mask);
                 hpx::parallel::execution::detail::set_get_os_thread_count(
@@ -452,10 +456,13 @@ namespace hpx {
                         return result;
                     }
 
+                    hpx::util::reset_startup_timings();
+
                     hpx::local::detail::command_line_handling cmdline{
                         hpx::util::runtime_configuration(
                             argv[0], hpx::runtime_mode::local),
                         params.cfg, f};
+                    hpx::util::mark_startup_stage("configuration");
 
                     // scope exception handling to resource partitioner initialization
                     // any exception thrown during run_or_start below are handled
@@ -465,6 +472,7 @@ namespace hpx {
                         result = cmdline.call(params.desc_cmdline, argc, argv);
 
                         init_environment(cmdline.rtcfg_);
+                        hpx::util::mark_startup_stage("command line handling");
 
                         hpx::threads::policies::detail::affinity_data
                             affinity_data{};
@@ -509,6 +517,7 @@ namespace hpx {
 
                         // Setup all internal parameters of the resource_partitioner
                         rp.configure_pools();
+                        hpx::util::mark_startup_stage("resource partitioner");
                     }
                     catch (hpx::exception const& e)
                     {
@@ -526,6 +535,7 @@ namespace hpx {
                     // Command line handling should have updated this by now.
                     LPROGRESS_ << "creating local runtime";
                     rt.reset(new hpx::runtime(cmdline.rtcfg_, true));
+                    hpx::util::mark_startup_stage("runtime construction");
 
                     // Store application defined command line options
                     rt->set_app_options(params.desc_cmdline);
@@ -276,6 +276,31 @@ namespace hpx::util::plugin {
             LoadLibrary(ec, true);
         }
 
+        // Return whether the shared library is already mapped into the
+        // process, e.g. because the application was linked against it. This
+        // does not load the library.
+        [[nodiscard]] bool is_loaded() const
+        {
+            if (dll_handle)
+                return true;
+
+#if defined(RTLD_NOLOAD)
+            std::unique_lock<std::recursive_mutex> lock(*mtx_);
+
+            ::dlerror();    // Clear the error state.
+            HMODULE const handle = reinterpret_cast<HMODULE>(
+                ::dlopen((dll_name.empty() ? nullptr : dll_name.c_str()),
+                    RTLD_LAZY | RTLD_NOLOAD));
+            if (handle)
+            {
+                ::dlclose(handle);
+                return true;
+            }
+            ::dlerror();    // Clear the error state.
+#endif
+            return false;
+        }
+
     protected:
         void LoadLibrary(error_code& ec = throws, bool force = false)
         {
@@ -191,6 +191,15 @@ namespace hpx::util::plugin {
             LoadLibrary(ec, true);
         }
 
+        // Return whether the shared library is already mapped into the
+        // process, e.g. because the application was linked against it. This
+        // does not load the library.
+        [[nodiscard]] bool is_loaded() const
+        {
+            return dll_handle != nullptr ||
+                ::GetModuleHandleA(dll_name.c_str()) != nullptr;
+        }
+
     protected:
         void LoadLibrary(error_code& ec = throws, bool force = false)
         {
@@ -0,0 +1,30 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/function.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // If hpx.load_modules_on_demand is set, component modules that are not
+    // required during startup are not loaded until one of their component
+    // types, actions, or performance counter types is resolved for the first
+    // time. The runtime installs the function that loads all of those
+    // deferred modules, the function returns whether any module was loaded.
+    using deferred_modules_loader_type = hpx::function<bool()>;
+
+    HPX_CORE_EXPORT void set_deferred_modules_loader(
+        deferred_modules_loader_type loader);
+
+    // Load all modules whose loading was deferred during startup. Returns
+    // whether at least one module was loaded, i.e. whether it might be
+    // worthwhile to repeat the failed lookup.
+    HPX_CORE_EXPORT bool load_deferred_modules();
+}    // namespace hpx::util
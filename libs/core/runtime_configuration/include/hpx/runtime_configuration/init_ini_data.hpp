@@ -13,6 +13,7 @@
 #include <hpx/runtime_configuration/component_registry_base.hpp>
 #include <hpx/runtime_configuration/plugin_registry_base.hpp>
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -44,13 +45,55 @@ namespace hpx::util {
     // global function to read component ini information
     void merge_component_inis(section& ini);
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Persistent metadata about the shared libraries found in the component
+    // paths (see hpx.module_cache). It allows to discover the components
+    // exposed by a module without loading it. Entries are invalidated
+    // whenever the size or the modification time of a library changes.
+    class HPX_CORE_EXPORT module_cache
+    {
+    public:
+        struct entry
+        {
+            std::uintmax_t size = 0;
+            std::int64_t mtime = 0;
+            bool has_components = false;
+            bool has_plugins = false;
+            std::vector<std::string> ini_data;
+        };
+
+        explicit module_cache(std::string filename);
+
+        // return the cached metadata for the given library, if any
+        entry const* find(filesystem::path const& lib) const;
+
+        // store the metadata for the given library
+        void update(filesystem::path const& lib, entry e);
+
+        // write the cache file, if it was changed
+        void save() const;
+
+    private:
+        bool get_file_info(filesystem::path const& lib, std::uintmax_t& size,
+            std::int64_t& mtime) const;
+
+        std::string filename_;
+        std::map<std::string, entry> entries_;
+        bool modified_ = false;
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     // iterate over all shared libraries in the given directory and construct
     // default ini settings assuming all of those are components
+    //
+    // If a module cache is given, libraries described by a valid cache entry
+    // are not loaded, unless they expose plugins. The components of those
+    // libraries are marked to be loaded on demand.
     std::vector<std::shared_ptr<plugins::plugin_registry_base>>
     init_ini_data_default(std::string const& libs, section& ini,
         std::map<std::string, filesystem::path>& basenames,
         std::map<std::string, hpx::util::plugin::dll>& modules,
         std::vector<std::shared_ptr<components::component_registry_base>>&
-            component_registries);
+            component_registries,
+        module_cache* cache = nullptr);
 }    // namespace hpx::util
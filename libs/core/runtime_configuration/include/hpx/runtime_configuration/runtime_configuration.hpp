@@ -30,6 +30,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::util {
 
+    class module_cache;
+
     ///////////////////////////////////////////////////////////////////////////
     // The runtime_configuration class is a wrapper for the runtime
     // configuration data allowing to extract configuration information in a
@@ -172,7 +174,8 @@ namespace hpx::util {
             std::string const& component_base_paths,
             std::string const& component_path_suffixes,
             std::set<std::string>& component_paths,
-            std::map<std::string, filesystem::path>& basenames);
+            std::map<std::string, filesystem::path>& basenames,
+            module_cache* cache);
 
         void load_component_path(
             std::vector<std::shared_ptr<plugins::plugin_registry_base>>&
@@ -180,7 +183,8 @@ namespace hpx::util {
             std::vector<std::shared_ptr<components::component_registry_base>>&
                 component_registries,
             std::string const& path, std::set<std::string>& component_paths,
-            std::map<std::string, filesystem::path>& basenames);
+            std::map<std::string, filesystem::path>& basenames,
+            module_cache* cache);
 
     public:
         runtime_mode mode_;
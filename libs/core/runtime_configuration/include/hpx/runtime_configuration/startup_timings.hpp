@@ -0,0 +1,35 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Restart measuring the runtime startup and discard all recorded stages.
+    HPX_CORE_EXPORT void reset_startup_timings();
+
+    // Record the end of the given runtime startup stage. The time elapsed
+    // since the previous stage ended (or since the timings were reset) is
+    // attributed to this stage.
+    HPX_CORE_EXPORT void mark_startup_stage(std::string name);
+
+    // Return all recorded startup stages together with their duration (in
+    // seconds), in the order they were recorded.
+    HPX_CORE_EXPORT std::vector<std::pair<std::string, double>>
+    get_startup_timings();
+
+    // Print all recorded startup stages to the given stream.
+    HPX_CORE_EXPORT void print_startup_timings(std::ostream& os);
+}    // namespace hpx::util
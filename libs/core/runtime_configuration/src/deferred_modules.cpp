@@ -0,0 +1,47 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/runtime_configuration/deferred_modules.hpp>
+
+#include <mutex>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util {
+
+    namespace {
+
+        std::mutex& deferred_modules_mutex()
+        {
+            static std::mutex mtx;
+            return mtx;
+        }
+
+        deferred_modules_loader_type& deferred_modules_loader()
+        {
+            static deferred_modules_loader_type loader;
+            return loader;
+        }
+    }    // namespace
+
+    void set_deferred_modules_loader(deferred_modules_loader_type loader)
+    {
+        std::lock_guard<std::mutex> l(deferred_modules_mutex());
+        deferred_modules_loader() = HPX_MOVE(loader);
+    }
+
+    bool load_deferred_modules()
+    {
+        deferred_modules_loader_type loader;
+        {
+            std::lock_guard<std::mutex> l(deferred_modules_mutex());
+            loader = deferred_modules_loader();
+        }
+        return !loader.empty() && loader();
+    }
+}    // namespace hpx::util
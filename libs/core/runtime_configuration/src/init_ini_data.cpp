@@ -20,6 +20,13 @@
 #include <hpx/version.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <fstream>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -280,7 +287,8 @@ namespace hpx::util {
         std::string const& curr,
         std::vector<std::shared_ptr<components::component_registry_base>>&
             component_registries,
-        std::string name, error_code& ec)
+        std::string name, error_code& ec,
+        std::vector<std::string>* cached_ini_data = nullptr)
     {
         hpx::util::plugin::plugin_factory<
             components::component_registry_base> const pf(d, "registry");
@@ -327,6 +335,9 @@ namespace hpx::util {
         // incorporate all information from this module's
         // registry into our internal ini object
         ini.parse("<component registry>", ini_data, false, false);
+
+        if (cached_ini_data != nullptr)
+            *cached_ini_data = HPX_MOVE(ini_data);
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -371,6 +382,187 @@ namespace hpx::util {
         return plugin_registries;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The cache file starts with a line identifying the HPX version that
+    // wrote it, followed by one block per library:
+    //
+    //      module|<flags>|<size>|<mtime>|<path>
+    //      ini|<ini line>
+    //      ...
+    //
+    // where flags contains 'c' if the library exposes components, and 'p' if
+    // it exposes plugins.
+    namespace {
+
+        char const* const module_cache_prefix = "hpx-module-cache|";
+        char const* const module_cache_module = "module|";
+        char const* const module_cache_ini = "ini|";
+
+        bool starts_with(std::string const& line, char const* prefix)
+        {
+            return line.compare(0, std::strlen(prefix), prefix) == 0;
+        }
+    }    // namespace
+
+    module_cache::module_cache(std::string filename)
+      : filename_(HPX_MOVE(filename))
+    {
+        // a missing or outdated cache file is (re-)written in any case
+        std::ifstream in(filename_);
+        if (!in)
+        {
+            modified_ = true;
+            return;
+        }
+
+        std::string line;
+        if (!std::getline(in, line) ||
+            line != module_cache_prefix + hpx::full_version_as_string())
+        {
+            LRT_(info).format(
+                "ignoring module cache written by a different version of "
+                "HPX: {}",
+                filename_);
+            modified_ = true;
+            return;
+        }
+
+        entry* current = nullptr;
+        while (std::getline(in, line))
+        {
+            if (starts_with(line, module_cache_ini))
+            {
+                if (current != nullptr)
+                    current->ini_data.push_back(
+                        line.substr(std::strlen(module_cache_ini)));
+                continue;
+            }
+
+            current = nullptr;
+            if (!starts_with(line, module_cache_module))
+                continue;
+
+            // split off flags, size, and modification time, the remainder of
+            // the line is the path of the library
+            std::vector<std::string> fields;
+            std::string::size_type pos = std::strlen(module_cache_module);
+            for (int i = 0; i != 3; ++i)
+            {
+                std::string::size_type const next = line.find('|', pos);
+                if (next == std::string::npos)
+                    break;
+                fields.push_back(line.substr(pos, next - pos));
+                pos = next + 1;
+            }
+            if (fields.size() != 3 || pos >= line.size())
+                continue;
+
+            try
+            {
+                entry e;
+                e.has_components = fields[0].find('c') != std::string::npos;
+                e.has_plugins = fields[0].find('p') != std::string::npos;
+                e.size = static_cast<std::uintmax_t>(std::stoull(fields[1]));
+                e.mtime = static_cast<std::int64_t>(std::stoll(fields[2]));
+
+                current = &(entries_[line.substr(pos)] = HPX_MOVE(e));
+            }
+            catch (std::exception const&)
+            {
+                // ignore malformed entries
+            }
+        }
+    }
+
+    bool module_cache::get_file_info(filesystem::path const& lib,
+        std::uintmax_t& size, std::int64_t& mtime) const
+    {
+        namespace fs = filesystem;
+
+        try
+        {
+            size = static_cast<std::uintmax_t>(fs::file_size(lib));
+#if defined(HPX_FILESYSTEM_HAVE_BOOST_FILESYSTEM_COMPATIBILITY)
+            mtime = static_cast<std::int64_t>(fs::last_write_time(lib));
+#else
+            mtime = static_cast<std::int64_t>(
+                fs::last_write_time(lib).time_since_epoch().count());
+#endif
+        }
+        catch (fs::filesystem_error const&)
+        {
+            return false;
+        }
+        return true;
+    }
+
+    module_cache::entry const* module_cache::find(
+        filesystem::path const& lib) const
+    {
+        auto const it = entries_.find(lib.string());
+        if (it == entries_.end())
+            return nullptr;
+
+        // make sure the library was not changed since the entry was written
+        std::uintmax_t size = 0;
+        std::int64_t mtime = 0;
+        if (!get_file_info(lib, size, mtime) || size != it->second.size ||
+            mtime != it->second.mtime)
+        {
+            return nullptr;
+        }
+        return &it->second;
+    }
+
+    void module_cache::update(filesystem::path const& lib, entry e)
+    {
+        if (!get_file_info(lib, e.size, e.mtime))
+            return;
+
+        entries_[lib.string()] = HPX_MOVE(e);
+        modified_ = true;
+    }
+
+    void module_cache::save() const
+    {
+        if (!modified_ || filename_.empty())
+            return;
+
+        // write to a temporary file first to avoid other processes observing
+        // a partially written cache
+        std::string const tmp_filename = filename_ + ".tmp" +
+            std::to_string(
+                std::chrono::steady_clock::now().time_since_epoch().count());
+        {
+            std::ofstream out(tmp_filename);
+            if (!out)
+            {
+                LRT_(info).format(
+                    "couldn't write module cache: {}", tmp_filename);
+                return;
+            }
+
+            out << module_cache_prefix << hpx::full_version_as_string()
+                << "\n";
+            for (auto const& [path, e] : entries_)
+            {
+                out << module_cache_module << (e.has_components ? "c" : "")
+                    << (e.has_plugins ? "p" : "") << "|" << e.size << "|"
+                    << e.mtime << "|" << path << "\n";
+                for (std::string const& line : e.ini_data)
+                {
+                    out << module_cache_ini << line << "\n";
+                }
+            }
+        }
+
+        if (std::rename(tmp_filename.c_str(), filename_.c_str()) != 0)
+        {
+            LRT_(info).format("couldn't write module cache: {}", filename_);
+            std::remove(tmp_filename.c_str());
+        }
+    }
+
     namespace detail {
         inline bool cmppath_less(
             std::pair<filesystem::path, std::string> const& lhs,
@@ -393,7 +585,8 @@ namespace hpx::util {
         std::map<std::string, filesystem::path>& basenames,
         std::map<std::string, hpx::util::plugin::dll>& modules,
         std::vector<std::shared_ptr<components::component_registry_base>>&
-            component_registries)
+            component_registries,
+        module_cache* cache)
     {
         namespace fs = filesystem;
 
@@ -488,6 +681,41 @@ namespace hpx::util {
 
         for (auto const& p : libdata)
         {
+            // libraries described by the module cache don't need to be loaded,
+            // unless they expose plugins
+            if (cache != nullptr)
+            {
+                module_cache::entry const* e = cache->find(p.first);
+                if (e != nullptr && !e->has_plugins)
+                {
+                    if (e->has_components)
+                    {
+                        LRT_(info).format(
+                            "deferring load (cached): {}", p.first.string());
+
+                        // mark all components of this module to be loaded
+                        // on demand
+                        std::vector<std::string> ini_data;
+                        ini_data.reserve(2 * e->ini_data.size());
+                        for (std::string const& line : e->ini_data)
+                        {
+                            ini_data.push_back(line);
+                            if (!line.empty() && line[0] == '[')
+                                ini_data.emplace_back("on_demand = 1");
+                        }
+                        ini.parse("<component registry>", ini_data, false,
+                            false);
+                    }
+                    else
+                    {
+                        LRT_(info).format(
+                            "skipping (cached, not an HPX module): {}",
+                            p.first.string());
+                    }
+                    continue;
+                }
+            }
+
             LRT_(info).format("attempting to load: {}", p.first.string());
 
             // get the handle of the library
@@ -502,11 +730,12 @@ namespace hpx::util {
             }
 
             bool must_keep_loaded = false;
+            module_cache::entry cache_entry;
 
             // get the component factory
             std::string curr_fullname(p.first.parent_path().string());
-            load_component_factory(
-                d, ini, curr_fullname, component_registries, p.second, ec);
+            load_component_factory(d, ini, curr_fullname, component_registries,
+                p.second, ec, &cache_entry.ini_data);
             if (ec)
             {
                 LRT_(info).format(
@@ -519,6 +748,7 @@ namespace hpx::util {
                 LRT_(debug).format(
                     "load_component_factory succeeded: {}", p.first.string());
                 must_keep_loaded = true;
+                cache_entry.has_components = true;
             }
 
             // get the plugin factory
@@ -536,11 +766,17 @@ namespace hpx::util {
                 LRT_(debug).format(
                     "load_plugin_factory succeeded: {}", p.first.string());
 
+                cache_entry.has_plugins = !tmp_regs.empty();
                 std::copy(tmp_regs.begin(), tmp_regs.end(),
                     std::back_inserter(plugin_registries));
                 must_keep_loaded = true;
             }
 
+            if (cache != nullptr)
+            {
+                cache->update(p.first, HPX_MOVE(cache_entry));
+            }
+
             // store loaded library for future use
             if (must_keep_loaded)
             {
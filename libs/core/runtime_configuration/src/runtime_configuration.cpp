@@ -116,6 +116,9 @@ namespace hpx::util {
 #ifdef HPX_HAVE_ITTNOTIFY
             "use_itt_notify = ${HPX_HAVE_ITTNOTIFY:0}",
 #endif
+            "load_modules_on_demand = ${HPX_LOAD_MODULES_ON_DEMAND:0}",
+            "module_cache = ${HPX_MODULE_CACHE}",
+            "startup_timings = ${HPX_STARTUP_TIMINGS:0}",
             "finalize_wait_time = ${HPX_FINALIZE_WAIT_TIME:-1.0}",
             "shutdown_timeout = ${HPX_SHUTDOWN_TIMEOUT:-1.0}",
             "shutdown_check_count = ${HPX_SHUTDOWN_CHECK_COUNT:10}",
@@ -196,6 +199,12 @@ namespace hpx::util {
             "[hpx.on_startup]",
             "wait_on_latch = ${HPX_ON_STARTUP_WAIT_ON_LATCH}",
 
+            // built-in task profiler, enabled if a destination is given
+            "[hpx.profile]",
+            "destination = ${HPX_PROFILE_DESTINATION}",
+            "interval = ${HPX_PROFILE_INTERVAL:1000}",
+            "max_events = ${HPX_PROFILE_MAX_EVENTS:16384}",
+
 #if defined(HPX_HAVE_NETWORKING)
             // by default, enable networking
             "[hpx.parcel]",
@@ -545,7 +554,8 @@ namespace hpx::util {
         std::vector<std::shared_ptr<components::component_registry_base>>&
             component_registries,
         std::string const& path, std::set<std::string>& component_paths,
-        std::map<std::string, filesystem::path>& basenames)
+        std::map<std::string, filesystem::path>& basenames,
+        module_cache* cache)
     {
         namespace fs = filesystem;
 
@@ -571,7 +581,7 @@ namespace hpx::util {
                 {
                     plugin_list_type tmp_regs =
                         util::init_ini_data_default(this_path.string(), *this,
-                            basenames, modules_, component_registries);
+                            basenames, modules_, component_registries, cache);
 
                     std::copy(tmp_regs.begin(), tmp_regs.end(),
                         std::back_inserter(plugin_registries));
@@ -588,7 +598,8 @@ namespace hpx::util {
         std::string const& component_base_paths,
         std::string const& component_path_suffixes,
         std::set<std::string>& component_paths,
-        std::map<std::string, filesystem::path>& basenames)
+        std::map<std::string, filesystem::path>& basenames,
+        module_cache* cache)
     {
         namespace fs = filesystem;
 
@@ -612,13 +623,13 @@ namespace hpx::util {
                     std::string p = path;
                     p += *jt;
                     load_component_path(plugin_registries, component_registries,
-                        p, component_paths, basenames);
+                        p, component_paths, basenames, cache);
                 }
             }
             else
             {
                 load_component_path(plugin_registries, component_registries,
-                    path, component_paths, basenames);
+                    path, component_paths, basenames, cache);
             }
         }
     }
@@ -647,14 +658,32 @@ namespace hpx::util {
         std::string const component_path_suffixes(
             get_entry("hpx.component_path_suffixes", "/lib/hpx"));
 
+        // if modules are loaded on demand, use the cached module metadata
+        // to avoid loading all libraries during module discovery
+        std::unique_ptr<module_cache> cache;
+        if (get_entry("hpx.load_modules_on_demand", "0") == "1")
+        {
+            std::string filename(get_entry("hpx.module_cache", ""));
+            if (filename.empty())
+            {
+                if (char const* home = std::getenv("HOME"))
+                    filename = std::string(home) + "/.hpx_module_cache";
+            }
+            if (!filename.empty())
+                cache = std::make_unique<module_cache>(HPX_MOVE(filename));
+        }
+
         load_component_paths(plugin_registries, component_registries,
             component_base_paths, component_path_suffixes, component_paths,
-            basenames);
+            basenames, cache.get());
 
         // load additional explicit plugin paths from plugin_paths key
         std::string const plugin_paths(get_entry("hpx.component_paths", ""));
         load_component_paths(plugin_registries, component_registries,
-            plugin_paths, "", component_paths, basenames);
+            plugin_paths, "", component_paths, basenames, cache.get());
+
+        if (cache)
+            cache->save();
 
         // read system and user ini files _again_, to allow the user to
         // overwrite the settings from the default component ini's.
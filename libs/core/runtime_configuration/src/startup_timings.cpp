@@ -0,0 +1,87 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
+
+#include <chrono>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util {
+
+    namespace {
+
+        struct startup_timings_data
+        {
+            std::mutex mtx_;
+            std::chrono::steady_clock::time_point last_ =
+                std::chrono::steady_clock::now();
+            std::vector<std::pair<std::string, double>> stages_;
+        };
+
+        startup_timings_data& startup_timings()
+        {
+            static startup_timings_data data;
+            return data;
+        }
+    }    // namespace
+
+    void reset_startup_timings()
+    {
+        auto& data = startup_timings();
+
+        std::lock_guard<std::mutex> l(data.mtx_);
+        data.last_ = std::chrono::steady_clock::now();
+        data.stages_.clear();
+    }
+
+    void mark_startup_stage(std::string name)
+    {
+        auto& data = startup_timings();
+        auto const now = std::chrono::steady_clock::now();
+
+        double elapsed = 0.0;
+        {
+            std::lock_guard<std::mutex> l(data.mtx_);
+            elapsed = std::chrono::duration<double>(now - data.last_).count();
+            data.last_ = now;
+            data.stages_.emplace_back(name, elapsed);
+        }
+
+        LBT_(info).format("startup stage '{}' took {} [s]", name, elapsed);
+    }
+
+    std::vector<std::pair<std::string, double>> get_startup_timings()
+    {
+        auto& data = startup_timings();
+
+        std::lock_guard<std::mutex> l(data.mtx_);
+        return data.stages_;
+    }
+
+    void print_startup_timings(std::ostream& os)
+    {
+        std::vector<std::pair<std::string, double>> const stages =
+            get_startup_timings();
+
+        double total = 0.0;
+        os << "startup timings:\n";
+        for (auto const& [name, elapsed] : stages)
+        {
+            hpx::util::format_to(os, "  {:-24} {:.6f} [s]\n", name, elapsed);
+            total += elapsed;
+        }
+        hpx::util::format_to(
+            os, "  {:-24} {:.6f} [s]\n", std::string("total"), total);
+    }
+}    // namespace hpx::util
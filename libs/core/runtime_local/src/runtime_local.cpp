@@ -21,6 +21,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/threadmanager.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime_local/custom_exception_info.hpp>
 #include <hpx/runtime_local/debugging.hpp>
@@ -36,6 +37,7 @@
 #include <hpx/thread_support/set_thread_name.hpp>
 #include <hpx/threading_base/external_timer.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
+#include <hpx/threading_base/task_profiler.hpp>
 #include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/topology/topology.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -44,6 +46,7 @@
 #include <hpx/version.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <csignal>
 #include <cstddef>
@@ -485,6 +488,19 @@ namespace hpx {
             // this initializes the used_processing_units_ mask
             thread_manager_->init();
 
+            // start the built-in task profiler, if requested
+            if (!hpx::util::get_entry_as<std::string>(
+                    rtcfg_, "hpx.profile.destination", "")
+                    .empty())
+            {
+                threads::task_profiler::start(rtcfg_.get_os_thread_count(),
+                    std::chrono::microseconds(
+                        hpx::util::get_entry_as<std::int64_t>(
+                            rtcfg_, "hpx.profile.interval", 1000)),
+                    hpx::util::get_entry_as<std::size_t>(
+                        rtcfg_, "hpx.profile.max_events", 16384));
+            }
+
             // copy over all startup functions registered so far
             for (startup_function_type& f :
                 detail::global_pre_startup_functions())
@@ -537,6 +553,28 @@ namespace hpx {
 #ifdef HPX_HAVE_IO_POOL
         io_pool_->stop();
 #endif
+
+        // write the profile collected by the built-in task profiler
+        if (std::string const destination =
+                hpx::util::get_entry_as<std::string>(
+                    rtcfg_, "hpx.profile.destination", "");
+            !destination.empty())
+        {
+            threads::task_profiler::stop();
+            try
+            {
+                threads::task_profiler::write(
+                    threads::task_profiler::get_filename(destination,
+                        hpx::util::get_entry_as<std::uint32_t>(
+                            rtcfg_, "hpx.locality", 0)));
+            }
+            catch (std::exception const& e)
+            {
+                std::cerr << "runtime_local: failed to write task profile: "
+                          << e.what() << "\n";
+            }
+        }
+
         LRT_(debug).format("~runtime_local(finished)");
 
         LPROGRESS_;
@@ -1413,21 +1451,32 @@ namespace hpx {
 
             if (call_startup)
             {
+                util::mark_startup_stage("runtime start");
+
                 call_startup_functions(true);
                 HPX_UNUSED(lbt_
                     << "(3rd stage, local) runtime::run_helper: ran "
                        "pre-startup functions");
+                util::mark_startup_stage("pre-startup functions");
 
                 call_startup_functions(false);
                 HPX_UNUSED(lbt_
                     << "(4th stage, local) runtime::run_helper: ran startup "
                        "functions");
+                util::mark_startup_stage("startup functions");
             }
 
             HPX_UNUSED(lbt_ << "(4th stage, local) runtime::run_helper: "
                                "bootstrap complete");
             set_state(hpx::state::running);
 
+            // print the time spent in each of the startup stages, if requested
+            if (get_config().get_entry("hpx.startup_timings", "0") == "1")
+            {
+                util::print_startup_timings(std::cout);
+                std::cout << std::flush;
+            }
+
             // Now, execute the user supplied thread function (hpx_main)
             if (!!func)
             {
@@ -18,10 +18,14 @@
 #endif
 
 #include <hpx/allocator_support/aligned_allocator.hpp>
+#include <hpx/coroutines/thread_id_type.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 
 // Does not rely on CXX11_STD_ATOMIC_128BIT
+#include <hpx/concurrency/chase_lev_deque.hpp>
 #include <hpx/concurrency/concurrentqueue.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <type_traits>
@@ -351,4 +355,189 @@ namespace hpx::threads::policies {
     };
 
 #endif    // HPX_HAVE_CXX11_STD_ATOMIC_128BIT
+
+    ////////////////////////////////////////////////////////////////////////////
+    // LIFO for the owning worker thread, FIFO stealing at the opposite end,
+    // based on the Chase-Lev work-stealing deque.
+    namespace detail {
+
+        // The Chase-Lev deque can hold trivially copyable items only, thread
+        // references are stored as raw pointers holding on to the reference
+        // count.
+        template <typename T>
+        struct chase_lev_item
+        {
+            using storage_type = T;
+
+            static storage_type store(T const& val) noexcept
+            {
+                return val;
+            }
+
+            static void load(T& val, storage_type item) noexcept
+            {
+                val = item;
+            }
+        };
+
+        template <>
+        struct chase_lev_item<thread_id_ref>
+        {
+            using storage_type = thread_id_ref::thread_repr*;
+
+            static storage_type store(thread_id_ref const& val) noexcept
+            {
+                return thread_id_ref(val).detach();
+            }
+
+            static storage_type store(thread_id_ref&& val) noexcept
+            {
+                return val.detach();
+            }
+
+            static void load(thread_id_ref& val, storage_type item) noexcept
+            {
+                val.reset(item, false);    // do not addref!
+            }
+        };
+    }    // namespace detail
+
+    struct lockfree_chase_lev;
+
+    template <typename T>
+    struct lockfree_chase_lev_backend
+    {
+        using item_type = detail::chase_lev_item<T>;
+        using container_type =
+            hpx::lockfree::chase_lev_deque<typename item_type::storage_type>;
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+        static constexpr bool support_bulk_dequeue = false;
+
+        // The owner polls the items pushed by other threads first every so
+        // many pops to prevent those from starving.
+        static constexpr std::uint32_t inbox_poll_interval = 64;
+
+        explicit lockfree_chase_lev_backend(size_type initial_size = 0,
+            size_type /* num_thread */ = static_cast<size_type>(-1))
+          : queue_(static_cast<std::size_t>(initial_size))
+          , inbox_(static_cast<std::size_t>(initial_size))
+        {
+        }
+
+        lockfree_chase_lev_backend(lockfree_chase_lev_backend const&) = delete;
+        lockfree_chase_lev_backend(lockfree_chase_lev_backend&&) = delete;
+        lockfree_chase_lev_backend& operator=(
+            lockfree_chase_lev_backend const&) = delete;
+        lockfree_chase_lev_backend& operator=(
+            lockfree_chase_lev_backend&&) = delete;
+
+        ~lockfree_chase_lev_backend()
+        {
+            // release the items which are still stored in the queue
+            value_type val;
+            while (pop(val))
+            {
+            }
+        }
+
+        // Only the worker thread owning this queue pushes to the deque, all
+        // other threads (and items pushed to the other end) go through the
+        // inbox.
+        bool push(const_reference val, bool other_end = false)    //-V659
+        {
+            if (!other_end && is_owner())
+            {
+                queue_.push_bottom(item_type::store(val));
+                return true;
+            }
+            return inbox_.enqueue(item_type::store(val));
+        }
+
+        bool push(rvalue_reference val, bool other_end = false)    //-V659
+        {
+            if (!other_end && is_owner())
+            {
+                queue_.push_bottom(item_type::store(HPX_MOVE(val)));
+                return true;
+            }
+            return inbox_.enqueue(item_type::store(HPX_MOVE(val)));
+        }
+
+        // The first worker thread popping from this queue without stealing
+        // becomes its owner.
+        bool pop(reference val, bool steal = true) noexcept
+        {
+            typename item_type::storage_type item;
+            if (!steal && (is_owner() || become_owner()))
+            {
+                if (++pop_count_ % inbox_poll_interval == 0 &&
+                    inbox_.try_dequeue(item))
+                {
+                    item_type::load(val, item);
+                    return true;
+                }
+
+                if (queue_.pop_bottom(item) || inbox_.try_dequeue(item))
+                {
+                    item_type::load(val, item);
+                    return true;
+                }
+                return false;
+            }
+
+            if (queue_.steal(item) || inbox_.try_dequeue(item))
+            {
+                item_type::load(val, item);
+                return true;
+            }
+            return false;
+        }
+
+        bool empty() noexcept
+        {
+            return queue_.empty() && inbox_.size_approx() == 0;
+        }
+
+    private:
+        bool is_owner() const noexcept
+        {
+            std::size_t const owner = owner_.load(std::memory_order_relaxed);
+            return owner != static_cast<std::size_t>(-1) &&
+                owner == hpx::get_worker_thread_num();
+        }
+
+        bool become_owner() noexcept
+        {
+            std::size_t const num_thread = hpx::get_worker_thread_num();
+            if (num_thread == static_cast<std::size_t>(-1))
+            {
+                return false;
+            }
+
+            std::size_t owner = static_cast<std::size_t>(-1);
+            return owner_.compare_exchange_strong(
+                owner, num_thread, std::memory_order_relaxed);
+        }
+
+        container_type queue_;
+        hpx::concurrency::ConcurrentQueue<typename item_type::storage_type>
+            inbox_;
+        std::atomic<std::size_t> owner_{static_cast<std::size_t>(-1)};
+        std::uint32_t pop_count_ = 0;    // accessed by the owner only
+    };
+
+    struct lockfree_chase_lev
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = lockfree_chase_lev_backend<T>;
+        };
+    };
 }    // namespace hpx::threads::policies
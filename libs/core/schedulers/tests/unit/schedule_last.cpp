@@ -105,5 +105,12 @@ int main(int argc, char* argv[])
     }
 #endif
 
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_chase_lev>;
+        test_scheduler<scheduler_type>(argc, argv);
+    }
+
     return hpx::util::report_errors();
 }
@@ -0,0 +1,487 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file combining_tree_barrier.hpp
+/// \page hpx::combining_tree_barrier, hpx::combining_tree_latch
+/// \headerfile hpx/barrier.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/modules/memory.hpp>
+#include <hpx/synchronization/barrier.hpp>
+#include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/thread_support/atomic_count.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/topology/cpu_mask.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A static combining tree of counters. Each core owns a leaf, arrivals
+    // decrement the counter of the leaf of the core they are running on. The
+    // arrival which completes a node signals its parent, thus each inner node
+    // is touched only once per child and phase. The leaves are assigned to
+    // the worker threads in order, such that (with the default thread
+    // affinities) the leaves sharing a parent belong to neighboring cores.
+    //
+    // The capacities of all leaves add up to the expected number of arrivals.
+    // An arrival which finds its leaf already completed moves on to the next
+    // one.
+    class combining_tree
+    {
+    private:
+        static constexpr std::size_t fan_in = 4;
+
+        struct node
+        {
+            std::atomic<std::ptrdiff_t> count{0};
+            std::ptrdiff_t initial = 0;
+            std::size_t parent = 0;
+        };
+
+    public:
+        explicit combining_tree(std::ptrdiff_t expected)
+          : num_leaves_((std::min)(
+                static_cast<std::size_t>(
+                    (std::max)(hpx::threads::hardware_concurrency(), 1U)),
+                static_cast<std::size_t>((std::max)(
+                    expected, static_cast<std::ptrdiff_t>(1)))))
+        {
+            // the leaves are followed by the inner nodes, level by level, the
+            // root is the last node
+            num_nodes_ = num_leaves_;
+            for (std::size_t n = num_leaves_; n > 1; n = num_parents(n))
+            {
+                num_nodes_ += num_parents(n);
+            }
+
+            nodes_.reset(new util::cache_aligned_data<node>[num_nodes_]);
+
+            std::size_t begin = 0;
+            for (std::size_t n = num_leaves_; n > 1; n = num_parents(n))
+            {
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    nodes_[begin + i].data_.parent = begin + n + i / fan_in;
+                }
+                begin += n;
+            }
+
+            reset(expected);
+        }
+
+        combining_tree(combining_tree const&) = delete;
+        combining_tree(combining_tree&&) = delete;
+        combining_tree& operator=(combining_tree const&) = delete;
+        combining_tree& operator=(combining_tree&&) = delete;
+
+        ~combining_tree() = default;
+
+        // Re-initialize all counters for the given number of arrivals, must
+        // not be called concurrently with arrive.
+        void reset(std::ptrdiff_t expected) noexcept
+        {
+            auto const leaves = static_cast<std::ptrdiff_t>(num_leaves_);
+            for (std::size_t i = 0; i != num_nodes_; ++i)
+            {
+                node& n = nodes_[i].data_;
+                if (i < num_leaves_)
+                {
+                    n.initial = expected / leaves +
+                        (static_cast<std::ptrdiff_t>(i) < expected % leaves);
+                }
+                else
+                {
+                    n.initial = 0;
+                }
+            }
+
+            // children precede their parents, completed subtrees (leaves
+            // without any capacity) are not waited for
+            for (std::size_t i = 0; i != num_nodes_ - 1; ++i)
+            {
+                node const& n = nodes_[i].data_;
+                if (n.initial != 0)
+                {
+                    ++nodes_[n.parent].data_.initial;
+                }
+            }
+
+            for (std::size_t i = 0; i != num_nodes_; ++i)
+            {
+                node& n = nodes_[i].data_;
+                n.count.store(n.initial, std::memory_order_relaxed);
+            }
+        }
+
+        // Returns whether this arrival completed the tree.
+        bool arrive(std::ptrdiff_t update) noexcept
+        {
+            HPX_ASSERT(update > 0);
+
+            bool completed = false;
+            std::size_t leaf = hpx::get_worker_thread_num() % num_leaves_;
+            for (std::size_t i = 0; update != 0 && i != num_leaves_; ++i)
+            {
+                node& n = nodes_[leaf].data_;
+                std::ptrdiff_t count = n.count.load(std::memory_order_relaxed);
+                while (count != 0)
+                {
+                    std::ptrdiff_t const take = (std::min)(count, update);
+                    if (n.count.compare_exchange_weak(count, count - take,
+                            std::memory_order_acq_rel,
+                            std::memory_order_relaxed))
+                    {
+                        update -= take;
+                        if (count == take && signal_parent(leaf))
+                        {
+                            completed = true;
+                        }
+                        break;
+                    }
+                }
+
+                if (++leaf == num_leaves_)
+                {
+                    leaf = 0;
+                }
+            }
+
+            // the arrivals exceeded the expected count
+            HPX_ASSERT(update == 0);
+            return completed;
+        }
+
+    private:
+        static constexpr std::size_t num_parents(std::size_t n) noexcept
+        {
+            return (n + fan_in - 1) / fan_in;
+        }
+
+        bool signal_parent(std::size_t i) noexcept
+        {
+            while (i != num_nodes_ - 1)
+            {
+                i = nodes_[i].data_.parent;
+                if (nodes_[i].data_.count.fetch_sub(
+                        1, std::memory_order_acq_rel) != 1)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        std::size_t num_leaves_;
+        std::size_t num_nodes_ = 0;
+        std::unique_ptr<util::cache_aligned_data<node>[]> nodes_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Waiters spin on the phase counter for a while before suspending on the
+    // condition variable. The completing thread takes the lock only if
+    // somebody has gone to sleep. The state is reference counted as the
+    // completing thread may still be waking up sleepers after the last
+    // waiter has returned (and possibly destroyed the barrier).
+    struct combining_tree_wait_state
+    {
+        using mutex_type = hpx::spinlock;
+
+        // the number of calls to yield_k before suspending
+        static constexpr std::size_t spin_count = 32;
+
+        combining_tree_wait_state() noexcept
+          : count_(1)
+        {
+        }
+
+        combining_tree_wait_state(combining_tree_wait_state const&) = delete;
+        combining_tree_wait_state(combining_tree_wait_state&&) = delete;
+        combining_tree_wait_state& operator=(
+            combining_tree_wait_state const&) = delete;
+        combining_tree_wait_state& operator=(
+            combining_tree_wait_state&&) = delete;
+
+        ~combining_tree_wait_state() = default;
+
+        [[nodiscard]] std::size_t phase() const noexcept
+        {
+            return phase_.data_.load(std::memory_order_acquire);
+        }
+
+        void wait(std::size_t old_phase, char const* desc)
+        {
+            for (std::size_t k = 0; k != spin_count; ++k)
+            {
+                if (phase() != old_phase)
+                {
+                    return;
+                }
+                util::detail::yield_k(k, desc);
+            }
+
+            std::unique_lock<mutex_type> l(mtx_);
+            sleepers_.fetch_add(1, std::memory_order_seq_cst);
+            while (phase_.data_.load(std::memory_order_seq_cst) == old_phase)
+            {
+                cond_.wait(l, desc);
+            }
+            sleepers_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        // Start the next phase, all effects of the calling thread happen
+        // before the returns from wait for the completed phase.
+        void advance()
+        {
+            phase_.data_.fetch_add(1, std::memory_order_seq_cst);
+            if (sleepers_.load(std::memory_order_seq_cst) != 0)
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+                cond_.notify_all(HPX_MOVE(l));
+            }
+        }
+
+    private:
+        friend void intrusive_ptr_add_ref(combining_tree_wait_state* p) noexcept
+        {
+            ++p->count_;
+        }
+
+        friend void intrusive_ptr_release(combining_tree_wait_state* p) noexcept
+        {
+            if (0 == --p->count_)
+            {
+                delete p;
+            }
+        }
+
+        util::cache_aligned_data<std::atomic<std::size_t>> phase_{0};
+        std::atomic<std::size_t> sleepers_{0};
+
+        mutable mutex_type mtx_;
+        hpx::lcos::local::detail::condition_variable cond_;
+
+        hpx::util::atomic_count count_;
+    };
+}    // namespace hpx::detail
+
+namespace hpx {
+
+    /// The \a combining_tree_barrier is a drop-in replacement for \a
+    /// hpx::barrier intended for large numbers of participants. It provides
+    /// the same interface and guarantees as \a hpx::barrier.
+    ///
+    /// \details Arrivals are counted in a tree of counters shaped after the
+    ///          cores of the machine: each core owns a leaf, every inner node
+    ///          combines up to four children. Concurrent arrivals on
+    ///          different cores therefore do not contend on a single cache
+    ///          line, only the last arrival at a node propagates to its
+    ///          parent. Waiting threads spin on the phase counter for a
+    ///          short while before suspending. The completion function is
+    ///          run by the arrival that completes the phase.
+    template <typename OnCompletion = detail::empty_oncompletion>
+    class combining_tree_barrier
+    {
+    public:
+        /// \cond NOINTERNAL
+        combining_tree_barrier(combining_tree_barrier const&) = delete;
+        combining_tree_barrier(combining_tree_barrier&&) = delete;
+        combining_tree_barrier& operator=(
+            combining_tree_barrier const&) = delete;
+        combining_tree_barrier& operator=(combining_tree_barrier&&) = delete;
+        /// \endcond
+
+        using arrival_token = std::size_t;
+
+        /// Returns:        The maximum expected count that the implementation
+        ///                 supports.
+        static constexpr std::ptrdiff_t(max)() noexcept
+        {
+            return (std::numeric_limits<std::ptrdiff_t>::max)();
+        }
+
+        /// Preconditions:  expected >= 0 is true and expected <= max() is true.
+        ///
+        /// Effects:        Sets both the initial expected count for each
+        ///                 barrier phase and the current expected count for the
+        ///                 first phase to expected. Initializes completion with
+        ///                 std::move(f). Starts the first phase.
+        explicit combining_tree_barrier(
+            std::ptrdiff_t expected, OnCompletion completion = OnCompletion())
+          : state_(new detail::combining_tree_wait_state(), false)
+          , tree_(expected)
+          , expected_(expected)
+          , completion_(HPX_MOVE(completion))
+        {
+            // different versions of clang-format disagree
+            // clang-format off
+            HPX_ASSERT(expected >= 0 && expected <= (max)());
+            // clang-format on
+        }
+
+        ~combining_tree_barrier() = default;
+
+        /// Decrements the expected count of the current phase by update and
+        /// returns a token associated with the current phase. The call which
+        /// decrements the expected count to zero runs the completion step.
+        [[nodiscard]] arrival_token arrive(std::ptrdiff_t update = 1)
+        {
+            // the phase can't complete before this arrival has been counted
+            arrival_token const old_phase = state_->phase();
+            if (tree_.arrive(update))
+            {
+                complete();
+            }
+            return old_phase;
+        }
+
+        /// Blocks until the phase associated with the given token has
+        /// completed.
+        void wait(arrival_token&& old_phase) const
+        {
+            if (state_->phase() != old_phase)
+            {
+                return;
+            }
+
+            auto const state = state_;    // keep alive
+            state->wait(old_phase, "combining_tree_barrier::wait");
+        }
+
+        /// Effects:        Equivalent to: wait(arrive()).
+        void arrive_and_wait()
+        {
+            wait(arrive());
+        }
+
+        /// Decrements the initial expected count for all subsequent phases by
+        /// one, then decrements the expected count for the current phase by
+        /// one.
+        void arrive_and_drop()
+        {
+            // the arrival publishes the drop to the completing thread
+            dropped_.data_.fetch_add(1, std::memory_order_relaxed);
+            [[maybe_unused]] arrival_token const old_phase = arrive();
+        }
+
+    private:
+        void complete()
+        {
+            auto const state = state_;    // keep alive
+
+            completion_();
+
+            expected_ -= dropped_.data_.exchange(0, std::memory_order_relaxed);
+            HPX_ASSERT(expected_ >= 0);
+            tree_.reset(expected_);
+
+            state->advance();
+        }
+
+        hpx::intrusive_ptr<detail::combining_tree_wait_state> state_;
+        detail::combining_tree tree_;
+
+        util::cache_aligned_data<std::atomic<std::ptrdiff_t>> dropped_{0};
+        std::ptrdiff_t expected_;
+        OnCompletion completion_;
+    };
+
+    /// The \a combining_tree_latch is a drop-in replacement for \a hpx::latch
+    /// intended for large numbers of participants. It provides the same
+    /// interface and guarantees as \a hpx::latch.
+    ///
+    /// \details Calls to count_down are combined in a tree of counters
+    ///          shaped after the cores of the machine, see \a
+    ///          combining_tree_barrier.
+    class combining_tree_latch
+    {
+    public:
+        /// \cond NOINTERNAL
+        combining_tree_latch(combining_tree_latch const&) = delete;
+        combining_tree_latch(combining_tree_latch&&) = delete;
+        combining_tree_latch& operator=(combining_tree_latch const&) = delete;
+        combining_tree_latch& operator=(combining_tree_latch&&) = delete;
+        /// \endcond
+
+        /// Returns:        The maximum value of counter that the implementation
+        ///                 supports.
+        static constexpr std::ptrdiff_t(max)() noexcept
+        {
+            return (std::numeric_limits<std::ptrdiff_t>::max)();
+        }
+
+        /// Initialize the latch with the given expected count.
+        ///
+        /// Requires: count >= 0.
+        explicit combining_tree_latch(std::ptrdiff_t count)
+          : state_(new detail::combining_tree_wait_state(), false)
+          , tree_(count)
+        {
+            HPX_ASSERT(count >= 0);
+            if (count == 0)
+            {
+                state_->advance();
+            }
+        }
+
+        ~combining_tree_latch() = default;
+
+        /// Decrements the counter by update, releases all waiting threads
+        /// if the counter reaches zero.
+        ///
+        /// Requires: update >= 0 and update <= the current counter value.
+        void count_down(std::ptrdiff_t update)
+        {
+            if (update != 0 && tree_.arrive(update))
+            {
+                auto const state = state_;    // keep alive
+                state->advance();
+            }
+        }
+
+        /// Returns: true if the counter has reached zero.
+        [[nodiscard]] bool try_wait() const noexcept
+        {
+            return state_->phase() != 0;
+        }
+
+        /// Blocks until the counter has reached zero.
+        void wait() const
+        {
+            if (try_wait())
+            {
+                return;
+            }
+
+            auto const state = state_;    // keep alive
+            state->wait(0, "combining_tree_latch::wait");
+        }
+
+        /// Effects: Equivalent to: count_down(update); wait();
+        void arrive_and_wait(std::ptrdiff_t update = 1)
+        {
+            count_down(update);
+            wait();
+        }
+
+    private:
+        hpx::intrusive_ptr<detail::combining_tree_wait_state> state_;
+        detail::combining_tree tree_;
+    };
+}    // namespace hpx
@@ -0,0 +1,207 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file reader_biased_shared_mutex.hpp
+/// \page hpx::reader_biased_shared_mutex
+/// \headerfile hpx/shared_mutex.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/synchronization/shared_mutex.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/topology/cpu_mask.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+namespace hpx::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Readers announce themselves by incrementing a counter which is private
+    // to the worker thread they are running on, so concurrent readers don't
+    // write to the same cache line. A reader may be unlocked on a different
+    // worker thread than it was locked on, thus only the sum of all counters
+    // is meaningful.
+    //
+    // Writers are serialized through the underlying shared mutex. Once a
+    // writer owns it, it revokes the fast path for readers and waits for the
+    // sum of all counters to drop to zero. Readers which find the fast path
+    // revoked acquire the underlying shared mutex in shared mode, which blocks
+    // them until the writer has released the lock.
+    template <typename SharedMutex = hpx::shared_mutex>
+    class reader_biased_shared_mutex
+    {
+    private:
+        using mutex_type = SharedMutex;
+        using counter_type = std::atomic<std::int64_t>;
+
+    public:
+        reader_biased_shared_mutex()
+          : num_counters_(
+                (std::max)(hpx::threads::hardware_concurrency(), 1U))
+          , counters_(
+                new util::cache_aligned_data<counter_type>[num_counters_])
+        {
+            for (std::size_t i = 0; i != num_counters_; ++i)
+            {
+                counters_[i].data_.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        reader_biased_shared_mutex(reader_biased_shared_mutex const&) = delete;
+        reader_biased_shared_mutex(reader_biased_shared_mutex&&) = delete;
+        reader_biased_shared_mutex& operator=(
+            reader_biased_shared_mutex const&) = delete;
+        reader_biased_shared_mutex& operator=(
+            reader_biased_shared_mutex&&) = delete;
+
+        ~reader_biased_shared_mutex()
+        {
+            HPX_ASSERT(num_readers() == 0);
+        }
+
+        void lock_shared()
+        {
+            if (try_lock_shared_fast())
+            {
+                return;
+            }
+
+            // a writer is active, wait for it to release the lock
+            std::shared_lock<mutex_type> l(mtx_.data_);
+            counter().fetch_add(1, std::memory_order_relaxed);
+        }
+
+        bool try_lock_shared()
+        {
+            if (try_lock_shared_fast())
+            {
+                return true;
+            }
+
+            std::shared_lock<mutex_type> l(mtx_.data_, std::try_to_lock);
+            if (!l.owns_lock())
+            {
+                return false;
+            }
+            counter().fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        void unlock_shared()
+        {
+            counter().fetch_sub(1, std::memory_order_release);
+        }
+
+        void lock()
+        {
+            mtx_.data_.lock();
+
+            // no new readers can enter through the fast path from now on,
+            // wait for the ones that have already entered to leave
+            writer_active_.data_.store(true, std::memory_order_seq_cst);
+            util::yield_while([this]() { return num_readers() != 0; },
+                "hpx::reader_biased_shared_mutex::lock");
+        }
+
+        bool try_lock()
+        {
+            if (!mtx_.data_.try_lock())
+            {
+                return false;
+            }
+
+            writer_active_.data_.store(true, std::memory_order_seq_cst);
+            if (num_readers() != 0)
+            {
+                writer_active_.data_.store(false, std::memory_order_release);
+                mtx_.data_.unlock();
+                return false;
+            }
+            return true;
+        }
+
+        void unlock()
+        {
+            writer_active_.data_.store(false, std::memory_order_release);
+            mtx_.data_.unlock();
+        }
+
+    private:
+        counter_type& counter() const noexcept
+        {
+            // threads which are not HPX worker threads return -1, any counter
+            // will do
+            return counters_[hpx::get_worker_thread_num() % num_counters_]
+                .data_;
+        }
+
+        bool try_lock_shared_fast()
+        {
+            if (writer_active_.data_.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            // Announce the reader before checking for writers again. Either
+            // the writer sees the incremented counter or this thread sees the
+            // writer, both operations have to be sequentially consistent.
+            counter_type& c = counter();
+            c.fetch_add(1, std::memory_order_seq_cst);
+            if (!writer_active_.data_.load(std::memory_order_seq_cst))
+            {
+                return true;
+            }
+
+            c.fetch_sub(1, std::memory_order_release);
+            return false;
+        }
+
+        std::int64_t num_readers() const noexcept
+        {
+            std::int64_t count = 0;
+            for (std::size_t i = 0; i != num_counters_; ++i)
+            {
+                count += counters_[i].data_.load(std::memory_order_seq_cst);
+            }
+            return count;
+        }
+
+        std::size_t num_counters_;
+        std::unique_ptr<util::cache_aligned_data<counter_type>[]> counters_;
+
+        util::cache_aligned_data<std::atomic<bool>> writer_active_{false};
+        util::cache_aligned_data<mutex_type> mtx_;
+    };
+}    // namespace hpx::detail
+
+namespace hpx {
+
+    /// The \a reader_biased_shared_mutex class is a shared mutex optimized for
+    /// read-mostly workloads. It can be used wherever a \a hpx::shared_mutex
+    /// is used in shared or exclusive mode (it satisfies the requirements of
+    /// \a SharedLockable), but does not support upgrade locks.
+    ///
+    /// \details Acquiring and releasing the shared lock modifies only a
+    ///          counter which is private to the calling worker thread, thus
+    ///          readers running on different cores do not contend with each
+    ///          other. The price is paid by writers: acquiring the exclusive
+    ///          lock requires visiting the counters of all cores. Each
+    ///          instance occupies one cache line per core, which makes this
+    ///          mutex suitable for long lived data structures, such as
+    ///          caches, which are read much more often than they are
+    ///          modified.
+    using reader_biased_shared_mutex = detail::reader_biased_shared_mutex<>;
+}    // namespace hpx
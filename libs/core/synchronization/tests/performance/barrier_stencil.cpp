@@ -0,0 +1,132 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Phase-synchronized 1D heat stencil: each participant owns a partition of
+// the grid and synchronizes with all others through a barrier after each
+// time step. Compares hpx::barrier with hpx::combining_tree_barrier.
+
+#include <hpx/barrier.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/program_options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Barrier>
+double run_stencil(std::size_t participants, std::size_t partition_size,
+    std::size_t steps)
+{
+    std::size_t const size = participants * partition_size;
+    std::vector<double> grid[2] = {
+        std::vector<double>(size, 0.0), std::vector<double>(size, 0.0)};
+    grid[0][size / 2] = 1.0;
+
+    Barrier b(static_cast<std::ptrdiff_t>(participants));
+
+    auto worker = [&](std::size_t p) {
+        std::size_t const begin = p * partition_size;
+        std::size_t const end = begin + partition_size;
+        for (std::size_t t = 0; t != steps; ++t)
+        {
+            std::vector<double> const& current = grid[t % 2];
+            std::vector<double>& next = grid[(t + 1) % 2];
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                double const left = current[(i + size - 1) % size];
+                double const right = current[(i + 1) % size];
+                next[i] = current[i] + 0.25 * (left - 2 * current[i] + right);
+            }
+            b.arrive_and_wait();
+        }
+    };
+
+    std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+    std::vector<hpx::future<void>> results;
+    results.reserve(participants - 1);
+    for (std::size_t p = 1; p != participants; ++p)
+    {
+        results.push_back(hpx::async(worker, p));
+    }
+    worker(0);
+    hpx::wait_all(results);
+
+    return static_cast<double>(
+               hpx::chrono::high_resolution_clock::now() - start) /
+        1e9;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t participants = vm["participants"].as<std::size_t>();
+    if (participants == 0)
+    {
+        participants = hpx::get_os_thread_count();
+    }
+    std::size_t const partition_size = vm["partition_size"].as<std::size_t>();
+    std::size_t const steps = vm["steps"].as<std::size_t>();
+    int const test_count = vm["test_count"].as<int>();
+
+    double barrier_time = 0.0;
+    double combining_tree_time = 0.0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        barrier_time +=
+            run_stencil<hpx::barrier<>>(participants, partition_size, steps);
+        combining_tree_time += run_stencil<hpx::combining_tree_barrier<>>(
+            participants, partition_size, steps);
+    }
+
+    auto const num_phases = static_cast<double>(steps * test_count);
+    std::cout << "participants: " << participants
+              << ", partition size: " << partition_size << "\n"
+              << "hpx::barrier:                " << barrier_time / test_count
+              << " [s] (" << barrier_time / num_phases * 1e6
+              << " [us/step])\n"
+              << "hpx::combining_tree_barrier: "
+              << combining_tree_time / test_count << " [s] ("
+              << combining_tree_time / num_phases * 1e6 << " [us/step])\n";
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("participants", value<std::size_t>()->default_value(0),
+         "number of tasks synchronizing through the barrier "
+         "(default: number of cores)")
+        ("partition_size", value<std::size_t>()->default_value(1000),
+         "number of grid points updated by each task per step "
+         "(default: 1000)")
+        ("steps", value<std::size_t>()->default_value(10000),
+         "number of time steps (default: 10000)")
+        ("test_count", value<int>()->default_value(5),
+         "number of tests to be averaged (default: 5)")
+        ;
+    // clang-format on
+
+    // By default, this benchmark should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,189 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/barrier.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/async_local.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_barrier_phases()
+{
+    constexpr std::size_t threads = 64;
+    constexpr std::size_t iterations = 100;
+
+    std::atomic<std::size_t> arrived(0);
+    std::atomic<std::size_t> completions(0);
+    std::atomic<std::size_t> errors(0);
+
+    auto on_completion = [&]() noexcept {
+        // all participants have arrived for the current phase
+        if (arrived.load() != (completions.load() + 1) * (threads + 1))
+        {
+            ++errors;
+        }
+        ++completions;
+    };
+
+    hpx::combining_tree_barrier<decltype(on_completion)> b(
+        threads + 1, on_completion);
+
+    auto participant = [&]() {
+        for (std::size_t i = 0; i != iterations; ++i)
+        {
+            ++arrived;
+            b.arrive_and_wait();
+
+            // the completion step has run for this phase
+            if (completions.load() <= i)
+            {
+                ++errors;
+            }
+        }
+    };
+
+    std::vector<hpx::future<void>> results;
+    results.reserve(threads);
+    for (std::size_t i = 0; i != threads; ++i)
+    {
+        results.push_back(hpx::async(participant));
+    }
+    participant();
+
+    hpx::wait_all(results);
+
+    HPX_TEST_EQ(completions.load(), iterations);
+    HPX_TEST_EQ(errors.load(), static_cast<std::size_t>(0));
+}
+
+void test_barrier_arrive_update()
+{
+    hpx::combining_tree_barrier<> b(10);
+
+    // a single arrival may complete the phase
+    auto token = b.arrive(10);
+    b.wait(std::move(token));
+
+    token = b.arrive(7);
+    hpx::future<void> f = hpx::async([&]() { b.arrive_and_wait(); });
+    auto token2 = b.arrive(2);
+    f.get();
+    b.wait(std::move(token));
+    b.wait(std::move(token2));
+}
+
+void test_barrier_arrive_and_drop()
+{
+    constexpr std::size_t threads = 16;
+
+    hpx::combining_tree_barrier<> b(threads + 1);
+
+    std::atomic<std::size_t> count(0);
+    std::vector<hpx::future<void>> results;
+    results.reserve(threads);
+    for (std::size_t i = 0; i != threads; ++i)
+    {
+        // participant i takes part in i + 1 phases
+        results.push_back(hpx::async([&, i]() {
+            for (std::size_t j = 0; j != i; ++j)
+            {
+                ++count;
+                b.arrive_and_wait();
+            }
+            ++count;
+            b.arrive_and_drop();
+        }));
+    }
+
+    for (std::size_t i = 0; i != threads; ++i)
+    {
+        b.arrive_and_wait();
+    }
+    hpx::wait_all(results);
+
+    HPX_TEST_EQ(count.load(), threads * (threads + 1) / 2);
+
+    // only this thread is left
+    b.arrive_and_wait();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_latch()
+{
+    constexpr std::size_t threads = 64;
+
+    hpx::combining_tree_latch l(threads + 1);
+    HPX_TEST(!l.try_wait());
+
+    std::atomic<std::size_t> count(0);
+    std::vector<hpx::future<void>> results;
+    results.reserve(threads);
+    for (std::size_t i = 0; i != threads; ++i)
+    {
+        results.push_back(hpx::async([&]() {
+            ++count;
+            l.arrive_and_wait();
+        }));
+    }
+
+    l.arrive_and_wait();
+    HPX_TEST(l.try_wait());
+    HPX_TEST_EQ(count.load(), threads);
+
+    hpx::wait_all(results);
+}
+
+void test_latch_count_down()
+{
+    hpx::combining_tree_latch l0(0);
+    HPX_TEST(l0.try_wait());
+    l0.wait();
+
+    hpx::combining_tree_latch l(100);
+    hpx::future<void> f = hpx::async([&]() { l.wait(); });
+
+    l.count_down(60);
+    HPX_TEST(!l.try_wait());
+    l.count_down(0);
+    HPX_TEST(!l.try_wait());
+    l.count_down(40);
+    HPX_TEST(l.try_wait());
+
+    f.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_barrier_phases();
+    test_barrier_arrive_update();
+    test_barrier_arrive_and_drop();
+    test_latch();
+    test_latch_count_down();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default, this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
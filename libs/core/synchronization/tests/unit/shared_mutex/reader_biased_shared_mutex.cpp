@@ -0,0 +1,164 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/shared_mutex.hpp>
+#include <hpx/thread.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+using shared_mutex_type = hpx::reader_biased_shared_mutex;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_multiple_readers()
+{
+    shared_mutex_type rw_mutex;
+
+    std::shared_lock<shared_mutex_type> l1(rw_mutex);
+    std::shared_lock<shared_mutex_type> l2(rw_mutex, std::try_to_lock);
+    HPX_TEST(l2.owns_lock());
+
+    // readers may be released on any thread
+    hpx::async([&]() {
+        std::shared_lock<shared_mutex_type> l3(rw_mutex, std::try_to_lock);
+        HPX_TEST(l3.owns_lock());
+        l2.unlock();
+    }).get();
+}
+
+void test_reader_blocks_writer()
+{
+    shared_mutex_type rw_mutex;
+
+    std::shared_lock<shared_mutex_type> l(rw_mutex);
+    HPX_TEST(!rw_mutex.try_lock());
+
+    std::atomic<bool> locked(false);
+    hpx::future<void> writer = hpx::async([&]() {
+        std::unique_lock<shared_mutex_type> l(rw_mutex);
+        locked = true;
+    });
+
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+    HPX_TEST(!locked);
+
+    l.unlock();
+    writer.get();
+    HPX_TEST(locked);
+}
+
+void test_writer_blocks_readers()
+{
+    shared_mutex_type rw_mutex;
+
+    std::unique_lock<shared_mutex_type> l(rw_mutex);
+    HPX_TEST(!rw_mutex.try_lock_shared());
+    HPX_TEST(!rw_mutex.try_lock());
+
+    std::atomic<std::size_t> readers(0);
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        futures.push_back(hpx::async([&]() {
+            std::shared_lock<shared_mutex_type> l(rw_mutex);
+            ++readers;
+        }));
+    }
+
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+    HPX_TEST_EQ(readers.load(), static_cast<std::size_t>(0));
+
+    l.unlock();
+    hpx::wait_all(futures);
+    HPX_TEST_EQ(readers.load(), static_cast<std::size_t>(10));
+
+    // the fast path is available again once the writer has left
+    HPX_TEST(rw_mutex.try_lock_shared());
+    rw_mutex.unlock_shared();
+    HPX_TEST(rw_mutex.try_lock());
+    rw_mutex.unlock();
+}
+
+void test_readers_and_writers()
+{
+    constexpr std::size_t num_tasks = 100;
+    constexpr std::size_t num_iterations = 1000;
+
+    shared_mutex_type rw_mutex;
+
+    // the writers keep both values equal, readers must never observe them
+    // being different
+    std::size_t value1 = 0;
+    std::size_t value2 = 0;
+    std::atomic<std::size_t> mismatches(0);
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async([&, i]() {
+            for (std::size_t j = 0; j != num_iterations; ++j)
+            {
+                if ((i + j) % 10 == 0)
+                {
+                    std::unique_lock<shared_mutex_type> l(rw_mutex);
+                    ++value1;
+                    hpx::this_thread::yield();
+                    ++value2;
+                }
+                else
+                {
+                    std::shared_lock<shared_mutex_type> l(rw_mutex);
+                    std::size_t const v1 = value1;
+                    hpx::this_thread::yield();
+                    if (v1 != value2)
+                    {
+                        ++mismatches;
+                    }
+                }
+            }
+        }));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(mismatches.load(), static_cast<std::size_t>(0));
+    HPX_TEST_EQ(value1, num_tasks * num_iterations / 10);
+    HPX_TEST_EQ(value2, num_tasks * num_iterations / 10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_multiple_readers();
+    test_reader_blocks_writer();
+    test_writer_blocks_readers();
+    test_readers_and_writers();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default, this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
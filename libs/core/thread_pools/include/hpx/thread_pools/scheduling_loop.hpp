@@ -18,6 +18,7 @@
 #include <hpx/threading_base/detail/switch_status.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/task_profiler.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 
 #if defined(HPX_HAVE_ITTNOTIFY) && HPX_HAVE_ITTNOTIFY != 0 &&                  \
@@ -239,6 +240,10 @@ namespace hpx::threads::detail {
                                             idle_rate.collect_exec_time(ts);
                                         });
 #endif
+                                // attribute the elapsed sampling ticks to
+                                // this thread if the task profiler is enabled
+                                task_profiler::scoped_sample sample(thrdptr);
+
 #if defined(HPX_HAVE_APEX)
                                 // get the APEX data pointer, in case we are
                                 // resuming the thread and have to restore any
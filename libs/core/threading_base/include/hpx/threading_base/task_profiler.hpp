@@ -0,0 +1,142 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace hpx::threads::task_profiler {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The built-in task profiler samples the HPX threads executed by the
+    // worker threads. Each worker maintains its own sampling clock which
+    // ticks every \a interval. Whenever an HPX thread returns control to the
+    // scheduling loop, all ticks that elapsed while it was running are
+    // attributed to the annotation (thread_description) the thread reported
+    // at that point. Ticks elapsing while a worker is idle are discarded.
+    //
+    // This makes the overhead independent of the sampling rate: the only
+    // cost for non-sampled executions is reading the clock twice.
+    //
+    // The memory used by the profiler does not grow over time. Each worker
+    // records the sampled executions into a ring buffer of fixed size (only
+    // the most recent executions are kept) and aggregates the samples in a
+    // table of at most \a max_stacks annotations, further annotations are
+    // reported as '<other>'. Only the (interned) annotations are stored, the
+    // task names are generated while writing the profile.
+    //
+    // The profiler is enabled using the command line option --hpx:profile
+    // (or the configuration setting hpx.profile.destination). Task names are
+    // available only if HPX was configured with HPX_WITH_THREAD_DESCRIPTION,
+    // HPX_WITH_THREAD_DEBUG_INFO, or HPX_WITH_APEX.
+
+    /// The number of distinct annotations each worker keeps samples for.
+    inline constexpr std::size_t max_stacks = 256;
+
+    /// The largest number of frames reported for a collapsed stack.
+    inline constexpr std::size_t max_stack_depth = 64;
+
+    /// Start collecting samples for \a num_threads worker threads, each of
+    /// which keeps the \a max_events most recent sampled executions. This
+    /// discards all previously collected samples and must not be called
+    /// while the worker threads are executing HPX threads.
+    HPX_CORE_EXPORT void start(std::size_t num_threads,
+        std::chrono::microseconds interval = std::chrono::microseconds(1000),
+        std::size_t max_events = 16384);
+
+    /// Stop collecting samples. The collected samples are kept until the
+    /// profiler is started again. The samples should be accessed only after
+    /// the worker threads have been stopped.
+    HPX_CORE_EXPORT void stop() noexcept;
+
+    /// Return the overall number of samples collected so far.
+    HPX_CORE_EXPORT std::uint64_t num_samples() noexcept;
+
+    /// Return the number of sampled executions currently kept by all worker
+    /// threads (as written by write_chrome_trace).
+    HPX_CORE_EXPORT std::size_t num_events() noexcept;
+
+    /// Write the collected samples as collapsed stacks, one line per unique
+    /// stack followed by its sample count (as consumed by flamegraph.pl).
+    /// The frames of a stack are the annotations of the sampled thread and
+    /// of its parent threads, from the root to the leaf, separated by ';'.
+    /// Parent threads are known only for the kept executions and only if HPX
+    /// was configured with HPX_WITH_THREAD_DEBUG_INFO or HPX_WITH_APEX. Older
+    /// samples are reported with their own annotation only.
+    HPX_CORE_EXPORT void write_collapsed(std::ostream& os);
+
+    /// Write the sampled task executions in the Chrome trace event format
+    /// (as consumed by chrome://tracing or Perfetto).
+    HPX_CORE_EXPORT void write_chrome_trace(std::ostream& os);
+
+    /// Write the collected samples to the given file. The Chrome trace
+    /// format is used if the file name ends in '.json', collapsed stacks are
+    /// written otherwise.
+    HPX_CORE_EXPORT void write(std::string const& filename);
+
+    /// Return the name of the file the profile of the given locality is
+    /// written to. The locality id and the id of the current process are
+    /// inserted into \a destination (before the extension '.json', if
+    /// present) such that the profiles of different localities and
+    /// processes don't overwrite each other, e.g. 'profile.json' becomes
+    /// 'profile.0.4711.json'.
+    HPX_CORE_EXPORT std::string get_filename(
+        std::string const& destination, std::uint32_t locality_id);
+
+    namespace detail {
+
+        HPX_CORE_EXPORT extern std::atomic<bool> is_running;
+
+        [[nodiscard]] inline std::uint64_t now() noexcept
+        {
+            return static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch())
+                    .count());
+        }
+
+        HPX_CORE_EXPORT void record(thread_data const* thrd,
+            std::uint64_t start, std::uint64_t end) noexcept;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Used by the scheduling loop to bracket the execution of an HPX thread.
+    class [[nodiscard]] scoped_sample
+    {
+    public:
+        explicit scoped_sample(thread_data const* thrd) noexcept
+          : thrd_(detail::is_running.load(std::memory_order_relaxed) ? thrd :
+                                                                       nullptr)
+          , start_(thrd_ != nullptr ? detail::now() : 0)
+        {
+        }
+
+        scoped_sample(scoped_sample const&) = delete;
+        scoped_sample(scoped_sample&&) = delete;
+        scoped_sample& operator=(scoped_sample const&) = delete;
+        scoped_sample& operator=(scoped_sample&&) = delete;
+
+        ~scoped_sample()
+        {
+            if (thrd_ != nullptr)
+            {
+                detail::record(thrd_, start_, detail::now());
+            }
+        }
+
+    private:
+        thread_data const* thrd_;
+        std::uint64_t start_;
+    };
+}    // namespace hpx::threads::task_profiler
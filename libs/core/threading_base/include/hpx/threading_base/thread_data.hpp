@@ -11,6 +11,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 
+#include <hpx/allocator_support/task_arena.hpp>
 #include <hpx/concurrency/spinlock_pool.hpp>
 #include <hpx/coroutines/coroutine.hpp>
 #include <hpx/coroutines/detail/combined_tagged_state.hpp>
@@ -50,6 +51,9 @@ namespace hpx::threads {
         using get_locality_id_type = std::uint32_t(hpx::error_code&);
         HPX_CORE_EXPORT void set_get_locality_id(get_locality_id_type* f);
         HPX_CORE_EXPORT std::uint32_t get_locality_id(hpx::error_code&);
+
+        // Return the arena of the current HPX thread (if any)
+        HPX_CORE_EXPORT hpx::memory::task_arena* get_self_task_arena() noexcept;
     }    // namespace detail
 
     ////////////////////////////////////////////////////////////////////////////
@@ -487,6 +491,13 @@ namespace hpx::threads {
         void run_thread_exit_callbacks();
         void free_thread_exit_callbacks();
 
+        // The arena is used for temporary allocations that do not outlive
+        // this thread, it is reset whenever the thread terminates.
+        hpx::memory::task_arena& get_task_arena() noexcept
+        {
+            return arena_;
+        }
+
         // no need to protect the variables related to scoped children as those
         // are supposed to be accessed by ourselves only
         bool runs_as_child(
@@ -634,6 +645,8 @@ namespace hpx::threads {
 
         void* queue_;
 
+        hpx::memory::task_arena arena_;
+
         ///////////////////////////////////////////////////////////////////////
         // Debugging/logging information
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
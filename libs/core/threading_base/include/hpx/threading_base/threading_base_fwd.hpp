@@ -13,6 +13,7 @@
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/coroutines/thread_id_type.hpp>
 #include <hpx/errors/exception_fwd.hpp>
+#include <hpx/functional/inplace_move_only_function.hpp>
 #include <hpx/functional/move_only_function.hpp>
 
 #include <cstddef>
@@ -54,7 +55,8 @@ namespace hpx::threads {
     using thread_arg_type = thread_restart_state;
 
     using thread_function_sig = thread_result_type(thread_arg_type);
-    using thread_function_type = hpx::move_only_function<thread_function_sig>;
+    using thread_function_type = hpx::util::small_move_only_function<
+        thread_function_sig, HPX_HAVE_THREAD_FUNCTION_STORAGE_SIZE>;
 
     using thread_self = coroutines::detail::coroutine_self;
     using thread_self_impl_type = coroutines::detail::coroutine_impl;
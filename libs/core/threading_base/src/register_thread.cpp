@@ -32,6 +32,9 @@ namespace hpx::threads {
             {
                 p->run_thread_exit_callbacks();
                 p->free_thread_exit_callbacks();
+
+                // release all temporary memory allocated by this thread
+                p->get_task_arena().reset();
             }
 
             return threads::thread_result_type(
@@ -0,0 +1,503 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/task_profiler.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(HPX_WINDOWS)
+#include <process.h>
+#elif defined(HPX_HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+namespace hpx::threads::task_profiler {
+
+    namespace detail {
+
+        std::atomic<bool> is_running(false);
+    }    // namespace detail
+
+    namespace {
+
+        // one sampled execution of an HPX thread
+        struct trace_event
+        {
+            thread_description desc;
+            std::uint64_t start;
+            std::uint64_t duration;
+            std::uint64_t samples;
+            std::size_t id;
+            std::size_t parent;
+        };
+
+        // the samples attributed to one annotation
+        struct stack_entry
+        {
+            thread_description desc;
+            std::uint64_t samples = 0;
+        };
+
+        // Annotations are interned, thus they are identified by the address
+        // of their string (or by the address of the executed function).
+        [[nodiscard]] std::size_t get_key(
+            thread_description const& desc) noexcept
+        {
+            if (desc.kind() == thread_description::data_type::description)
+            {
+                return reinterpret_cast<std::size_t>(desc.get_description());
+            }
+            return desc.get_address();
+        }
+
+        [[nodiscard]] bool is_same(thread_description const& lhs,
+            thread_description const& rhs) noexcept
+        {
+            return lhs.kind() == rhs.kind() && get_key(lhs) == get_key(rhs);
+        }
+
+        // All storage is allocated by start(), recording a sample never
+        // allocates memory.
+        struct worker_data
+        {
+            std::uint64_t next_tick = 0;
+
+            // open addressing hash table, samples of annotations which do
+            // not fit into the table are counted as 'other_samples'
+            std::vector<stack_entry> stacks;
+            std::uint64_t other_samples = 0;
+
+            // ring buffer of the most recent sampled executions
+            std::vector<trace_event> events;
+            std::uint64_t num_events = 0;
+
+            void add_samples(
+                thread_description const& desc, std::uint64_t samples) noexcept
+            {
+                std::size_t const size = stacks.size();
+                std::size_t const hash = get_key(desc) / sizeof(void*);
+                for (std::size_t i = 0; i != size; ++i)
+                {
+                    stack_entry& entry = stacks[(hash + i) % size];
+                    if (entry.samples == 0)
+                    {
+                        entry.desc = desc;
+                        entry.samples = samples;
+                        return;
+                    }
+                    if (is_same(entry.desc, desc))
+                    {
+                        entry.samples += samples;
+                        return;
+                    }
+                }
+                other_samples += samples;
+            }
+
+            void add_event(trace_event const& e) noexcept
+            {
+                if (!events.empty())
+                {
+                    events[num_events++ % events.size()] = e;
+                }
+            }
+
+            // call f for the kept events, oldest first
+            template <typename F>
+            void for_each_event(F&& f) const
+            {
+                std::size_t const size = events.size();
+                if (num_events <= size)
+                {
+                    for (std::size_t i = 0; i != num_events; ++i)
+                        f(events[i]);
+                    return;
+                }
+                for (std::size_t i = 0; i != size; ++i)
+                    f(events[(num_events + i) % size]);
+            }
+        };
+
+        struct profiler_data
+        {
+            std::uint64_t interval = 0;    // in nanoseconds
+            std::uint64_t start_time = 0;
+            std::vector<util::cache_aligned_data<worker_data>> workers;
+        };
+
+        profiler_data& get_profiler_data()
+        {
+            static profiler_data data;
+            return data;
+        }
+
+        // Frames in collapsed stacks are separated by ';', the sample count
+        // is separated from the stack by the last space.
+        std::string make_frame(std::string name)
+        {
+            std::replace(name.begin(), name.end(), ';', ':');
+            std::replace(name.begin(), name.end(), '\n', ' ');
+            if (name.empty())
+            {
+                name = "<unknown>";
+            }
+            return name;
+        }
+
+        void write_json_string(std::ostream& os, std::string const& str)
+        {
+            os << '"';
+            for (char const c : str)
+            {
+                switch (c)
+                {
+                case '"':
+                    os << "\\\"";
+                    break;
+                case '\\':
+                    os << "\\\\";
+                    break;
+                case '\n':
+                    os << "\\n";
+                    break;
+                case '\t':
+                    os << "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) >= 0x20)
+                    {
+                        os << c;
+                    }
+                    break;
+                }
+            }
+            os << '"';
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void start(std::size_t num_threads, std::chrono::microseconds interval,
+        std::size_t max_events)
+    {
+        if (interval.count() <= 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "task_profiler::start",
+                "the sampling interval must be positive");
+        }
+
+        profiler_data& data = get_profiler_data();
+
+        // the workers must not be recording while we reset the samples
+        stop();
+
+        data.interval = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(interval)
+                .count());
+        data.start_time = detail::now();
+
+        data.workers.clear();
+        data.workers.resize(num_threads);
+        for (auto& worker : data.workers)
+        {
+            worker.data_.stacks.resize(max_stacks);
+            worker.data_.events.resize(max_events);
+        }
+
+        detail::is_running.store(true, std::memory_order_release);
+    }
+
+    void stop() noexcept
+    {
+        detail::is_running.store(false, std::memory_order_release);
+    }
+
+    std::uint64_t num_samples() noexcept
+    {
+        std::uint64_t count = 0;
+        for (auto const& worker : get_profiler_data().workers)
+        {
+            for (stack_entry const& entry : worker.data_.stacks)
+            {
+                count += entry.samples;
+            }
+            count += worker.data_.other_samples;
+        }
+        return count;
+    }
+
+    std::size_t num_events() noexcept
+    {
+        std::size_t count = 0;
+        for (auto const& worker : get_profiler_data().workers)
+        {
+            worker_data const& w = worker.data_;
+            count += static_cast<std::size_t>((std::min)(
+                w.num_events, static_cast<std::uint64_t>(w.events.size())));
+        }
+        return count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void detail::record(
+        thread_data const* thrd, std::uint64_t start, std::uint64_t end) noexcept
+    {
+        profiler_data& data = get_profiler_data();
+
+        std::size_t const num_thread = hpx::get_worker_thread_num();
+        if (num_thread >= data.workers.size())
+        {
+            return;
+        }
+
+        worker_data& worker = data.workers[num_thread].data_;
+
+        // discard all ticks that elapsed while the worker was idle
+        if (worker.next_tick <= start)
+        {
+            worker.next_tick =
+                start + data.interval - (start - worker.next_tick) % data.interval;
+        }
+
+        if (end < worker.next_tick)
+        {
+            return;    // no tick elapsed while this thread was running
+        }
+
+        std::uint64_t const samples =
+            (end - worker.next_tick) / data.interval + 1;
+        worker.next_tick += samples * data.interval;
+
+        thread_description const desc = thrd->get_description();
+
+        std::size_t parent = 0;
+#if defined(HPX_HAVE_THREAD_PARENT_REFERENCE)
+        parent =
+            reinterpret_cast<std::size_t>(thrd->get_parent_thread_id().get());
+#endif
+        worker.add_samples(desc, samples);
+        worker.add_event(trace_event{desc, start - data.start_time,
+            end - start, samples, reinterpret_cast<std::size_t>(thrd),
+            parent});
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void write_collapsed(std::ostream& os)
+    {
+        profiler_data const& data = get_profiler_data();
+
+        // combine the samples of all workers
+        std::unordered_map<std::string, std::uint64_t> totals;
+        std::uint64_t other_samples = 0;
+        std::vector<trace_event const*> events;
+        for (auto const& worker : data.workers)
+        {
+            for (stack_entry const& entry : worker.data_.stacks)
+            {
+                if (entry.samples != 0)
+                {
+                    totals[make_frame(as_string(entry.desc))] += entry.samples;
+                }
+            }
+            other_samples += worker.data_.other_samples;
+
+            worker.data_.for_each_event(
+                [&](trace_event const& e) { events.push_back(&e); });
+        }
+
+        // the kept executions of each thread, ordered by their start time
+        std::sort(events.begin(), events.end(),
+            [](trace_event const* lhs, trace_event const* rhs) {
+                return lhs->start < rhs->start;
+            });
+
+        std::unordered_map<std::size_t, std::vector<trace_event const*>>
+            executions;
+        for (trace_event const* e : events)
+        {
+            executions[e->id].push_back(e);
+        }
+
+        // Threads are recycled, the parent of an execution is the most
+        // recent execution of the parent thread that started before it.
+        auto const find_parent =
+            [&](trace_event const& e) -> trace_event const* {
+            auto const it = executions.find(e.parent);
+            if (e.parent == 0 || it == executions.end())
+            {
+                return nullptr;
+            }
+            auto const pos = std::upper_bound(it->second.begin(),
+                it->second.end(), e.start,
+                [](std::uint64_t start, trace_event const* p) {
+                    return start < p->start;
+                });
+            return pos == it->second.begin() ? nullptr : *(pos - 1);
+        };
+
+        // The kept executions are reported with the stack of their parent
+        // threads, from the root to the leaf. The stack ends at the first
+        // parent which was not sampled itself.
+        std::unordered_map<std::string, std::uint64_t> stacks;
+        std::unordered_map<std::string, std::uint64_t> covered;
+        std::vector<std::string> frames;
+        for (trace_event const* e : events)
+        {
+            frames.clear();
+            for (trace_event const* p = e;
+                p != nullptr && frames.size() != max_stack_depth;
+                p = find_parent(*p))
+            {
+                frames.push_back(make_frame(as_string(p->desc)));
+            }
+
+            std::string stack = frames.back();
+            for (auto it = frames.rbegin() + 1; it != frames.rend(); ++it)
+            {
+                stack += ';';
+                stack += *it;
+            }
+            stacks[stack] += e->samples;
+            covered[frames.front()] += e->samples;
+        }
+
+        // Older samples are reported without their parents. The samples of
+        // kept executions whose annotation did not fit into the tables were
+        // counted as '<other>'.
+        for (auto const& [name, samples] : covered)
+        {
+            std::uint64_t& total = totals[name];
+            if (samples <= total)
+            {
+                total -= samples;
+            }
+            else
+            {
+                other_samples -= (std::min)(other_samples, samples - total);
+                total = 0;
+            }
+        }
+        for (auto const& [name, samples] : totals)
+        {
+            if (samples != 0)
+            {
+                stacks[name] += samples;
+            }
+        }
+        if (other_samples != 0)
+        {
+            stacks["<other>"] += other_samples;
+        }
+
+        // most frequent stacks first
+        std::vector<std::pair<std::string, std::uint64_t>> sorted(
+            stacks.begin(), stacks.end());
+        std::sort(sorted.begin(), sorted.end(),
+            [](auto const& lhs, auto const& rhs) {
+                return lhs.second > rhs.second ||
+                    (lhs.second == rhs.second && lhs.first < rhs.first);
+            });
+
+        for (auto const& stack : sorted)
+        {
+            os << stack.first << ' ' << stack.second << '\n';
+        }
+    }
+
+    void write_chrome_trace(std::ostream& os)
+    {
+        profiler_data const& data = get_profiler_data();
+
+        os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+        bool first = true;
+        for (std::size_t i = 0; i != data.workers.size(); ++i)
+        {
+            os << (first ? "\n" : ",\n");
+            first = false;
+
+            // name the rows of the trace after the worker threads
+            os << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":0,\"tid\":"
+               << i << ",\"args\":{\"name\":\"worker-thread#" << i << "\"}}";
+
+            data.workers[i].data_.for_each_event([&](trace_event const& e) {
+                // timestamps are given in microseconds
+                os << ",\n{\"ph\":\"X\",\"name\":";
+                write_json_string(os, make_frame(as_string(e.desc)));
+                os << ",\"pid\":0,\"tid\":" << i
+                   << ",\"ts\":" << static_cast<double>(e.start) / 1000.0
+                   << ",\"dur\":" << static_cast<double>(e.duration) / 1000.0
+                   << ",\"args\":{\"samples\":" << e.samples;
+                if (e.parent != 0)
+                {
+                    os << ",\"parent\":\"" << std::hex << std::showbase
+                       << e.parent << std::dec << std::noshowbase << '"';
+                }
+                os << "}}";
+            });
+        }
+
+        os << "\n]}\n";
+    }
+
+    std::string get_filename(
+        std::string const& destination, std::uint32_t locality_id)
+    {
+        std::string const ids = "." + std::to_string(locality_id) + "." +
+            std::to_string(getpid());
+
+        constexpr char const json_ext[] = ".json";
+        constexpr std::size_t json_ext_len = sizeof(json_ext) - 1;
+        if (destination.size() >= json_ext_len &&
+            destination.compare(destination.size() - json_ext_len,
+                json_ext_len, json_ext) == 0)
+        {
+            return destination.substr(0, destination.size() - json_ext_len) +
+                ids + json_ext;
+        }
+        return destination + ids;
+    }
+
+    void write(std::string const& filename)
+    {
+        std::ofstream out(filename);
+        if (!out)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "task_profiler::write", "could not open profile output file {}",
+                filename);
+        }
+
+        constexpr char const json_ext[] = ".json";
+        constexpr std::size_t json_ext_len = sizeof(json_ext) - 1;
+        if (filename.size() >= json_ext_len &&
+            filename.compare(filename.size() - json_ext_len, json_ext_len,
+                json_ext) == 0)
+        {
+            write_chrome_trace(out);
+        }
+        else
+        {
+            write_collapsed(out);
+        }
+    }
+}    // namespace hpx::threads::task_profiler
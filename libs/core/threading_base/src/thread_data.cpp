@@ -39,6 +39,15 @@ namespace hpx::threads {
             get_locality_id_f = HPX_MOVE(f);
         }
 
+        hpx::memory::task_arena* get_self_task_arena() noexcept
+        {
+            if (thread_data* p = get_self_id_data())
+            {
+                return &p->get_task_arena();
+            }
+            return nullptr;
+        }
+
         std::uint32_t get_locality_id(hpx::error_code& ec)
         {
             if (get_locality_id_f)
@@ -204,6 +213,7 @@ namespace hpx::threads {
             this, get_description(), get_thread_phase());
 
         free_thread_exit_callbacks();
+        arena_.reset();
 
         priority_ = init_data.priority;
         requested_interrupt_ = false;
@@ -0,0 +1,133 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/allocator_support/task_arena.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_arena()
+{
+    hpx::memory::task_arena arena;
+    HPX_TEST_EQ(arena.num_slabs(), static_cast<std::size_t>(0));
+
+    // small allocations are served from the same slab
+    void* p1 = arena.allocate(16);
+    void* p2 = arena.allocate(32, 64);
+    HPX_TEST(p1 != nullptr);
+    HPX_TEST(p2 != nullptr);
+    HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(p2) % 64,
+        static_cast<std::uintptr_t>(0));
+    HPX_TEST_EQ(arena.num_slabs(), static_cast<std::size_t>(1));
+
+    // the most recent allocation is rolled back
+    arena.deallocate(p2, 32);
+    void* p3 = arena.allocate(32, 64);
+    HPX_TEST_EQ(p2, p3);
+
+    // large allocations get their own slab
+    void* p4 = arena.allocate(4 * hpx::memory::task_arena::slab_size);
+    HPX_TEST(p4 != nullptr);
+    HPX_TEST_EQ(arena.num_slabs(), static_cast<std::size_t>(2));
+
+    arena.reset();
+    HPX_TEST_EQ(arena.num_slabs(), static_cast<std::size_t>(0));
+}
+
+void test_task_arena()
+{
+    // every HPX thread has its own arena
+    hpx::memory::task_arena* here = hpx::memory::get_task_arena();
+    HPX_TEST(here != nullptr);
+
+    hpx::async([here]() {
+        hpx::memory::task_arena* arena = hpx::memory::get_task_arena();
+        HPX_TEST(arena != nullptr);
+        HPX_TEST(arena != here);
+
+        HPX_TEST_EQ(arena, &hpx::threads::get_self_id_data()->get_task_arena());
+    }).get();
+}
+
+// The arena stays with its HPX thread while the thread is suspended and
+// resumed, possibly on a different worker thread.
+void test_arena_across_suspension()
+{
+    std::vector<hpx::future<std::size_t>> results;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        results.push_back(hpx::async([i]() {
+            hpx::memory::task_arena* arena = hpx::memory::get_task_arena();
+
+            std::size_t const n = 1000 * i;
+            auto* values = static_cast<std::size_t*>(
+                arena->allocate(n * sizeof(std::size_t), alignof(std::size_t)));
+            std::iota(values, values + n, static_cast<std::size_t>(0));
+
+            hpx::this_thread::yield();
+
+            HPX_TEST_EQ(arena, hpx::memory::get_task_arena());
+            return std::accumulate(values, values + n, std::size_t(0));
+        }));
+    }
+
+    for (std::size_t i = 0; i != results.size(); ++i)
+    {
+        std::size_t const n = 1000 * i;
+        HPX_TEST_EQ(results[i].get(), n == 0 ? 0 : n * (n - 1) / 2);
+    }
+}
+
+// containers using the allocator take their memory from the bound arena
+void test_task_arena_allocator()
+{
+    hpx::async([]() {
+        hpx::memory::task_arena* arena = hpx::memory::get_task_arena();
+        hpx::memory::task_arena_allocator<int> const alloc(arena);
+
+        std::vector<int, hpx::memory::task_arena_allocator<int>> values(
+            1000, 42, alloc);
+        HPX_TEST(arena->contains(values.data()));
+
+        // released in reverse order of allocation, the memory is reused
+        int* const data = values.data();
+        values = std::vector<int, hpx::memory::task_arena_allocator<int>>(
+            alloc);
+        std::vector<int, hpx::memory::task_arena_allocator<int>> other(
+            1000, 0, alloc);
+        HPX_TEST_EQ(other.data(), data);
+    }).get();
+
+    // outside of HPX threads the global heap is used
+    hpx::memory::task_arena_allocator<int> alloc(nullptr);
+    int* p = alloc.allocate(10);
+    HPX_TEST(p != nullptr);
+    alloc.deallocate(p, 10);
+}
+
+int hpx_main()
+{
+    test_arena();
+    test_task_arena();
+    test_arena_across_suspension();
+    test_task_arena_allocator();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
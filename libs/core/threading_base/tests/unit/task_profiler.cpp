@@ -0,0 +1,172 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+char const* const profile_file = "task_profiler_test.profile";
+constexpr std::size_t max_events = 32;
+std::size_t num_threads = 0;
+
+void spin(std::chrono::microseconds duration)
+{
+    auto const start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < duration)
+    {
+    }
+}
+
+void busy_work()
+{
+    hpx::scoped_annotation annotate("busy_work");
+    spin(std::chrono::milliseconds(5));
+}
+
+// every task uses a different annotation
+void distinct_work(std::size_t i)
+{
+    hpx::scoped_annotation annotate("distinct_work#" + std::to_string(i));
+    spin(std::chrono::microseconds(300));
+}
+
+void inner_work()
+{
+    hpx::scoped_annotation annotate("inner_work");
+    spin(std::chrono::milliseconds(5));
+}
+
+// the samples of the child threads are reported with the parent's annotation
+void outer_work()
+{
+    hpx::scoped_annotation annotate("outer_work");
+    spin(std::chrono::milliseconds(5));
+
+    std::vector<hpx::future<void>> futures;
+    for (int i = 0; i != 4; ++i)
+    {
+        futures.push_back(hpx::async(&inner_work));
+    }
+    hpx::wait_all(futures);
+}
+
+int hpx_main()
+{
+    num_threads = hpx::get_os_thread_count();
+
+    std::vector<hpx::future<void>> futures;
+    for (int i = 0; i != 20; ++i)
+    {
+        futures.push_back(hpx::async(&busy_work));
+    }
+    hpx::wait_all(futures);
+
+    // more sampled executions and more annotations than the profiler keeps
+    futures.clear();
+    for (std::size_t i = 0; i != 2 * hpx::threads::task_profiler::max_stacks;
+        ++i)
+    {
+        futures.push_back(hpx::async(&distinct_work, i));
+    }
+    hpx::wait_all(futures);
+
+    hpx::async(&outer_work).get();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // the locality id and the process id are added to the file name
+    std::string const filename =
+        hpx::threads::task_profiler::get_filename(profile_file, 0);
+    HPX_TEST_EQ(filename.find(std::string(profile_file) + ".0."),
+        static_cast<std::size_t>(0));
+
+    std::string const json_filename =
+        hpx::threads::task_profiler::get_filename("profile.json", 1);
+    HPX_TEST_EQ(
+        json_filename.find("profile.1."), static_cast<std::size_t>(0));
+    HPX_TEST_EQ(json_filename.rfind(".json"), json_filename.size() - 5);
+
+    std::remove(filename.c_str());
+
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.profile.destination=" + std::string(profile_file),
+        "hpx.profile.interval=100",
+        "hpx.profile.max_events=" + std::to_string(max_events)};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    // the runtime has written the collected samples as collapsed stacks
+    std::ifstream in(filename);
+    HPX_TEST(in.is_open());
+
+    std::uint64_t samples = 0;
+    std::size_t num_stacks = 0;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        std::size_t const pos = line.rfind(' ');
+        HPX_TEST(pos != std::string::npos && pos != 0);
+        samples += std::stoull(line.substr(pos + 1));
+        ++num_stacks;
+    }
+
+    // 100ms of busy work sampled every 100us
+    HPX_TEST_LT(static_cast<std::uint64_t>(500), samples);
+    HPX_TEST_EQ(samples, hpx::threads::task_profiler::num_samples());
+
+    // the memory used by the profiler is bounded, the annotations which do
+    // not fit are reported as '<other>', the kept executions are reported
+    // with the stack of their parents
+    HPX_TEST_LT(static_cast<std::size_t>(0), num_threads);
+    HPX_TEST_LTE(num_stacks,
+        num_threads * (hpx::threads::task_profiler::max_stacks + max_events) +
+            1);
+    HPX_TEST_LTE(
+        hpx::threads::task_profiler::num_events(), num_threads * max_events);
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    std::ostringstream collapsed;
+    hpx::threads::task_profiler::write_collapsed(collapsed);
+    HPX_TEST(collapsed.str().find("busy_work ") != std::string::npos);
+#if defined(HPX_HAVE_THREAD_PARENT_REFERENCE)
+    HPX_TEST(collapsed.str().find("outer_work;inner_work ") !=
+        std::string::npos);
+#endif
+#endif
+
+    std::ostringstream os;
+    hpx::threads::task_profiler::write_chrome_trace(os);
+    std::string const trace = os.str();
+    HPX_TEST(trace.find("\"traceEvents\"") != std::string::npos);
+
+    // the trace contains the kept events only
+    std::size_t num_trace_events = 0;
+    for (std::size_t pos = trace.find("\"ph\":\"X\"");
+        pos != std::string::npos; pos = trace.find("\"ph\":\"X\"", pos + 1))
+    {
+        ++num_trace_events;
+    }
+    HPX_TEST_LT(static_cast<std::size_t>(0), num_trace_events);
+    HPX_TEST_EQ(num_trace_events, hpx::threads::task_profiler::num_events());
+
+    std::remove(filename.c_str());
+
+    return hpx::util::report_errors();
+}
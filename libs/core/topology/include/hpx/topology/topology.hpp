@@ -135,6 +135,22 @@ namespace hpx::threads {
             return numa_node_numbers_[num_thread % num_of_pus_];
         }
 
+        /// \brief Return the number of the last level (L3) cache the
+        ///        processing unit the given thread is running on is attached
+        ///        to. All processing units sharing the same L3 cache return
+        ///        the same number. The socket number is returned if there is
+        ///        no L3 cache.
+        ///
+        /// \param num_thread [in]
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        std::size_t get_l3_cache_number(std::size_t num_thread,
+            [[maybe_unused]] error_code& ec = throws) const noexcept
+        {
+            return l3_cache_numbers_[num_thread % num_of_pus_];
+        }
+
         /// \brief Return a bit mask where each set bit corresponds to a
         ///        processing unit available to the application.
         ///
@@ -242,6 +258,11 @@ namespace hpx::threads {
         /// \brief Return the number of available NUMA domains
         std::size_t get_number_of_numa_nodes() const;
 
+        /// \brief Return the number of distinct last level (L3) caches, or
+        ///        the number of sockets if there is no L3 cache. This is at
+        ///        least one.
+        std::size_t get_number_of_l3_caches() const;
+
         /// \brief Return the number of available cores
         std::size_t get_number_of_cores() const;
 
@@ -340,6 +361,8 @@ namespace hpx::threads {
 
         std::size_t init_numa_node_number(std::size_t num_thread) const;
 
+        std::size_t init_l3_cache_number(std::size_t num_thread) const;
+
         std::size_t init_core_number(std::size_t num_thread) const
         {
             return init_node_number(
@@ -406,6 +429,7 @@ namespace hpx::threads {
         // number PU #0 (zero-based index) belongs to
         std::vector<std::size_t> socket_numbers_;
         std::vector<std::size_t> numa_node_numbers_;
+        std::vector<std::size_t> l3_cache_numbers_;
         std::vector<std::size_t> core_numbers_;
 
         // Affinity masks: vectors of bitmasks
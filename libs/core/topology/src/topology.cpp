@@ -17,12 +17,17 @@
 #include <hpx/topology/topology.hpp>
 #include <hpx/util/ios_flags_saver.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <vector>
@@ -50,6 +55,7 @@
 #if defined(_POSIX_VERSION)
 #include <sys/resource.h>
 #include <sys/syscall.h>
+#include <sys/utsname.h>
 #endif
 
 namespace hpx::threads::detail {
@@ -126,6 +132,264 @@ namespace hpx::threads::detail {
         return node;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Discovering the hardware topology may take a considerable amount of
+    // time on large nodes (in particular if PCI devices are enumerated). If
+    // the environment variable HPX_TOPOLOGY_CACHE refers to a directory, the
+    // discovered topology is exported as XML into that directory and is
+    // loaded from there by subsequently started processes. The name of the
+    // cache file is derived from the host name and from a fingerprint of the
+    // kernel, the processors, and the processing units and memory nodes the
+    // process is allowed to use. This automatically invalidates the cached
+    // topology whenever any of those change.
+    namespace {
+
+        std::uint64_t fingerprint_combine(
+            std::uint64_t hash, std::string const& data) noexcept
+        {
+            // 64 bit FNV-1a
+            for (char const c : data)
+            {
+                hash ^= static_cast<std::uint64_t>(
+                    static_cast<unsigned char>(c));
+                hash *= 0x100000001b3ULL;
+            }
+
+            // separate consecutive items
+            hash ^= 0xff;
+            hash *= 0x100000001b3ULL;
+            return hash;
+        }
+
+        // Return all lines of the given file that start with the given
+        // prefix, or all lines if the prefix is empty.
+        std::string read_file_lines(
+            std::string const& filename, char const* prefix = "")
+        {
+            std::ifstream ifs(filename);
+            if (!ifs.is_open())
+                return {};
+
+            std::string result;
+            std::string line;
+            while (std::getline(ifs, line))
+            {
+                if (line.rfind(prefix, 0) == 0)
+                {
+                    result += line;
+                    result += '\n';
+                }
+            }
+            return result;
+        }
+
+#if defined(__linux__)
+        // hwloc removes all processing units and memory nodes from the
+        // topology that are not part of the cpuset cgroup of the process.
+        std::string read_cgroup_cpuset()
+        {
+            std::ifstream ifs("/proc/self/cgroup");
+            if (!ifs.is_open())
+                return {};
+
+            std::string result;
+            std::string line;
+            while (std::getline(ifs, line))
+            {
+                std::string::size_type const first = line.find(':');
+                std::string::size_type const second =
+                    line.find(':', first + 1);
+                if (first == std::string::npos || second == std::string::npos)
+                    continue;
+
+                std::string const controllers =
+                    line.substr(first + 1, second - first - 1);
+                std::string const path = line.substr(second + 1);
+
+                if (controllers.empty())
+                {
+                    // cgroup v2 unified hierarchy
+                    std::string const base = "/sys/fs/cgroup" + path;
+                    result += read_file_lines(base + "/cpuset.cpus.effective");
+                    result += read_file_lines(base + "/cpuset.mems.effective");
+                }
+                else if (controllers.find("cpuset") != std::string::npos)
+                {
+                    // cgroup v1 cpuset hierarchy
+                    std::string const base = "/sys/fs/cgroup/cpuset" + path;
+                    result += read_file_lines(base + "/cpuset.effective_cpus");
+                    result += read_file_lines(base + "/cpuset.effective_mems");
+                }
+            }
+            return result;
+        }
+#endif
+
+        std::string get_topology_cache_filename()
+        {
+            char const* dir = std::getenv("HPX_TOPOLOGY_CACHE");
+            if (dir == nullptr || *dir == '\0')
+                return {};
+
+#if defined(_POSIX_VERSION)
+            char hostname[256] = {};
+            if (gethostname(hostname, sizeof(hostname) - 1) != 0)
+                return {};
+
+            struct utsname name = {};
+            if (uname(&name) != 0)
+                return {};
+
+            std::uint64_t hash = 0xcbf29ce484222325ULL;
+            hash = fingerprint_combine(hash,
+                std::to_string(HWLOC_API_VERSION) + ":" +
+                    std::to_string(hwloc_get_api_version()));
+            hash = fingerprint_combine(hash, name.sysname);
+            hash = fingerprint_combine(hash, name.release);
+            hash = fingerprint_combine(hash, name.version);
+            hash = fingerprint_combine(hash, name.machine);
+            hash = fingerprint_combine(
+                hash, std::to_string(std::thread::hardware_concurrency()));
+#if defined(__linux__)
+            hash = fingerprint_combine(
+                hash, read_file_lines("/sys/devices/system/cpu/online"));
+            hash = fingerprint_combine(
+                hash, read_file_lines("/sys/devices/system/node/online"));
+            hash = fingerprint_combine(
+                hash, read_file_lines("/proc/cpuinfo", "model name"));
+            hash = fingerprint_combine(
+                hash, read_file_lines("/proc/cpuinfo", "physical id"));
+            hash = fingerprint_combine(
+                hash, read_file_lines("/proc/cpuinfo", "core id"));
+            hash = fingerprint_combine(hash, read_cgroup_cpuset());
+#endif
+#if defined(HPX_TOPOLOGY_HAVE_ADDITIONAL_HWLOC_TESTING)
+            hash = fingerprint_combine(hash, "no-cores");
+#endif
+
+            std::ostringstream strm;
+            strm << dir;
+            if (strm.str().back() != '/')
+                strm << '/';
+            strm << "hpx-topology-" << hostname << '-' << std::hex
+                 << std::setw(16) << std::setfill('0') << hash << ".xml";
+            return strm.str();
+#else
+            return {};
+#endif
+        }
+
+        void init_hwloc_topology(hwloc_topology_t& topo)
+        {
+            int err = hwloc_topology_init(&topo);
+            if (err != 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::no_success,
+                    "topology::topology", "Failed to init hwloc topology");
+            }
+
+#if HWLOC_API_VERSION >= 0x00020000
+#if defined(HPX_TOPOLOGY_HAVE_ADDITIONAL_HWLOC_TESTING)
+            // Enable HWLOC filtering that makes it report no cores. This is
+            // purely an option allowing to test whether things work properly
+            // on systems that may not report cores in the topology at all
+            // (e.g. FreeBSD).
+            err = hwloc_topology_set_type_filter(
+                topo, HWLOC_OBJ_CORE, HWLOC_TYPE_FILTER_KEEP_NONE);
+            if (err != 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::no_success,
+                    "topology::topology",
+                    "Failed to set core filter for hwloc topology");
+            }
+#endif
+#endif
+        }
+
+        bool load_cached_topology(
+            hwloc_topology_t topo, std::string const& filename)
+        {
+            if (!std::ifstream(filename).good())
+                return false;
+
+            if (hwloc_topology_set_xml(topo, filename.c_str()) != 0)
+                return false;
+
+            // the cached topology describes the machine we're running on,
+            // this is required for binding threads and memory
+            if (hwloc_topology_set_flags(
+                    topo, HWLOC_TOPOLOGY_FLAG_IS_THISSYSTEM) != 0)
+            {
+                return false;
+            }
+
+            return hwloc_topology_load(topo) == 0;
+        }
+
+        void save_cached_topology(
+            hwloc_topology_t topo, std::string const& filename)
+        {
+            // write to a temporary file first to avoid other processes
+            // reading a partially written topology
+#if defined(_POSIX_VERSION)
+            std::string const tmp_filename =
+                filename + "." + std::to_string(getpid());
+#else
+            std::string const tmp_filename = filename + ".tmp";
+#endif
+
+#if HWLOC_API_VERSION >= 0x00020000
+            int const err =
+                hwloc_topology_export_xml(topo, tmp_filename.c_str(), 0);
+#else
+            int const err =
+                hwloc_topology_export_xml(topo, tmp_filename.c_str());
+#endif
+            if (err != 0 ||
+                std::rename(tmp_filename.c_str(), filename.c_str()) != 0)
+            {
+                std::remove(tmp_filename.c_str());
+                LTM_(warning).format(
+                    "topology: failed to write topology cache: {}", filename);
+            }
+        }
+
+        void load_hwloc_topology(hwloc_topology_t& topo)
+        {
+            init_hwloc_topology(topo);
+
+            std::string const cache_filename = get_topology_cache_filename();
+            if (!cache_filename.empty())
+            {
+                if (load_cached_topology(topo, cache_filename))
+                {
+                    LTM_(info).format("topology: loaded cached topology: {}",
+                        cache_filename);
+                    return;
+                }
+
+                // start over, the topology object can't be reused after a
+                // failed attempt to load it
+                hwloc_topology_destroy(topo);
+                topo = nullptr;
+
+                init_hwloc_topology(topo);
+            }
+
+            int const err = hwloc_topology_load(topo);
+            if (err != 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::no_success,
+                    "topology::topology", "Failed to load hwloc topology");
+            }
+
+            if (!cache_filename.empty())
+            {
+                save_cached_topology(topo, cache_filename);
+            }
+        }
+    }    // namespace
+
     ///////////////////////////////////////////////////////////////////////////
     // abstract away memory page size
     std::size_t get_memory_page_size_impl()
@@ -214,39 +478,13 @@ namespace hpx::threads {
 
     topology::topology()
     {
-        int err = hwloc_topology_init(&topo);
-        if (err != 0)
-        {
-            HPX_THROW_EXCEPTION(hpx::error::no_success, "topology::topology",
-                "Failed to init hwloc topology");
-        }
-
-#if HWLOC_API_VERSION >= 0x00020000
-#if defined(HPX_TOPOLOGY_HAVE_ADDITIONAL_HWLOC_TESTING)
-        // Enable HWLOC filtering that makes it report no cores. This is purely
-        // an option allowing to test whether things work properly on systems
-        // that may not report cores in the topology at all (e.g. FreeBSD).
-        err = hwloc_topology_set_type_filter(
-            topo, HWLOC_OBJ_CORE, HWLOC_TYPE_FILTER_KEEP_NONE);
-        if (err != 0)
-        {
-            HPX_THROW_EXCEPTION(hpx::error::no_success, "topology::topology",
-                "Failed to set core filter for hwloc topology");
-        }
-#endif
-#endif
-
-        err = hwloc_topology_load(topo);
-        if (err != 0)
-        {
-            HPX_THROW_EXCEPTION(hpx::error::no_success, "topology::topology",
-                "Failed to load hwloc topology");
-        }
+        detail::load_hwloc_topology(topo);
 
         init_num_of_pus();
 
         socket_numbers_.reserve(num_of_pus_);
         numa_node_numbers_.reserve(num_of_pus_);
+        l3_cache_numbers_.reserve(num_of_pus_);
         core_numbers_.reserve(num_of_pus_);
 
         // Initialize each set of data entirely, as some of the initialization
@@ -275,6 +513,11 @@ namespace hpx::threads {
             numa_node_numbers_.push_back(numa_node);
         }
 
+        for (std::size_t i = 0; i < num_of_pus_; ++i)
+        {
+            l3_cache_numbers_.push_back(init_l3_cache_number(i));
+        }
+
         std::size_t num_of_cores = get_number_of_cores();
         if (num_of_cores == 0)
             num_of_cores = 1;
@@ -335,6 +578,7 @@ namespace hpx::threads {
 
         detail::write_to_log("socket_number", socket_numbers_);
         detail::write_to_log("numa_node_number", numa_node_numbers_);
+        detail::write_to_log("l3_cache_number", l3_cache_numbers_);
         detail::write_to_log("core_number", core_numbers_);
 
         detail::write_to_log_mask(
@@ -631,6 +875,39 @@ namespace hpx::threads {
 #endif
     }
 
+    std::size_t topology::init_l3_cache_number(std::size_t num_thread) const
+    {
+        if (static_cast<std::size_t>(-1) == num_thread)
+            return static_cast<std::size_t>(-1);
+
+        std::size_t const num_pu = (num_thread + pu_offset) % num_of_pus_;
+
+        hwloc_obj_t obj;
+        {
+            std::unique_lock<mutex_type> lk(topo_mtx);
+            obj = hwloc_get_obj_by_type(
+                topo, HWLOC_OBJ_PU, static_cast<unsigned>(num_pu));
+            HPX_ASSERT(num_pu == detail::get_index(obj));
+        }
+
+        while (obj)
+        {
+#if HWLOC_API_VERSION >= 0x00020000
+            if (hwloc_compare_types(obj->type, HWLOC_OBJ_L3CACHE) == 0)
+#else
+            if (hwloc_compare_types(obj->type, HWLOC_OBJ_CACHE) == 0 &&
+                obj->attr->cache.depth == 3)
+#endif
+            {
+                return detail::get_index(obj);
+            }
+            obj = obj->parent;
+        }
+
+        // no L3 cache found, assume it is shared by all PUs of a socket
+        return init_socket_number(num_thread);
+    }
+
     std::size_t topology::init_node_number(
         std::size_t num_thread, hwloc_obj_type_t type) const
     {
@@ -754,6 +1031,16 @@ namespace hpx::threads {
         return static_cast<std::size_t>(nobjs);
     }
 
+    std::size_t topology::get_number_of_l3_caches() const
+    {
+        // the numbers are based on the sockets if there is no L3 cache
+        std::vector<std::size_t> numbers(l3_cache_numbers_);
+        std::sort(numbers.begin(), numbers.end());
+        auto const count = static_cast<std::size_t>(
+            std::unique(numbers.begin(), numbers.end()) - numbers.begin());
+        return (std::max)(count, static_cast<std::size_t>(1));
+    }
+
     std::size_t topology::get_number_of_cores() const
     {
         int nobjs = hwloc_get_nbobjs_by_type(topo, HWLOC_OBJ_CORE);
@@ -1667,6 +1954,8 @@ namespace hpx::threads {
         print_vector(os, socket_numbers_);
         os << "numa node             : \n";
         print_vector(os, numa_node_numbers_);
+        os << "L3 cache              : \n";
+        print_vector(os, l3_cache_numbers_);
         os << "core                  : \n";
         print_vector(os, core_numbers_);
         //os << "PUs (/threads)        : \n";
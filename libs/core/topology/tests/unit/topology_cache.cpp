@@ -0,0 +1,92 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The topology is written to the directory given by HPX_TOPOLOGY_CACHE when
+// it is discovered first, and is read from there afterwards.
+
+#include <hpx/config.hpp>
+#include <hpx/modules/filesystem.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#if defined(HPX_HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+#if defined(_POSIX_VERSION)
+#include <sys/stat.h>
+
+std::vector<std::string> list_files(hpx::filesystem::path const& dir)
+{
+    std::vector<std::string> files;
+    for (auto const& entry : hpx::filesystem::directory_iterator(dir))
+    {
+        files.push_back(entry.path().string());
+    }
+    return files;
+}
+
+ino_t get_inode(std::string const& filename)
+{
+    struct stat st = {};
+    HPX_TEST_EQ(stat(filename.c_str(), &st), 0);
+    return st.st_ino;
+}
+
+int main()
+{
+    hpx::filesystem::path const dir =
+        hpx::filesystem::temp_directory_path() /
+        ("hpx_topology_cache_" + std::to_string(getpid()));
+    hpx::filesystem::create_directories(dir);
+
+    setenv("HPX_TOPOLOGY_CACHE", dir.string().c_str(), 1);
+
+    std::size_t num_pus = 0;
+    {
+        hpx::threads::topology topo;
+        num_pus = topo.get_number_of_pus();
+    }
+
+    // the topology has been written to the cache
+    std::vector<std::string> files = list_files(dir);
+    HPX_TEST_EQ(files.size(), static_cast<std::size_t>(1));
+    if (files.size() == 1)
+    {
+        std::string const filename = files[0];
+        HPX_TEST(hpx::filesystem::path(filename).filename().string().find(
+                     "hpx-topology-") == 0);
+        HPX_TEST(hpx::filesystem::file_size(filename) != 0);
+
+        ino_t const inode = get_inode(filename);
+
+        // the cached topology is used, the cache file is not written again
+        {
+            hpx::threads::topology topo;
+            HPX_TEST_EQ(topo.get_number_of_pus(), num_pus);
+        }
+
+        files = list_files(dir);
+        HPX_TEST_EQ(files.size(), static_cast<std::size_t>(1));
+        HPX_TEST_EQ(get_inode(filename), inode);
+    }
+
+    unsetenv("HPX_TOPOLOGY_CACHE");
+    hpx::filesystem::remove_all(dir);
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -11,6 +11,7 @@
 #include <hpx/actions_base/detail/action_factory.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/runtime_configuration/deferred_modules.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -145,6 +146,14 @@ namespace hpx::actions::detail {
     {
         action_registry const& this_ = instance();
 
+        // the action might be exposed by a module which is loaded on demand
+        if ((id >= this_.cache_.size() ||
+                this_.cache_[static_cast<std::size_t>(id)].first == nullptr) &&
+            hpx::util::load_deferred_modules())
+        {
+            return create(id, with_continuation, name);
+        }
+
         if (id >= this_.cache_.size())
         {
             std::string msg(
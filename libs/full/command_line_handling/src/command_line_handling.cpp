@@ -1025,10 +1025,13 @@ namespace hpx::util {
         }
 #endif
 
+        util::mark_startup_stage("command line parsing");
+
         // load plugin modules (after first pass of command line handling, so
         // that settings given on command line could propagate to modules)
         std::vector<std::shared_ptr<plugins::plugin_registry_base>>
             plugin_registries = rtcfg_.load_modules(component_registries);
+        util::mark_startup_stage("module discovery");
 
         // Re-run program option analysis, ini settings (such as aliases) will
         // be considered now.
@@ -1042,6 +1045,7 @@ namespace hpx::util {
         {
             reg->init(&argc, &argv, rtcfg_);
         }
+        util::mark_startup_stage("plugin initialization");
 
         // Now reparse the command line using the node number (if given). This
         // will additionally detect any --hpx:N:foo options.
@@ -9,9 +9,12 @@
 
 #include <hpx/config.hpp>
 #include <hpx/concurrency/spinlock.hpp>
+#include <hpx/futures/future.hpp>
 #include <hpx/naming_base/id_type.hpp>
 
 #include <cstddef>
+#include <cstdint>
+#include <mutex>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -19,11 +22,21 @@ namespace hpx::util {
 
     // The unique_id_ranges class is a type responsible for generating unique
     // ids for components, parcels, threads etc.
+    //
+    // Once half of the current range of ids has been used, the next range is
+    // requested from AGAS asynchronously, so that the thread exhausting the
+    // current range does not have to wait for the round trip to AGAS. The
+    // size of the requested ranges is adapted to the observed rate of id
+    // allocations.
     class HPX_EXPORT unique_id_ranges
     {
-        // size of the id range returned by get_id
+        // initial size of the id range requested from AGAS
         static constexpr std::size_t range_delta = 0x100000;
 
+        // bounds for the adaptive size of the id ranges
+        static constexpr std::size_t min_range_delta = range_delta / 16;
+        static constexpr std::size_t max_range_delta = range_delta * 64;
+
     public:
         // Generate next unique component id
         naming::gid_type get_id(std::size_t count = 1);
@@ -32,11 +45,24 @@ namespace hpx::util {
             naming::gid_type const& lower, naming::gid_type const& upper);
 
     private:
+        void install_range(naming::gid_type const& lower, std::size_t count);
+        void prefetch_range();
+
         hpx::util::spinlock mtx_;
 
         // The range of available ids for components
         naming::gid_type lower_;
         naming::gid_type upper_;
+
+        // The range of ids requested asynchronously
+        hpx::future<naming::gid_type> next_lower_;
+        std::size_t next_count_ = 0;
+
+        // The size of the id ranges to request and the time the current
+        // range was installed (used to measure the id allocation rate)
+        std::size_t range_size_ = range_delta;
+        std::size_t current_range_size_ = 0;
+        std::uint64_t range_start_time_ = 0;
     };
 }    // namespace hpx::util
 
@@ -20,6 +20,7 @@
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support/atomic_count.hpp>
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 #include <type_traits>
@@ -54,6 +55,7 @@ namespace hpx::components {
 
             mutable Mutex mtx_;
             std::uint32_t pin_count_ = 0;
+            std::atomic<std::uint64_t> invocation_count_ = 0;
 
         private:
             friend void intrusive_ptr_add_ref(
@@ -215,6 +217,14 @@ namespace hpx::components {
             return was_migrated;
         }
 
+        // The number of actions executed on this object (used for load
+        // balancing). Pinning the object without running an action (e.g.
+        // through get_ptr or while migrating it) is not counted.
+        [[nodiscard]] std::uint64_t invocation_count() const noexcept
+        {
+            return data_->invocation_count_.load(std::memory_order_relaxed);
+        }
+
         [[nodiscard]] std::uint32_t pin_count() const noexcept
         {
             auto const data = data_;    // keep alive
@@ -333,6 +343,7 @@ namespace hpx::components {
             threads::thread_function_type&& f, components::pinned_ptr,
             threads::thread_restart_state state)
         {
+            data_->invocation_count_.fetch_add(1, std::memory_order_relaxed);
             return f(state);
         }
 
@@ -9,11 +9,14 @@
 
 #include <hpx/config.hpp>
 #include <hpx/components_base/server/wrapper_heap_base.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/synchronization/once.hpp>
 #include <hpx/synchronization/shared_mutex.hpp>
 
 #include <cstddef>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include <hpx/config/warnings_prefix.hpp>
@@ -80,6 +83,35 @@ namespace hpx::util {
 
         std::string name() const;
 
+        // Single objects are handed out from a small per-worker cache
+        // (magazine) of never used slots before the heap list is consulted.
+        // A magazine is refilled with magazine_batch slots at once. Freed
+        // objects are collected per worker as well and are returned to their
+        // heaps in batches of magazine_batch objects. A freed slot is never
+        // handed out again before its heap was released, as the global id of
+        // an object is derived from its address.
+        static constexpr std::size_t magazine_batch = 32;
+
+    private:
+        struct magazine
+        {
+            // slots which have not been handed out yet
+            std::size_t count = 0;
+            void* objects[magazine_batch];
+
+            // freed objects which have not been returned to their heaps yet
+            std::size_t num_freed = 0;
+            void* freed[magazine_batch];
+        };
+
+        magazine* get_magazine();
+        void* alloc_cached();
+        bool free_cached(void* p);
+        bool free_locked(void* p, std::size_t count);
+
+        // return all slots held by the magazines to their heaps
+        void flush_magazines() noexcept;
+
     protected:
         mutable mutex_type rwlock_;
         list_type heap_list_;
@@ -87,6 +119,11 @@ namespace hpx::util {
     private:
         std::string const class_name_;
 
+        // one magazine per worker thread, created on first use
+        hpx::once_flag magazines_initialized_;
+        std::size_t num_magazines_ = 0;
+        std::unique_ptr<util::cache_aligned_data<magazine>[]> magazines_;
+
     public:
 #if defined(HPX_DEBUG)
         std::size_t alloc_count_ = 0;
@@ -6,13 +6,19 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
+#include <hpx/async_local/async.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/components_base/generate_unique_ids.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <mutex>
+#include <utility>
 
 namespace hpx::util {
 
@@ -27,10 +33,33 @@ namespace hpx::util {
             lower_ = naming::invalid_gid;
 
             naming::gid_type lower;
-            std::size_t const count_ = (std::max)(range_delta, count);
+            std::size_t count_;
 
+            if (next_lower_.valid() && next_count_ >= count)
             {
+                // use the range which was requested asynchronously, this
+                // usually doesn't have to wait as the request was issued
+                // once half of the previous range was used
+                hpx::future<naming::gid_type> f = HPX_MOVE(next_lower_);
+                count_ = next_count_;
+
                 hpx::unlock_guard ul(l);
+                lower = f.get();
+            }
+            else
+            {
+                count_ = (std::max)(range_size_, count);
+
+                // the prefetched range (if any) is too small, it is dropped
+                // but the request is not left running in the background
+                hpx::future<naming::gid_type> f = HPX_MOVE(next_lower_);
+                next_count_ = 0;
+
+                hpx::unlock_guard ul(l);
+                if (f.valid())
+                {
+                    f.wait();
+                }
                 lower = hpx::agas::get_next_id(count_);
             }
 
@@ -38,21 +67,89 @@ namespace hpx::util {
             // lower range
             if (!lower_)
             {
-                lower_ = lower;
-                upper_ = lower + count_;
+                install_range(lower, count_);
             }
         }
 
         naming::gid_type result = lower_;
         lower_ += count;
+
+        prefetch_range();
         return result;
     }
 
     void unique_id_ranges::set_range(
         naming::gid_type const& lower, naming::gid_type const& upper)
     {
-        std::lock_guard l(mtx_);
+        // a range prefetched for the previous range is dropped, the next
+        // prefetch is triggered based on the new range
+        hpx::future<naming::gid_type> f;
+        {
+            std::lock_guard l(mtx_);
+            lower_ = lower;
+            upper_ = upper;
+
+            current_range_size_ =
+                static_cast<std::size_t>((upper - lower).get_lsb());
+            range_start_time_ = hpx::chrono::high_resolution_clock::now();
+
+            f = HPX_MOVE(next_lower_);
+            next_count_ = 0;
+        }
+
+        if (f.valid())
+        {
+            f.wait();
+        }
+    }
+
+    void unique_id_ranges::install_range(
+        naming::gid_type const& lower, std::size_t count)
+    {
+        std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+
+        // adapt the size of the ranges requested from AGAS such that a new
+        // range is needed about once per second
+        if (current_range_size_ != 0 && now > range_start_time_)
+        {
+            double const ids_per_second =
+                static_cast<double>(current_range_size_) * 1e9 /
+                static_cast<double>(now - range_start_time_);
+
+            std::size_t size = min_range_delta;
+            while (static_cast<double>(size) < ids_per_second &&
+                size < max_range_delta)
+            {
+                size *= 2;
+            }
+            range_size_ = size;
+        }
+
         lower_ = lower;
-        upper_ = upper;
+        upper_ = lower + count;
+        current_range_size_ = count;
+        range_start_time_ = now;
+    }
+
+    void unique_id_ranges::prefetch_range()
+    {
+        // request the next range once half of the current one has been used
+        if (next_lower_.valid() ||
+            (upper_ - lower_).get_lsb() > current_range_size_ / 2)
+        {
+            return;
+        }
+
+        // AGAS can be asked asynchronously only once the runtime is up and
+        // running
+        if (!hpx::is_running() || hpx::threads::get_self_ptr() == nullptr)
+        {
+            return;
+        }
+
+        std::size_t const count = range_size_;
+        next_count_ = count;
+        next_lower_ =
+            hpx::async([count]() { return hpx::agas::get_next_id(count); });
     }
 }    // namespace hpx::util
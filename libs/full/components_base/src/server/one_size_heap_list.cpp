@@ -13,13 +13,16 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/synchronization.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
 #include <hpx/runtime_local/state.hpp>
 #include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 #if defined(HPX_DEBUG)
 #include <hpx/modules/logging.hpp>
 #endif
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <mutex>
@@ -35,6 +38,8 @@ namespace hpx::util {
 
     one_size_heap_list::~one_size_heap_list() noexcept
     {
+        flush_magazines();
+
 #if defined(HPX_DEBUG)
         LOSH_(info).format(
             "{1}::~{1}: size({2}), max_count({3}), alloc_count({4}), "
@@ -59,6 +64,15 @@ namespace hpx::util {
         }
 
         void* p = nullptr;
+        if (count == 1 && (p = alloc_cached()) != nullptr)
+        {
+#if defined(HPX_DEBUG)
+            ++alloc_count_;
+            if (alloc_count_ - free_count_ > max_alloc_count_)
+                max_alloc_count_ = alloc_count_ - free_count_;
+#endif
+            return p;
+        }
 
         {
             std::shared_lock<hpx::shared_mutex> sl(rwlock_);
@@ -150,20 +164,22 @@ namespace hpx::util {
         if (reschedule(p, count))
             return;
 
+        if (count == 1 && free_cached(p))
         {
-            std::shared_lock<hpx::shared_mutex> sl(rwlock_);
+#if defined(HPX_DEBUG)
+            ++free_count_;
+#endif
+            return;
+        }
 
-            // Find the heap which allocated this pointer.
-            for (auto const& heap : heap_list_)
+        {
+            std::shared_lock<hpx::shared_mutex> sl(rwlock_);
+            if (free_locked(p, count))
             {
-                if (heap->did_alloc(p))
-                {
-                    heap->free(p, count);
 #if defined(HPX_DEBUG)
-                    free_count_ += count;
+                free_count_ += count;
 #endif
-                    return;
-                }
+                return;
             }
         }
 
@@ -171,6 +187,184 @@ namespace hpx::util {
             "pointer {1} was not allocated by this {2}", p, name());
     }
 
+    // rwlock_ must be held
+    bool one_size_heap_list::free_locked(void* p, std::size_t count)
+    {
+        // Find the heap which allocated this pointer.
+        for (auto const& heap : heap_list_)
+        {
+            if (heap->did_alloc(p))
+            {
+                heap->free(p, count);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The magazine of a worker thread is accessed only by the HPX threads
+    // running on that worker, and only in between suspension points. This is
+    // why no synchronization is needed. Note that acquiring rwlock_ (or any
+    // lock taken by a heap) may suspend the current HPX thread, which may be
+    // resumed on a different worker. A magazine must not be accessed across
+    // such a suspension point, it has to be looked up again afterwards.
+    one_size_heap_list::magazine* one_size_heap_list::get_magazine()
+    {
+        if (threads::get_self_ptr() == nullptr)
+        {
+            return nullptr;
+        }
+
+        hpx::call_once(magazines_initialized_, [this]() {
+            std::size_t const num_threads = hpx::get_num_worker_threads();
+            magazines_.reset(
+                new util::cache_aligned_data<magazine>[num_threads]);
+            num_magazines_ = num_threads;
+        });
+
+        std::size_t const num_thread = hpx::get_worker_thread_num();
+        if (num_thread >= num_magazines_)
+        {
+            return nullptr;
+        }
+        return &magazines_[num_thread].data_;
+    }
+
+    // The magazines cache slots which were never handed out only. Freed
+    // slots are returned to their heap, the global id of an object is derived
+    // from its address and must not be reused by another object while the
+    // id range of the heap is still bound.
+    void* one_size_heap_list::alloc_cached()
+    {
+        magazine* m = get_magazine();
+        if (m == nullptr)
+        {
+            return nullptr;
+        }
+
+        if (m->count != 0)
+        {
+            return m->objects[--m->count];
+        }
+
+        // Refill the magazine from the heaps using a single lock acquisition.
+        // Allocating from a heap may suspend the current HPX thread as well,
+        // the objects are collected into a local buffer and are moved into
+        // the magazine only after the lock was released.
+        void* objects[magazine_batch];
+        std::size_t count = 0;
+        {
+            std::shared_lock<hpx::shared_mutex> sl(rwlock_);
+            for (auto const& heap : heap_list_)
+            {
+                void* p = nullptr;
+                while (count != magazine_batch && heap->alloc(&p, 1))
+                {
+                    objects[count++] = p;
+                }
+                if (count == magazine_batch)
+                {
+                    break;
+                }
+            }
+        }
+
+        if (count == 0)
+        {
+            return nullptr;    // all heaps are exhausted
+        }
+
+        // The first object is returned, the others are cached as long as
+        // the (possibly different) magazine has room for them.
+        std::size_t i = 1;
+        m = get_magazine();
+        if (m != nullptr)
+        {
+            for (/**/; i != count && m->count != magazine_batch; ++i)
+            {
+                m->objects[m->count++] = objects[i];
+            }
+        }
+
+        if (i != count)
+        {
+            std::shared_lock<hpx::shared_mutex> sl(rwlock_);
+            for (/**/; i != count; ++i)
+            {
+                [[maybe_unused]] bool const freed = free_locked(objects[i], 1);
+                HPX_ASSERT(freed);
+            }
+        }
+
+        return objects[0];
+    }
+
+    bool one_size_heap_list::free_cached(void* p)
+    {
+        HPX_ASSERT(did_alloc(p));
+
+        magazine* m = get_magazine();
+        if (m == nullptr)
+        {
+            return false;
+        }
+
+        m->freed[m->num_freed++] = p;
+        if (m->num_freed != magazine_batch)
+        {
+            return true;
+        }
+
+        // return the collected objects to their heaps using a single lock
+        // acquisition
+        void* objects[magazine_batch];
+        std::copy_n(m->freed, magazine_batch, objects);
+        m->num_freed = 0;
+
+        std::shared_lock<hpx::shared_mutex> sl(rwlock_);
+        for (void* q : objects)
+        {
+            [[maybe_unused]] bool const freed = free_locked(q, 1);
+            HPX_ASSERT(freed);
+        }
+        return true;
+    }
+
+    // A heap is released only once all of its slots were returned, this
+    // includes the slots held by the magazines.
+    void one_size_heap_list::flush_magazines() noexcept
+    {
+        if (!magazines_ || !threads::threadmanager_is(hpx::state::running))
+        {
+            return;
+        }
+
+        try
+        {
+            std::shared_lock<hpx::shared_mutex> sl(rwlock_);
+            for (std::size_t i = 0; i != num_magazines_; ++i)
+            {
+                magazine& m = magazines_[i].data_;
+                for (std::size_t j = 0; j != m.count; ++j)
+                {
+                    free_locked(m.objects[j], 1);
+                }
+                m.count = 0;
+
+                for (std::size_t j = 0; j != m.num_freed; ++j)
+                {
+                    free_locked(m.freed[j], 1);
+                }
+                m.num_freed = 0;
+            }
+        }
+        catch (...)
+        {
+            // releasing the heaps is not essential at this point
+        }
+    }
+
     bool one_size_heap_list::did_alloc(void* p) const
     {
         std::shared_lock<hpx::shared_mutex> sl(rwlock_);
@@ -0,0 +1,163 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Allocate and free objects from a one_size_heap_list concurrently from many
+// HPX threads. The threads suspend while holding objects, which allows them
+// to be resumed on a different worker thread. Every object is tagged with
+// its owner, an object handed out twice would be overwritten by the second
+// owner. Freed objects must not be handed out again while their heap is
+// still in use, as the global id of an object is derived from its address.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/components_base/server/one_size_heap_list.hpp>
+#include <hpx/components_base/server/wrapper_heap.hpp>
+#include <hpx/future.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct tag
+{
+    std::size_t task;
+    std::size_t index;
+};
+
+std::vector<void*> alloc_and_free(hpx::util::one_size_heap_list& heaps,
+    std::size_t task, std::size_t iterations)
+{
+    std::vector<void*> all_objects;
+    std::vector<void*> objects;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        // allocate a varying number of objects to exercise refilling and
+        // draining the magazines
+        std::size_t const count = 1 + (task * 7 + i * 13) % 150;
+        for (std::size_t j = 0; j != count; ++j)
+        {
+            void* p = heaps.alloc();
+            *static_cast<tag*>(p) = tag{task, j};
+            objects.push_back(p);
+        }
+
+        hpx::this_thread::yield();
+
+        // no other thread may have been handed out any of our objects
+        for (std::size_t j = 0; j != count; ++j)
+        {
+            tag const* t = static_cast<tag const*>(objects[j]);
+            HPX_TEST_EQ(t->task, task);
+            HPX_TEST_EQ(t->index, j);
+        }
+
+        // keep the objects allocated last, free all others alternating in
+        // allocation order and in reverse order
+        if (i + 1 == iterations)
+        {
+            all_objects = objects;
+        }
+        else if (i % 2 == 0)
+        {
+            std::for_each(objects.begin(), objects.end(),
+                [&](void* p) { heaps.free(p); });
+        }
+        else
+        {
+            std::for_each(objects.rbegin(), objects.rend(),
+                [&](void* p) { heaps.free(p); });
+        }
+        objects.clear();
+    }
+    return all_objects;
+}
+
+using heap_type = hpx::components::detail::wrapper_heap;
+
+void no_reuse_test()
+{
+    hpx::util::one_size_heap_list heaps(std::string("no_reuse_test"),
+        hpx::util::one_size_heap_list::heap_parameters{
+            1024, alignof(tag), sizeof(tag)},
+        static_cast<heap_type*>(nullptr));
+
+    // keeps the heap alive
+    void* keep_alive = heaps.alloc();
+
+    std::vector<void*> freed;
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        freed.push_back(heaps.alloc());
+    }
+    for (void* p : freed)
+    {
+        heaps.free(p);
+    }
+
+    std::sort(freed.begin(), freed.end());
+    std::vector<void*> objects;
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        void* p = heaps.alloc();
+        HPX_TEST(p != keep_alive);
+        HPX_TEST(!std::binary_search(freed.begin(), freed.end(), p));
+        objects.push_back(p);
+    }
+
+    for (void* p : objects)
+    {
+        heaps.free(p);
+    }
+    heaps.free(keep_alive);
+}
+
+int main()
+{
+    no_reuse_test();
+
+    // small heaps make the magazines fall back to the heap list frequently
+    hpx::util::one_size_heap_list heaps(std::string("test"),
+        hpx::util::one_size_heap_list::heap_parameters{
+            64, alignof(tag), sizeof(tag)},
+        static_cast<heap_type*>(nullptr));
+
+    std::size_t const num_tasks = 4 * hpx::get_os_thread_count() + 3;
+
+    std::vector<hpx::future<std::vector<void*>>> tasks;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(
+            hpx::async(&alloc_and_free, std::ref(heaps), i, 200));
+    }
+
+    // the objects still allocated have to be distinct
+    std::vector<void*> objects;
+    for (auto& f : tasks)
+    {
+        std::vector<void*> task_objects = f.get();
+        objects.insert(objects.end(), task_objects.begin(), task_objects.end());
+    }
+
+    std::sort(objects.begin(), objects.end());
+    HPX_TEST(std::adjacent_find(objects.begin(), objects.end()) ==
+        objects.end());
+
+    for (void* p : objects)
+    {
+        HPX_TEST(heaps.did_alloc(p));
+        heaps.free(p);
+    }
+
+    return hpx::util::report_errors();
+}
+#endif
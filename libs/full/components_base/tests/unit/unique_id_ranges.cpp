@@ -0,0 +1,110 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/components_base/generate_unique_ids.hpp>
+#include <hpx/future.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<hpx::naming::gid_type> get_ids(
+    hpx::util::unique_id_ranges& ids, std::size_t count, std::size_t chunk)
+{
+    std::vector<hpx::naming::gid_type> result;
+    result.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        hpx::naming::gid_type const id = ids.get_id(chunk);
+        for (std::size_t j = 0; j != chunk; ++j)
+        {
+            result.push_back(id + j);
+        }
+    }
+    return result;
+}
+
+void test_unique_ids(std::size_t chunk)
+{
+    std::size_t const num_tasks = 8;
+    std::size_t const count = 10000;
+
+    hpx::util::unique_id_ranges ids;
+
+    // start with a small range to force requesting further ranges from AGAS
+    hpx::naming::gid_type const lower = hpx::agas::get_next_id(16);
+    ids.set_range(lower, lower + 16);
+
+    std::vector<hpx::future<std::vector<hpx::naming::gid_type>>> tasks;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async(&get_ids, std::ref(ids), count, chunk));
+    }
+
+    std::vector<hpx::naming::gid_type> all_ids;
+    for (auto& f : tasks)
+    {
+        std::vector<hpx::naming::gid_type> task_ids = f.get();
+        all_ids.insert(all_ids.end(), task_ids.begin(), task_ids.end());
+    }
+
+    HPX_TEST_EQ(all_ids.size(), num_tasks * count * chunk);
+
+    // all generated ids must be unique
+    std::sort(all_ids.begin(), all_ids.end());
+    HPX_TEST(std::adjacent_find(all_ids.begin(), all_ids.end()) ==
+        all_ids.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// requesting more ids than were prefetched and installing a new range both
+// drop the prefetched range
+void test_prefetch_reset()
+{
+    hpx::util::unique_id_ranges ids;
+
+    hpx::naming::gid_type const lower = hpx::agas::get_next_id(16);
+    ids.set_range(lower, lower + 16);
+
+    // using more than half of the range triggers the prefetch
+    for (std::size_t i = 0; i != 9; ++i)
+    {
+        HPX_TEST_EQ(ids.get_id(), lower + i);
+    }
+
+    std::size_t const large_count = 0x1000000;
+    hpx::naming::gid_type const large = ids.get_id(large_count);
+    HPX_TEST(large >= lower + 16 || large + large_count <= lower);
+
+    hpx::naming::gid_type const next_lower = hpx::agas::get_next_id(16);
+    ids.set_range(next_lower, next_lower + 16);
+    for (std::size_t i = 0; i != 16; ++i)
+    {
+        HPX_TEST_EQ(ids.get_id(), next_lower + i);
+    }
+
+    // the range was exhausted, the next id comes from a new range
+    hpx::naming::gid_type const id = ids.get_id();
+    HPX_TEST(id >= next_lower + 16 || id < next_lower);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_unique_ids(1);
+    test_unique_ids(7);
+    test_prefetch_reset();
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,291 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file data_affinity_distribution_policy.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/traits/extract_action.hpp>
+#include <hpx/actions_base/traits/is_distribution_policy.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_distributed/detail/async_implementations.hpp>
+#include <hpx/async_distributed/detail/post.hpp>
+#include <hpx/components/client_base.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/traits/promise_local_result.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_components/create_component_helpers.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::traits {
+
+    /// Customization point to specify the (approximate) number of bytes which
+    /// have to be transferred if a component of the given type is accessed
+    /// remotely. Components with unknown size count as one byte.
+    template <typename Component, typename Enable = void>
+    struct component_data_size
+    {
+        static constexpr std::size_t value = 1;
+    };
+}    // namespace hpx::traits
+
+namespace hpx::components {
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        // Accumulates the number of bytes referenced by the arguments of an
+        // action per locality.
+        class HPX_EXPORT data_affinity
+        {
+        public:
+            void add(hpx::id_type const& id, std::size_t size);
+
+            template <typename T>
+            void add([[maybe_unused]] T const& arg)
+            {
+                if constexpr (std::is_same_v<T, hpx::id_type>)
+                {
+                    add(arg, 1);
+                }
+                else if constexpr (hpx::traits::is_client_v<T>)
+                {
+                    // don't wait for the client to become ready, its location
+                    // is not known yet
+                    if (arg.valid() && arg.is_ready() && !arg.has_exception())
+                    {
+                        add(arg.get_id(),
+                            hpx::traits::component_data_size<
+                                typename T::server_component_type>::value);
+                    }
+                }
+            }
+
+            template <typename T, typename Allocator>
+            void add(std::vector<T, Allocator> const& v)
+            {
+                for (auto const& item : v)
+                {
+                    add(item);
+                }
+            }
+
+            // Return the locality the most bytes are located on, preferring
+            // the calling locality.
+            [[nodiscard]] hpx::id_type get_target() const;
+
+        private:
+            std::vector<std::pair<std::uint32_t, std::size_t>> sizes_;
+        };
+
+        template <typename... Ts>
+        hpx::id_type get_data_affinity_target(Ts const&... vs)
+        {
+            data_affinity affinity;
+            (affinity.add(vs), ...);
+            return affinity.get_target();
+        }
+    }    // namespace detail
+    /// \endcond
+
+    /// This class specifies a distribution policy which runs (plain) actions,
+    /// or creates new objects, on the locality where most of the objects
+    /// referenced by the arguments are located.
+    ///
+    /// All arguments of type \a hpx::id_type, client objects, and vectors of
+    /// those are taken into account. Their current location is looked up in
+    /// the local AGAS cache, no remote lookups are performed. The objects
+    /// referenced by client objects are weighted by the size of their
+    /// component type (see \a hpx::traits::component_data_size). The action
+    /// is run on the locality which minimizes the number of bytes to
+    /// transfer. If no arguments reference any objects, the action is run
+    /// locally.
+    struct data_affinity_distribution_policy
+    {
+        /// Default-construct a new instance of a
+        /// \a data_affinity_distribution_policy.
+        constexpr data_affinity_distribution_policy() = default;
+
+        /// Create one object on the locality most of the objects referenced
+        /// by the constructor arguments are located on
+        ///
+        /// \param vs  [in] The arguments which will be forwarded to the
+        ///            constructor of the new object.
+        ///
+        /// \note This function is part of the placement policy implemented by
+        ///       this class
+        ///
+        /// \returns A future holding the global address which represents
+        ///          the newly created object
+        ///
+        template <typename Component, typename... Ts>
+        hpx::future<hpx::id_type> create(Ts&&... vs) const
+        {
+            hpx::id_type target = detail::get_data_affinity_target(vs...);
+            return create_async<Component>(target, HPX_FORWARD(Ts, vs)...);
+        }
+
+        /// \cond NOINTERNAL
+        using bulk_locality_result =
+            std::pair<hpx::id_type, std::vector<hpx::id_type>>;
+        /// \endcond
+
+        /// Create multiple objects on the locality most of the objects
+        /// referenced by the constructor arguments are located on
+        ///
+        /// \param count [in] The number of objects to create
+        /// \param vs   [in] The arguments which will be forwarded to the
+        ///             constructors of the new objects.
+        ///
+        /// \note This function is part of the placement policy implemented by
+        ///       this class
+        ///
+        /// \returns A future holding the list of global addresses which
+        ///          represent the newly created objects
+        ///
+        template <bool WithCount, typename Component, typename... Ts>
+        hpx::future<std::vector<bulk_locality_result>> bulk_create(
+            std::size_t count, Ts&&... vs) const
+        {
+            hpx::id_type id = detail::get_data_affinity_target(vs...);
+
+            hpx::future<std::vector<hpx::id_type>> f;
+            if constexpr (WithCount)
+            {
+                f = bulk_create_async<WithCount, Component>(
+                    id, count, 0, HPX_FORWARD(Ts, vs)...);
+            }
+            else
+            {
+                f = bulk_create_async<WithCount, Component>(
+                    id, count, HPX_FORWARD(Ts, vs)...);
+            }
+
+            return f.then(hpx::launch::sync,
+                [id = HPX_MOVE(id)](hpx::future<std::vector<hpx::id_type>>&& f)
+                    -> std::vector<bulk_locality_result> {
+                    std::vector<bulk_locality_result> result;
+                    result.emplace_back(id, f.get());
+                    return result;
+                });
+        }
+
+        /// \note This function is part of the invocation policy implemented by
+        ///       this class
+        ///
+        template <typename Action>
+        struct async_result
+        {
+            using type = hpx::future<
+                typename traits::promise_local_result<typename hpx::traits::
+                        extract_action<Action>::remote_result_type>::type>;
+        };
+
+        template <typename Action, typename... Ts>
+        typename async_result<Action>::type async(
+            launch policy, Ts&&... vs) const
+        {
+            return hpx::detail::async_impl<Action>(policy,
+                detail::get_data_affinity_target(vs...),
+                HPX_FORWARD(Ts, vs)...);
+        }
+
+        /// \note This function is part of the invocation policy implemented by
+        ///       this class
+        ///
+        template <typename Action, typename Callback, typename... Ts>
+        typename async_result<Action>::type async_cb(
+            launch policy, Callback&& cb, Ts&&... vs) const
+        {
+            return hpx::detail::async_cb_impl<Action>(policy,
+                detail::get_data_affinity_target(vs...),
+                HPX_FORWARD(Callback, cb), HPX_FORWARD(Ts, vs)...);
+        }
+
+        /// \note This function is part of the invocation policy implemented by
+        ///       this class
+        ///
+        template <typename Action, typename Continuation, typename... Ts>
+        bool apply(Continuation&& c, launch policy, Ts&&... vs) const
+        {
+            return hpx::detail::post_impl<Action>(HPX_FORWARD(Continuation, c),
+                detail::get_data_affinity_target(vs...), policy,
+                HPX_FORWARD(Ts, vs)...);
+        }
+
+        template <typename Action, typename... Ts>
+        bool apply(launch policy, Ts&&... vs) const
+        {
+            return hpx::detail::post_impl<Action>(
+                detail::get_data_affinity_target(vs...), policy,
+                HPX_FORWARD(Ts, vs)...);
+        }
+
+        /// \note This function is part of the invocation policy implemented by
+        ///       this class
+        ///
+        template <typename Action, typename Continuation, typename Callback,
+            typename... Ts>
+        bool apply_cb(
+            Continuation&& c, launch policy, Callback&& cb, Ts&&... vs) const
+        {
+            return hpx::detail::post_cb_impl<Action>(
+                HPX_FORWARD(Continuation, c),
+                detail::get_data_affinity_target(vs...), policy,
+                HPX_FORWARD(Callback, cb), HPX_FORWARD(Ts, vs)...);
+        }
+
+        template <typename Action, typename Callback, typename... Ts>
+        bool apply_cb(launch policy, Callback&& cb, Ts&&... vs) const
+        {
+            return hpx::detail::post_cb_impl<Action>(
+                detail::get_data_affinity_target(vs...), policy,
+                HPX_FORWARD(Callback, cb), HPX_FORWARD(Ts, vs)...);
+        }
+
+        /// Returns the number of associated localities for this distribution
+        /// policy
+        ///
+        /// \note This function is part of the creation policy implemented by
+        ///       this class
+        ///
+        [[nodiscard]] static std::size_t get_num_localities()
+        {
+            return 1;
+        }
+
+        /// Returns the locality which is anticipated to be used for the next
+        /// async operation
+        [[nodiscard]] static hpx::id_type get_next_target()
+        {
+            return naming::get_id_from_locality_id(agas::get_locality_id());
+        }
+    };
+
+    /// A predefined instance of the data affinity \a distribution_policy.
+    static data_affinity_distribution_policy const data_affinity{};
+}    // namespace hpx::components
+
+/// \cond NOINTERNAL
+namespace hpx {
+
+    using hpx::components::data_affinity;
+    using hpx::components::data_affinity_distribution_policy;
+
+    template <>
+    struct traits::is_distribution_policy<
+        components::data_affinity_distribution_policy> : std::true_type
+    {
+    };    // namespace traits
+}    // namespace hpx
+/// \endcond
@@ -0,0 +1,69 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/distribution_policies/data_affinity_distribution_policy.hpp>
+#include <hpx/naming_base/address.hpp>
+#include <hpx/naming_base/id_type.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace hpx::components::detail {
+
+    void data_affinity::add(hpx::id_type const& id, std::size_t size)
+    {
+        if (!id)
+        {
+            return;
+        }
+
+        naming::gid_type const& gid = id.get_gid();
+
+        // Objects which can't be migrated are located on the locality encoded
+        // in their global id. The current location of all other objects is
+        // taken from the AGAS cache, if known.
+        std::uint32_t locality_id = naming::get_locality_id_from_gid(gid);
+        if (naming::detail::is_migratable(gid))
+        {
+            naming::address addr;
+            if (agas::resolve_cached(gid, addr) && addr)
+            {
+                locality_id = naming::get_locality_id_from_gid(addr.locality_);
+            }
+        }
+
+        for (auto& p : sizes_)
+        {
+            if (p.first == locality_id)
+            {
+                p.second += size;
+                return;
+            }
+        }
+        sizes_.emplace_back(locality_id, size);
+    }
+
+    hpx::id_type data_affinity::get_target() const
+    {
+        std::uint32_t const here = agas::get_locality_id();
+
+        std::uint32_t target = here;
+        std::size_t max_size = 0;
+        for (auto const& p : sizes_)
+        {
+            if (p.second > max_size || (p.second == max_size && p.first == here))
+            {
+                target = p.first;
+                max_size = p.second;
+            }
+        }
+
+        return naming::get_id_from_locality_id(target);
+    }
+}    // namespace hpx::components::detail
@@ -0,0 +1,131 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server : hpx::components::component_base<test_server>
+{
+    test_server() = default;
+
+    explicit test_server(hpx::id_type const&) {}
+
+    hpx::id_type call() const
+    {
+        return hpx::find_here();
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call)
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+typedef test_server::call_action call_action;
+HPX_REGISTER_ACTION(call_action)
+
+struct large_server : hpx::components::component_base<large_server>
+{
+};
+
+typedef hpx::components::component<large_server> large_server_type;
+HPX_REGISTER_COMPONENT(large_server_type, large_server)
+
+struct large_client
+  : hpx::components::client_base<large_client, large_server>
+{
+    using base_type = hpx::components::client_base<large_client, large_server>;
+
+    large_client() = default;
+    large_client(hpx::future<hpx::id_type>&& id)
+      : base_type(std::move(id))
+    {
+    }
+};
+
+template <>
+struct hpx::traits::component_data_size<large_server>
+{
+    static constexpr std::size_t value = 1024 * 1024;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::id_type where(hpx::id_type const&, hpx::id_type const&)
+{
+    return hpx::find_here();
+}
+HPX_PLAIN_ACTION(where, where_action)
+
+hpx::id_type where_vector(std::vector<hpx::id_type> const&)
+{
+    return hpx::find_here();
+}
+HPX_PLAIN_ACTION(where_vector, where_vector_action)
+
+hpx::id_type where_client(large_client const&, hpx::id_type const&)
+{
+    return hpx::find_here();
+}
+HPX_PLAIN_ACTION(where_client, where_client_action)
+
+hpx::id_type where_nothing(int)
+{
+    return hpx::find_here();
+}
+HPX_PLAIN_ACTION(where_nothing, where_nothing_action)
+
+///////////////////////////////////////////////////////////////////////////////
+void test_data_affinity(hpx::id_type const& loc)
+{
+    hpx::id_type id1 = hpx::new_<test_server>(loc).get();
+    hpx::id_type id2 = hpx::new_<test_server>(loc).get();
+
+    // the action runs where both arguments are located
+    HPX_TEST_EQ(
+        hpx::async<where_action>(hpx::data_affinity, id1, id2).get(), loc);
+
+    // the majority of the referenced objects decides
+    hpx::id_type here = hpx::new_<test_server>(hpx::find_here()).get();
+    std::vector<hpx::id_type> ids = {id1, here, id2};
+    HPX_TEST_EQ(
+        hpx::async<where_vector_action>(hpx::data_affinity, ids).get(), loc);
+
+    // objects of known size outweigh objects of unknown size
+    large_client large = hpx::new_<large_server>(hpx::find_here());
+    large.wait();
+    HPX_TEST_EQ(hpx::async<where_client_action>(hpx::data_affinity, large, id1)
+                    .get(),
+        hpx::find_here());
+
+    // new objects are created where their constructor arguments are located
+    hpx::id_type created = hpx::new_<test_server>(hpx::data_affinity, id1).get();
+    HPX_TEST_EQ(hpx::async<call_action>(created).get(), loc);
+}
+
+int main()
+{
+    for (hpx::id_type const& loc : hpx::find_all_localities())
+    {
+        test_data_affinity(loc);
+    }
+
+    // actions not referencing any objects are run locally
+    HPX_TEST_EQ(hpx::async<where_nothing_action>(hpx::data_affinity, 42).get(),
+        hpx::find_here());
+
+    return hpx::util::report_errors();
+}
+#endif
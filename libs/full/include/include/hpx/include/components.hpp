@@ -45,6 +45,7 @@
 
 #include <hpx/distribution_policies/binpacking_distribution_policy.hpp>
 #include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+#include <hpx/distribution_policies/data_affinity_distribution_policy.hpp>
 #include <hpx/distribution_policies/default_distribution_policy.hpp>
 #include <hpx/distribution_policies/target_distribution_policy.hpp>
 #include <hpx/distribution_policies/unwrapping_result_policy.hpp>
@@ -10,6 +10,7 @@
 #include <hpx/hpx_init.hpp>
 #include <algorithm>
 
+#include <hpx/allocator_support/task_arena.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/command_line_handling/command_line_handling.hpp>
 #include <hpx/coroutines/detail/context_impl.hpp>
@@ -38,6 +39,7 @@
 #include <hpx/program_options/parsers.hpp>
 #include <hpx/program_options/variables_map.hpp>
 #include <hpx/resource_partitioner/partitioner.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime_local/custom_exception_info.hpp>
 #include <hpx/runtime_local/debugging.hpp>
@@ -53,6 +55,7 @@
 #include <hpx/string_util/split.hpp>
 #include <hpx/threading/thread.hpp>
 #include <hpx/threading_base/detail/get_default_timer_service.hpp>
+#include <hpx/threading_base/thread_data.hpp>
 #include <hpx/type_support/pack.hpp>
 #include <hpx/type_support/unused.hpp>
 #include <hpx/util/from_string.hpp>
@@ -798,6 +801,8 @@ namespace hpx {
             hpx::threads::detail::set_get_default_timer_service(
                 &hpx::detail::get_default_timer_service);
             hpx::threads::detail::set_get_locality_id(&get_locality_id);
+            hpx::memory::detail::set_get_task_arena(
+                &hpx::threads::detail::get_self_task_arena);
             hpx::parallel::execution::detail::set_get_pu_mask(
                 &hpx::detail::get_pu_mask);
             hpx::parallel::execution::detail::set_get_os_thread_count(
@@ -877,6 +882,8 @@ namespace hpx {
                     return result;
                 }
 
+                hpx::util::reset_startup_timings();
+
 #if defined(HPX_HAVE_NETWORKING)
                 hpx::util::command_line_handling cmdline{
                     hpx::util::runtime_configuration(argv[0], params.mode,
@@ -887,6 +894,7 @@ namespace hpx {
                     hpx::util::runtime_configuration(argv[0], params.mode, {}),
                     hpx_startup::user_main_config(params.cfg), f};
 #endif
+                hpx::util::mark_startup_stage("configuration");
 
                 std::vector<
                     std::shared_ptr<components::component_registry_base>>
@@ -901,6 +909,7 @@ namespace hpx {
                         params.desc_cmdline, argc, argv, component_registries);
 
                     init_environment(cmdline.rtcfg_);
+                    hpx::util::mark_startup_stage("command line handling");
 
                     hpx::threads::policies::detail::affinity_data
                         affinity_data{};
@@ -949,6 +958,7 @@ namespace hpx {
 #endif
                     // Setup all internal parameters of the resource_partitioner
                     rp.configure_pools();
+                    hpx::util::mark_startup_stage("resource partitioner");
                 }
                 catch (hpx::exception const& e)
                 {
@@ -996,6 +1006,8 @@ namespace hpx {
 #endif
                 }
 
+                hpx::util::mark_startup_stage("runtime construction");
+
                 // Store application defined command line options
                 rt->set_app_options(params.desc_cmdline);
 
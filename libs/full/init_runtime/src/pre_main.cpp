@@ -26,6 +26,7 @@
 #include <hpx/performance_counters/threadmanager_counter_types.hpp>
 #include <hpx/runtime_components/console_logging.hpp>
 #include <hpx/runtime_configuration/runtime_mode.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 #include <hpx/runtime_distributed.hpp>
 #include <hpx/runtime_distributed/applier.hpp>
 #include <hpx/runtime_distributed/runtime_fwd.hpp>
@@ -116,6 +117,7 @@ namespace hpx { namespace detail {
             exit_code = runtime_support::load_components(find_here());
             lbt_ << "(2nd stage) pre_main: loaded components"
                  << (exit_code ? ", application exit has been requested" : "");
+            hpx::util::mark_startup_stage("component loading");
 
             // Work on registration requests for message handler plugins
 #if defined(HPX_HAVE_NETWORKING)
@@ -124,14 +126,17 @@ namespace hpx { namespace detail {
             // Register all counter types before the startup functions are being
             // executed.
             register_counter_types();
+            hpx::util::mark_startup_stage("counter registration");
 
             rt.set_state(hpx::state::pre_startup);
             runtime_support::call_startup_functions(find_here(), true);
             lbt_ << "(3rd stage) pre_main: ran pre-startup functions";
+            hpx::util::mark_startup_stage("pre-startup functions");
 
             rt.set_state(hpx::state::startup);
             runtime_support::call_startup_functions(find_here(), false);
             lbt_ << "(4th stage) pre_main: ran startup functions";
+            hpx::util::mark_startup_stage("startup functions");
         }
         else
         {
@@ -141,6 +146,7 @@ namespace hpx { namespace detail {
             exit_code = runtime_support::load_components(find_here());
             lbt_ << "(2nd stage) pre_main: loaded components"
                  << (exit_code ? ", application exit has been requested" : "");
+            hpx::util::mark_startup_stage("component loading");
 
             // Second and third stage barrier creation.
             if (agas_client.is_bootstrap())
@@ -189,6 +195,7 @@ namespace hpx { namespace detail {
             // Register all counter types before the startup functions are being
             // executed.
             register_counter_types();
+            hpx::util::mark_startup_stage("counter registration");
 
             // Second stage bootstrap synchronizes performance counter loading
             // across all localities.
@@ -197,6 +204,7 @@ namespace hpx { namespace detail {
 
             runtime_support::call_startup_functions(find_here(), true);
             lbt_ << "(3rd stage) pre_main: ran pre-startup functions";
+            hpx::util::mark_startup_stage("pre-startup functions");
 
             // Third stage separates pre-startup and startup function phase.
             distributed::barrier::synchronize();
@@ -204,6 +212,7 @@ namespace hpx { namespace detail {
 
             runtime_support::call_startup_functions(find_here(), false);
             lbt_ << "(4th stage) pre_main: ran startup functions";
+            hpx::util::mark_startup_stage("startup functions");
 
             // Forth stage bootstrap synchronizes startup functions across all
             // localities. This is done after component loading to guarantee that
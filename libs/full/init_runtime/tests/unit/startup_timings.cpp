@@ -0,0 +1,78 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the runtime records its startup stages and that enabling the
+// on-demand loading of component modules does not interfere with the
+// startup sequence.
+
+#include <hpx/init.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_configuration/deferred_modules.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+char const* const module_cache_file = "startup_timings_test.module_cache";
+
+int hpx_main()
+{
+    std::vector<std::pair<std::string, double>> const timings =
+        hpx::util::get_startup_timings();
+
+    for (auto const& [name, elapsed] : timings)
+    {
+        HPX_TEST(!name.empty());
+        HPX_TEST_LTE(0.0, elapsed);
+    }
+
+    // the essential stages have to be recorded in the order they are run
+    auto it = timings.begin();
+    for (char const* stage : {"configuration", "module discovery",
+             "component loading", "startup functions"})
+    {
+        it = std::find_if(it, timings.end(),
+            [&](auto const& p) { return p.first == stage; });
+        HPX_TEST_MSG(it != timings.end(), stage);
+    }
+
+    // the module cache is written right after the modules were discovered
+    std::ifstream ifs(module_cache_file);
+    HPX_TEST(ifs.is_open());
+
+    std::string header;
+    HPX_TEST(static_cast<bool>(std::getline(ifs, header)));
+    HPX_TEST_EQ(header.rfind("hpx-module-cache|", 0), std::size_t(0));
+
+    // loading the deferred modules explicitly is always allowed, a second
+    // attempt never finds anything left to load
+    hpx::util::load_deferred_modules();
+    HPX_TEST(!hpx::util::load_deferred_modules());
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::remove(module_cache_file);
+
+    hpx::init_params init_args;
+    init_args.cfg = {"hpx.startup_timings=1", "hpx.load_modules_on_demand=1",
+        std::string("hpx.module_cache=") + module_cache_file};
+
+    HPX_TEST_EQ(0, hpx::init(argc, argv, init_args));
+
+    std::remove(module_cache_file);
+
+    return hpx::util::report_errors();
+}
@@ -13,13 +13,23 @@
 #include <hpx/async_distributed/post.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
 #include <hpx/lcos_distributed/server/channel.hpp>
 #include <hpx/modules/naming.hpp>
 #include <hpx/runtime_components/new.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx::lcos {
 
@@ -557,11 +567,357 @@ namespace hpx::lcos {
             return close(launch::sync, force_delete_entries);
         }
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The channel_writer streams values to a (possibly remote) channel. Values
+    // are collected into batches of the given size which are sent to the
+    // channel using a single action each. At most 'credits' batches may be
+    // in flight at any point in time: a batch returns its credit once all of
+    // its values have been retrieved from the channel. Sending a batch while
+    // no credit is available suspends the writer, which limits the memory
+    // used by the channel for buffering values if the consumers can't keep
+    // up with the producer. The values sent by one writer are received in
+    // order.
+    //
+    // Note: the streaming interface does not support explicit generations,
+    // a channel_writer instance must not be used concurrently.
+    template <typename T>
+    class channel_writer
+    {
+        static_assert(!std::is_void_v<T>,
+            "channel_writer does not support channels of type void");
+
+        using set_values_action =
+            typename lcos::server::channel<T>::set_values_action;
+
+    public:
+        static constexpr std::size_t default_batch_size = 64;
+        static constexpr std::size_t default_credits = 4;
+
+        channel_writer() = default;
+
+        explicit channel_writer(channel<T> const& c,
+            std::size_t batch_size = default_batch_size,
+            std::size_t credits = default_credits)
+          : channel_(c)
+          , writer_(generate_writer_id())
+          , batch_size_(batch_size != 0 ? batch_size : 1)
+          , credits_(credits != 0 ? credits : 1)
+        {
+            buffer_.reserve(batch_size_);
+        }
+
+        channel_writer(channel_writer&&) = default;
+        channel_writer& operator=(channel_writer&&) = delete;
+
+        // sends all buffered values without waiting for credits
+        ~channel_writer()
+        {
+            if (channel_ && !closed_ && (sequence_ != 0 || !buffer_.empty()))
+            {
+                hpx::post(set_values_action(), channel_.get_id(),
+                    HPX_MOVE(buffer_), writer_, sequence_, true, false);
+            }
+        }
+
+        // add a value to the current batch, sends the batch once it is full
+        template <typename U>
+        void set(U&& val)
+        {
+            buffer_.emplace_back(HPX_FORWARD(U, val));
+            if (buffer_.size() >= batch_size_)
+            {
+                flush();
+            }
+        }
+
+        // send the current batch, waits for a credit to become available
+        void flush()
+        {
+            if (!buffer_.empty())
+            {
+                send(false);
+            }
+        }
+
+        // send the current batch and close the channel once all values
+        // previously sent by this writer have arrived
+        void close()
+        {
+            send(true);
+            closed_ = true;
+
+            // all credits are returned once the channel was closed
+            while (!in_flight_.empty())
+            {
+                wait_for_credit();
+            }
+        }
+
+        // number of batches currently waiting for their credit to be returned
+        std::size_t batches_in_flight() const noexcept
+        {
+            return in_flight_.size();
+        }
+
+        hpx::id_type const& get_id() const noexcept
+        {
+            return channel_.get_id();
+        }
+
+    private:
+        static std::uint64_t generate_writer_id()
+        {
+            static std::atomic<std::uint32_t> writer_count(0);
+            return (std::uint64_t(agas::get_locality_id()) << 32) |
+                ++writer_count;
+        }
+
+        void wait_for_credit()
+        {
+            hpx::future<void> f = HPX_MOVE(in_flight_.front());
+            in_flight_.pop_front();
+            f.get();
+        }
+
+        void send(bool close_channel)
+        {
+            while (in_flight_.size() >= credits_)
+            {
+                wait_for_credit();
+            }
+
+            in_flight_.push_back(hpx::async(set_values_action(),
+                channel_.get_id(), HPX_MOVE(buffer_), writer_, sequence_++,
+                close_channel, close_channel));
+
+            buffer_ = std::vector<T>();
+            buffer_.reserve(batch_size_);
+        }
+
+        channel<T> channel_;
+        std::uint64_t writer_ = 0;
+        std::size_t sequence_ = 0;
+        std::size_t batch_size_ = default_batch_size;
+        std::size_t credits_ = default_credits;
+        bool closed_ = false;
+        std::vector<T> buffer_;
+        std::deque<hpx::future<void>> in_flight_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The channel_reader retrieves values from a (possibly remote) channel in
+    // batches of up to 'prefetch' values. While the values of one batch are
+    // consumed, the next batch is already being requested from the channel.
+    // The channel_reader can be iterated over using the channel_iterator
+    // in the same way as a channel.
+    //
+    // Note: the streaming interface does not support explicit generations,
+    // a channel_reader instance must not be used concurrently. Values that
+    // were prefetched but not retrieved before the channel_reader is
+    // destroyed are lost.
+    template <typename T>
+    class channel_reader
+    {
+        static_assert(!std::is_void_v<T>,
+            "channel_reader does not support channels of type void");
+
+        using get_values_action =
+            typename lcos::server::channel<T>::get_values_action;
+
+        // The state is shared with the continuation attached to the batch
+        // currently being retrieved, which hands out the received values to
+        // the callers of get() waiting for them.
+        struct shared_state
+        {
+            using mutex_type = hpx::spinlock;
+
+            shared_state(channel<T> const& c, std::size_t prefetch)
+              : channel_(c)
+              , prefetch_(prefetch)
+            {
+            }
+
+            // mtx_ must be held
+            void request_next()
+            {
+                next_ = hpx::async(
+                    get_values_action(), channel_.get_id(), prefetch_);
+            }
+
+            static void on_batch(std::shared_ptr<shared_state> const& state,
+                hpx::future<std::vector<T>>&& f)
+            {
+                std::vector<hpx::promise<T>> waiting;
+                std::vector<T> values;
+                std::exception_ptr e;
+                hpx::future<std::vector<T>> next;
+                {
+                    std::lock_guard<mutex_type> l(state->mtx_);
+                    if (f.has_exception())
+                    {
+                        // fail all pending requests, the next call to get()
+                        // will retry
+                        e = f.get_exception_ptr();
+                        waiting.assign(
+                            std::make_move_iterator(state->waiting_.begin()),
+                            std::make_move_iterator(state->waiting_.end()));
+                        state->waiting_.clear();
+                    }
+                    else
+                    {
+                        std::vector<T> batch = f.get();
+                        state->buffer_.insert(state->buffer_.end(),
+                            std::make_move_iterator(batch.begin()),
+                            std::make_move_iterator(batch.end()));
+
+                        while (!state->waiting_.empty() &&
+                            !state->buffer_.empty())
+                        {
+                            waiting.push_back(
+                                HPX_MOVE(state->waiting_.front()));
+                            state->waiting_.pop_front();
+                            values.push_back(HPX_MOVE(state->buffer_.front()));
+                            state->buffer_.pop_front();
+                        }
+
+                        // prefetch the next batch while this one is being
+                        // consumed
+                        state->request_next();
+                        if (!state->waiting_.empty())
+                        {
+                            next = HPX_MOVE(state->next_);
+                        }
+                    }
+                }
+
+                for (std::size_t i = 0; i != waiting.size(); ++i)
+                {
+                    if (e)
+                    {
+                        waiting[i].set_exception(e);
+                    }
+                    else
+                    {
+                        waiting[i].set_value(HPX_MOVE(values[i]));
+                    }
+                }
+
+                if (next.valid())
+                {
+                    wait_for_batch(state, HPX_MOVE(next));
+                }
+            }
+
+            static void wait_for_batch(
+                std::shared_ptr<shared_state> const& state,
+                hpx::future<std::vector<T>>&& f)
+            {
+                f.then(hpx::launch::sync,
+                    [state](hpx::future<std::vector<T>>&& f) {
+                        on_batch(state, HPX_MOVE(f));
+                    });
+            }
+
+            channel<T> channel_;
+            std::size_t prefetch_;
+
+            mutex_type mtx_;
+            std::deque<T> buffer_;
+
+            // the callers waiting for a value, in order
+            std::deque<hpx::promise<T>> waiting_;
+
+            // the batch currently being requested, invalid while a
+            // continuation is attached to it
+            hpx::future<std::vector<T>> next_;
+        };
+
+    public:
+        using value_type = T;
+
+        static constexpr std::size_t default_prefetch = 64;
+
+        channel_reader() = default;
+
+        explicit channel_reader(
+            channel<T> const& c, std::size_t prefetch = default_prefetch)
+          : state_(std::make_shared<shared_state>(
+                c, prefetch != 0 ? prefetch : 1))
+        {
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Returns a ready future if a prefetched value is available,
+        // otherwise the returned future becomes ready once the next batch of
+        // values has arrived.
+        hpx::future<T> get() const
+        {
+            hpx::future<T> result;
+            hpx::future<std::vector<T>> next;
+            {
+                std::lock_guard<typename shared_state::mutex_type> l(
+                    state_->mtx_);
+
+                if (!state_->buffer_.empty())
+                {
+                    result = hpx::make_ready_future(
+                        HPX_MOVE(state_->buffer_.front()));
+                    state_->buffer_.pop_front();
+                    return result;
+                }
+
+                hpx::promise<T> p;
+                result = p.get_future();
+                state_->waiting_.push_back(HPX_MOVE(p));
+
+                // the first caller waiting attaches the continuation
+                if (state_->waiting_.size() == 1)
+                {
+                    if (!state_->next_.valid())
+                    {
+                        state_->request_next();
+                    }
+                    next = HPX_MOVE(state_->next_);
+                }
+            }
+
+            if (next.valid())
+            {
+                shared_state::wait_for_batch(state_, HPX_MOVE(next));
+            }
+            return result;
+        }
+        T get(launch::sync_policy) const
+        {
+            return get().get();
+        }
+
+        hpx::id_type const& get_id() const noexcept
+        {
+            return state_->channel_.get_id();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        channel_iterator<T, channel_reader<T>> begin() const
+        {
+            return channel_iterator<T, channel_reader<T>>(*this);
+        }
+        channel_iterator<T, channel_reader<T>> end() const
+        {
+            return channel_iterator<T, channel_reader<T>>();
+        }
+
+    private:
+        std::shared_ptr<shared_state> state_;
+    };
 }    // namespace hpx::lcos
 
 namespace hpx::distributed {
 
     using hpx::lcos::channel;
+    using hpx::lcos::channel_reader;
+    using hpx::lcos::channel_writer;
 }    // namespace hpx::distributed
 
 #endif
@@ -9,23 +9,36 @@
 #include <hpx/config.hpp>
 #include <hpx/actions/transfer_action.hpp>
 #include <hpx/actions_base/component_action.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/async_distributed/base_lco_with_value.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/components_base/component_type.hpp>
 #include <hpx/components_base/server/component_base.hpp>
 #include <hpx/components_base/traits/is_component.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
 #include <hpx/futures/traits/get_remote_result.hpp>
 #include <hpx/futures/traits/promise_remote_result.hpp>
 #include <hpx/lcos_local/channel.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/preprocessor/cat.hpp>
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
 #include <hpx/preprocessor/stringize.hpp>
+#include <hpx/synchronization/mutex.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <exception>
+#include <map>
+#include <mutex>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace lcos { namespace server {
@@ -81,27 +94,32 @@ namespace hpx { namespace lcos { namespace server {
         void set_value(RemoteType&& result)
         {
             channel_.set(HPX_MOVE(result));
+            produced(1);
         }
 
         // Close the channel
         void set_exception(std::exception_ptr const& /*e*/)
         {
             channel_.close();
+            release_credits();
         }
 
         // Retrieve the next value from the channel
         result_type get_value()
         {
+            requested(1);
             return channel_.get(launch::sync);
         }
         result_type get_value(error_code& ec)
         {
+            requested(1);
             return channel_.get(launch::sync, ec);
         }
 
         // Additional functionality exposed by the channel component
         hpx::future<T> get_generation(std::size_t generation)
         {
+            requested(1);
             return channel_.get(generation);
         }
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(channel, get_generation)
@@ -109,17 +127,266 @@ namespace hpx { namespace lcos { namespace server {
         void set_generation(RemoteType&& value, std::size_t generation)
         {
             channel_.set(HPX_MOVE(value), generation);
+            produced(1);
         }
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(channel, set_generation)
 
         std::size_t close(bool force_delete_entries)
         {
-            return channel_.close(force_delete_entries);
+            std::size_t const result = channel_.close(force_delete_entries);
+            release_credits();
+            return result;
         }
         HPX_DEFINE_COMPONENT_ACTION(channel, close)
 
+        // Streaming support: push a batch of values to the channel. The
+        // batches sent by one writer are identified by consecutive sequence
+        // numbers, batches arriving out of order are held back until all
+        // preceding batches of the same writer have arrived. The returned
+        // future becomes ready once all values of the batch have been handed
+        // out to a consumer (or the channel was closed). This is used to
+        // return credits to the writer, which bounds the number of values
+        // buffered in this channel. This is not a direct action as it may
+        // have to wait for preceding batches to be committed.
+        hpx::future<void> set_values(std::vector<result_type>&& values,
+            std::uint64_t writer, std::size_t sequence, bool last_batch,
+            bool close_channel)
+        {
+            hpx::promise<void> p;
+            hpx::future<void> result = p.get_future();
+
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                streams_[writer].pending.emplace(
+                    sequence, stream_batch{HPX_MOVE(values), last_batch,
+                                  close_channel, HPX_MOVE(p)});
+            }
+
+            commit_batches(writer);
+            return result;
+        }
+        HPX_DEFINE_COMPONENT_ACTION(channel, set_values)
+
+        // Streaming support: retrieve up to the given number of values from
+        // the channel. This returns all values currently available (but not
+        // more than requested), or waits for the next value if the channel is
+        // empty.
+        hpx::future<std::vector<result_type>> get_values(std::size_t count)
+        {
+            std::vector<hpx::future<result_type>> values;
+
+            std::vector<hpx::promise<void>> released;
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+
+                std::uint64_t const produced = produced_.load();
+                std::uint64_t const requested = requested_.load();
+                std::size_t available = produced > requested ?
+                    static_cast<std::size_t>(produced - requested) :
+                    0;
+                if (available > count)
+                {
+                    available = count;
+                }
+                else if (available == 0)
+                {
+                    available = 1;
+                }
+
+                values.reserve(available);
+                for (std::size_t i = 0; i != available; ++i)
+                {
+                    values.push_back(channel_.get());
+                }
+
+                requested_ += available;
+                released = take_returned_credits();
+            }
+
+            for (auto& p : released)
+            {
+                p.set_value();
+            }
+
+            return hpx::when_all_values(HPX_MOVE(values));
+        }
+        HPX_DEFINE_COMPONENT_ACTION(channel, get_values)
+
     private:
+        using mutex_type = hpx::spinlock;
+
+        struct stream_batch
+        {
+            std::vector<result_type> values;
+            bool last_batch = false;
+            bool close_channel = false;
+            hpx::promise<void> credit;
+        };
+
+        struct stream_state
+        {
+            std::size_t next_sequence = 0;
+            std::map<std::size_t, stream_batch> pending;
+        };
+
+        // push all batches of the given writer to the channel which are next
+        // in sequence
+        void commit_batches(std::uint64_t writer)
+        {
+            // the values of a batch have to be pushed in one go
+            std::lock_guard<hpx::mutex> cl(commit_mtx_);
+
+            while (true)
+            {
+                stream_batch batch;
+                bool closed = false;
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+
+                    auto it = streams_.find(writer);
+                    if (it == streams_.end() || it->second.pending.empty() ||
+                        it->second.pending.begin()->first !=
+                            it->second.next_sequence)
+                    {
+                        return;
+                    }
+
+                    auto& pending = it->second.pending;
+                    batch = HPX_MOVE(pending.begin()->second);
+                    pending.erase(pending.begin());
+                    ++it->second.next_sequence;
+
+                    if (batch.last_batch)
+                    {
+                        streams_.erase(it);
+                    }
+                    closed = closed_;
+                }
+
+                if (closed)
+                {
+                    batch.credit.set_exception(
+                        HPX_GET_EXCEPTION(hpx::error::invalid_status,
+                            "hpx::lcos::server::channel::set_values",
+                            "attempting to write to a closed channel"));
+                    continue;
+                }
+
+                for (auto& value : batch.values)
+                {
+                    channel_.set(HPX_MOVE(value));
+                }
+
+                std::vector<hpx::promise<void>> released;
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+                    std::uint64_t const produced =
+                        produced_ += batch.values.size();
+                    if (batch.close_channel)
+                    {
+                        released.push_back(HPX_MOVE(batch.credit));
+                    }
+                    else
+                    {
+                        // the batch may have been consumed already, this is
+                        // detected by take_returned_credits
+                        credits_.emplace_back(
+                            produced, HPX_MOVE(batch.credit));
+                        ++num_credits_;
+                        released = take_returned_credits();
+                    }
+                }
+
+                if (batch.close_channel)
+                {
+                    channel_.close();
+                    release_credits();
+                }
+
+                for (auto& p : released)
+                {
+                    p.set_value();
+                }
+            }
+        }
+
+        // The per-value operations don't acquire the lock unless a writer
+        // waits for a credit to be returned. Both requested() and
+        // commit_batches() update their counter before checking the other
+        // one (using sequentially consistent operations), so no returned
+        // credit is missed.
+        void produced(std::size_t count) noexcept
+        {
+            produced_ += count;
+        }
+
+        void requested(std::size_t count)
+        {
+            requested_ += count;
+            if (num_credits_.load() == 0)
+            {
+                return;
+            }
+
+            std::vector<hpx::promise<void>> released;
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                released = take_returned_credits();
+            }
+
+            for (auto& p : released)
+            {
+                p.set_value();
+            }
+        }
+
+        // extract the promises of all batches that were fully consumed, mtx_
+        // must be held
+        std::vector<hpx::promise<void>> take_returned_credits()
+        {
+            std::vector<hpx::promise<void>> released;
+            std::uint64_t const requested = requested_.load();
+            while (!credits_.empty() && credits_.front().first <= requested)
+            {
+                released.push_back(HPX_MOVE(credits_.front().second));
+                credits_.pop_front();
+                --num_credits_;
+            }
+            return released;
+        }
+
+        // make sure writers don't wait for credits after the channel was
+        // closed
+        void release_credits()
+        {
+            std::deque<std::pair<std::uint64_t, hpx::promise<void>>> credits;
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                closed_ = true;
+                credits = HPX_MOVE(credits_);
+                credits_.clear();
+                num_credits_ = 0;
+            }
+
+            for (auto& c : credits)
+            {
+                c.second.set_value();
+            }
+        }
+
         lcos::local::channel<result_type> channel_;
+
+        // accounting of values for the streaming interface, the streaming
+        // interface assumes that values are set and retrieved in order (i.e.
+        // without explicitly specifying generations)
+        mutex_type mtx_;
+        hpx::mutex commit_mtx_;
+        std::atomic<std::uint64_t> produced_ = 0;
+        std::atomic<std::uint64_t> requested_ = 0;
+        std::atomic<std::size_t> num_credits_ = 0;
+        bool closed_ = false;
+        std::deque<std::pair<std::uint64_t, hpx::promise<void>>> credits_;
+        std::unordered_map<std::uint64_t, stream_state> streams_;
     };
 }}}    // namespace hpx::lcos::server
 
@@ -146,6 +413,12 @@ namespace hpx { namespace lcos { namespace server {
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         hpx::lcos::server::channel<type>::close_action,                        \
         HPX_PP_CAT(__channel_close_action, HPX_PP_CAT(type, name)))            \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        hpx::lcos::server::channel<type>::set_values_action,                   \
+        HPX_PP_CAT(__channel_set_values_action, HPX_PP_CAT(type, name)))       \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        hpx::lcos::server::channel<type>::get_values_action,                   \
+        HPX_PP_CAT(__channel_get_values_action, HPX_PP_CAT(type, name)))       \
     /**/
 
 #define HPX_REGISTER_CHANNEL(...)                                              \
@@ -177,4 +450,8 @@ namespace hpx { namespace lcos { namespace server {
         HPX_PP_CAT(__channel_set_generation_action, HPX_PP_CAT(type, name)))   \
     HPX_REGISTER_ACTION(hpx::lcos::server::channel<type>::close_action,        \
         HPX_PP_CAT(__channel_close_action, HPX_PP_CAT(type, name)))            \
+    HPX_REGISTER_ACTION(hpx::lcos::server::channel<type>::set_values_action,   \
+        HPX_PP_CAT(__channel_set_values_action, HPX_PP_CAT(type, name)))       \
+    HPX_REGISTER_ACTION(hpx::lcos::server::channel<type>::get_values_action,   \
+        HPX_PP_CAT(__channel_get_values_action, HPX_PP_CAT(type, name)))       \
     /**/
@@ -0,0 +1,166 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+typedef std::string string_type;
+
+HPX_REGISTER_CHANNEL(int)
+HPX_REGISTER_CHANNEL(string_type)
+
+///////////////////////////////////////////////////////////////////////////////
+void produce(hpx::distributed::channel<int> c, int count)
+{
+    hpx::distributed::channel_writer<int> writer(c, 16, 2);
+    for (int i = 0; i != count; ++i)
+    {
+        writer.set(i);
+    }
+    writer.close();
+}
+HPX_PLAIN_ACTION(produce)
+
+void stream_values(hpx::id_type const& here, hpx::id_type const& there)
+{
+    int const count = 1000;
+
+    hpx::distributed::channel<int> c(here);
+    hpx::future<void> f = hpx::async(produce_action(), there, c, count);
+
+    // the values are received in order
+    hpx::distributed::channel_reader<int> reader(c, 8);
+    int expected = 0;
+    for (int value : reader)
+    {
+        HPX_TEST_EQ(value, expected);
+        ++expected;
+    }
+    HPX_TEST_EQ(expected, count);
+
+    f.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void stream_credits(hpx::id_type const& loc)
+{
+    hpx::distributed::channel<string_type> c(loc);
+    hpx::distributed::channel_writer<string_type> writer(c, 4, 2);
+
+    for (int i = 0; i != 8; ++i)
+    {
+        writer.set(std::to_string(i));
+    }
+
+    // no value was consumed yet, the credits of both batches are outstanding
+    HPX_TEST_EQ(writer.batches_in_flight(), std::size_t(2));
+
+    // the streamed values can be received one at a time as well
+    for (int i = 0; i != 8; ++i)
+    {
+        HPX_TEST_EQ(c.get(hpx::launch::sync), std::to_string(i));
+    }
+
+    // all values were consumed, sending another batch does not block
+    for (int i = 8; i != 12; ++i)
+    {
+        writer.set(std::to_string(i));
+    }
+
+    hpx::distributed::channel_reader<string_type> reader(c);
+    for (int i = 8; i != 12; ++i)
+    {
+        HPX_TEST_EQ(reader.get(hpx::launch::sync), std::to_string(i));
+    }
+
+    writer.close();
+    HPX_TEST_EQ(writer.batches_in_flight(), std::size_t(0));
+
+    // the channel was closed and is empty
+    hpx::future<string_type> f = reader.get();
+    f.wait();
+    HPX_TEST(f.has_exception());
+}
+
+void stream_flush(hpx::id_type const& loc)
+{
+    hpx::distributed::channel<int> c(loc);
+    hpx::distributed::channel_writer<int> writer(c, 100);
+
+    writer.set(1);
+    writer.set(2);
+    writer.flush();
+
+    hpx::distributed::channel_reader<int> reader(c, 100);
+    HPX_TEST_EQ(reader.get(hpx::launch::sync), 1);
+    HPX_TEST_EQ(reader.get(hpx::launch::sync), 2);
+
+    writer.set(3);
+    writer.close();
+
+    std::vector<int> values(reader.begin(), reader.end());
+    HPX_TEST_EQ(values.size(), std::size_t(1));
+    HPX_TEST_EQ(values[0], 3);
+}
+
+// get() does not wait for the values to arrive
+void stream_pending_gets(hpx::id_type const& loc)
+{
+    hpx::distributed::channel<int> c(loc);
+    hpx::distributed::channel_reader<int> reader(c, 2);
+
+    std::vector<hpx::future<int>> values;
+    for (int i = 0; i != 5; ++i)
+    {
+        values.push_back(reader.get());
+    }
+    HPX_TEST(!values[0].is_ready());
+
+    hpx::distributed::channel_writer<int> writer(c, 3);
+    for (int i = 0; i != 6; ++i)
+    {
+        writer.set(i);
+    }
+    writer.close();
+
+    // the values are handed out in order
+    for (int i = 0; i != 5; ++i)
+    {
+        HPX_TEST_EQ(values[i].get(), i);
+    }
+    HPX_TEST_EQ(reader.get(hpx::launch::sync), 5);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    hpx::id_type here = hpx::find_here();
+
+    stream_values(here, here);
+    stream_credits(here);
+    stream_flush(here);
+    stream_pending_gets(here);
+
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        stream_values(id, here);
+        stream_values(here, id);
+        stream_credits(id);
+        stream_pending_gets(id);
+    }
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,163 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/synchronization.hpp>
+
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::shmem {
+
+        class HPX_EXPORT connection_handler;
+    }    // namespace policies::shmem
+
+    template <>
+    struct connection_handler_traits<policies::shmem::connection_handler>
+    {
+        using connection_type = policies::shmem::sender;
+        using send_early_parcel = std::false_type;
+        using do_background_work = std::true_type;
+        using send_immediate_parcels = std::false_type;
+        using is_connectionless = std::false_type;
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        static constexpr const char* pool_name() noexcept
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static constexpr const char* pool_name_postfix() noexcept
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies::shmem {
+
+        parcelset::locality parcelport_address(
+            util::runtime_configuration const& ini);
+
+        class HPX_EXPORT connection_handler
+          : public parcelport_impl<connection_handler>
+        {
+            using base_type = parcelport_impl<connection_handler>;
+
+        public:
+            static std::vector<std::string> runtime_configuration()
+            {
+                std::vector<std::string> lines;
+                return lines;
+            }
+
+            connection_handler(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier);
+
+            connection_handler(connection_handler const&) = delete;
+            connection_handler(connection_handler&&) = delete;
+            connection_handler& operator=(connection_handler const&) = delete;
+            connection_handler& operator=(connection_handler&&) = delete;
+
+            ~connection_handler() override;
+
+            // Start the handling of connections.
+            bool do_run();
+
+            // Stop the handling of connections.
+            void do_stop();
+
+            // Return the name of this locality
+            std::string get_locality_name() const override
+            {
+                return here_.get<locality>().host();
+            }
+
+            // Shared memory can be used only for destinations living on the
+            // same node, all others are served by the next parcelport.
+            bool can_connect(parcelset::locality const& dest,
+                bool use_alternative_parcelport) override;
+
+            std::shared_ptr<sender> create_connection(
+                parcelset::locality const& l, error_code& ec);
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const& ini) const override;
+
+            parcelset::locality create_locality() const override;
+
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode);
+
+            // the following functions are used by the senders
+            std::uint32_t pid() const noexcept
+            {
+                return here_.get<locality>().pid();
+            }
+
+            std::uint64_t next_segment_id() noexcept
+            {
+                return ++segment_id_;
+            }
+
+            void add_pending(std::shared_ptr<sender> const& s);
+
+        private:
+            bool send_pending();
+            bool has_pending();
+
+            std::shared_ptr<shared_memory_segment> get_queue_segment(
+                locality const& l, std::error_code& ec);
+
+            std::atomic<bool> stopped_;
+            std::atomic<std::uint64_t> segment_id_;
+
+            // time to wait for pending messages while being stopped
+            std::chrono::milliseconds stop_timeout_;
+
+            // the inbound message queues of all known destinations
+            hpx::spinlock queues_mtx_;
+            std::map<std::uint32_t, std::shared_ptr<shared_memory_segment>>
+                queues_;
+
+            // senders waiting for free space in their destination queue
+            hpx::spinlock pending_mtx_;
+            std::deque<std::shared_ptr<sender>> pending_;
+
+            receiver<connection_handler> receiver_;
+        };
+    }    // namespace policies::shmem
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
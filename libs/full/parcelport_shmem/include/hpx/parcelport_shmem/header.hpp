@@ -0,0 +1,204 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // Non-owning view onto the serialized data of a received message. This
+    // allows to decode the data directly from the memory it was received in.
+    struct buffer_view
+    {
+        struct allocator_type
+        {
+        };
+
+        buffer_view() = default;
+
+        explicit constexpr buffer_view(allocator_type const&) noexcept {}
+
+        constexpr buffer_view(char const* data, std::size_t size) noexcept
+          : data_(data)
+          , size_(size)
+        {
+        }
+
+        [[nodiscard]] char const& operator[](std::size_t i) const noexcept
+        {
+            // reading zero bytes at the end of the data is allowed
+            HPX_ASSERT(i <= size_);
+            return data_[i];
+        }
+
+        [[nodiscard]] constexpr char const* data() const noexcept
+        {
+            return data_;
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+    private:
+        char const* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+    // Every message starts with this header. It is followed by the message
+    // body which is either stored in the same queue slot or, if it is too
+    // large for a slot, in a separate shared memory segment created by the
+    // sender and mapped by the receiver. The body consists of:
+    //
+    //  - the transmission chunk table (if any)
+    //  - the non-zero-copy serialization data
+    //  - the zero-copy chunks, in the order they appear in the chunk list
+    //
+    struct header
+    {
+        using parcel_buffer_type = parcel_buffer<>;
+        using received_buffer_type = parcel_buffer<buffer_view>;
+        using transmission_chunk_type =
+            parcel_buffer_type::transmission_chunk_type;
+
+        std::uint64_t size_;         // size of non-zero-copy data
+        std::uint64_t data_size_;    // overall size of the serialized data
+        std::uint32_t num_zero_copy_chunks_;
+        std::uint32_t num_non_zero_copy_chunks_;
+
+        // identifies the segment holding the message body (zero if the body
+        // is stored inline)
+        std::uint64_t segment_id_;
+        std::uint64_t body_size_;
+        std::uint32_t source_pid_;
+        std::uint32_t reserved_;
+
+        header() = default;
+
+        header(parcel_buffer_type const& buffer, std::uint32_t source_pid)
+          : size_(buffer.size_)
+          , data_size_(buffer.data_size_)
+          , num_zero_copy_chunks_(buffer.num_chunks_.first)
+          , num_non_zero_copy_chunks_(buffer.num_chunks_.second)
+          , segment_id_(0)
+          , body_size_(body_size(buffer))
+          , source_pid_(source_pid)
+          , reserved_(0)
+        {
+        }
+
+        [[nodiscard]] bool is_inline() const noexcept
+        {
+            return segment_id_ == 0;
+        }
+
+        [[nodiscard]] std::size_t num_chunks() const noexcept
+        {
+            return static_cast<std::size_t>(num_zero_copy_chunks_) +
+                num_non_zero_copy_chunks_;
+        }
+
+        // Return the name of the segment holding the body of the message
+        [[nodiscard]] std::string segment_name() const
+        {
+            return "/hpx.shmem." + std::to_string(source_pid_) + "." +
+                std::to_string(segment_id_);
+        }
+
+        // Return the number of bytes needed to store the body of the message
+        // held by the given buffer
+        static std::size_t body_size(parcel_buffer_type const& buffer) noexcept
+        {
+            std::size_t size = buffer.transmission_chunks_.size() *
+                    sizeof(transmission_chunk_type) +
+                buffer.data_.size();
+
+            for (serialization::serialization_chunk const& c : buffer.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+                    size += c.size_;
+            }
+            return size;
+        }
+
+        // Copy the body of the message held by the given buffer to the given
+        // location, return the pointer past the last written byte
+        static char* write_body(
+            parcel_buffer_type const& buffer, char* dest) noexcept
+        {
+            if (!buffer.transmission_chunks_.empty())
+            {
+                std::size_t const size = buffer.transmission_chunks_.size() *
+                    sizeof(transmission_chunk_type);
+                std::memcpy(dest, buffer.transmission_chunks_.data(), size);
+                dest += size;
+            }
+
+            std::memcpy(dest, buffer.data_.data(), buffer.data_.size());
+            dest += buffer.data_.size();
+
+            for (serialization::serialization_chunk const& c : buffer.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+                {
+                    std::memcpy(dest, c.data_.cpos_, c.size_);
+                    dest += c.size_;
+                }
+            }
+            return dest;
+        }
+
+        // Initialize the given buffer from the message body. Neither the
+        // serialized data nor the zero-copy chunks are copied, they refer
+        // directly to the memory holding the message body, which has to stay
+        // valid while the buffer is decoded.
+        void read_body(received_buffer_type& buffer, char const* body) const
+        {
+            buffer.size_ = size_;
+            buffer.data_size_ = data_size_;
+            buffer.num_chunks_ = parcel_buffer_type::count_chunks_type(
+                num_zero_copy_chunks_, num_non_zero_copy_chunks_);
+
+            if (num_zero_copy_chunks_ != 0)
+            {
+                buffer.transmission_chunks_.resize(num_chunks());
+                std::size_t const size =
+                    num_chunks() * sizeof(transmission_chunk_type);
+                std::memcpy(buffer.transmission_chunks_.data(), body, size);
+                body += size;
+            }
+
+            buffer.data_ =
+                buffer_view(body, static_cast<std::size_t>(size_));
+            body += size_;
+
+            buffer.chunks_.clear();
+            buffer.chunks_.reserve(num_zero_copy_chunks_);
+            for (std::size_t i = 0; i != num_zero_copy_chunks_; ++i)
+            {
+                auto const chunk_size = static_cast<std::size_t>(
+                    buffer.transmission_chunks_[i].second);
+                buffer.chunks_.push_back(
+                    serialization::create_pointer_chunk(body, chunk_size));
+                body += chunk_size;
+            }
+        }
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,105 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/serialization.hpp>
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // A shared memory locality is identified by the node it runs on and the
+    // process id of the process hosting it. The process id is used to derive
+    // the name of the shared memory segment holding the inbound message queue
+    // of the locality. The node is identified by its host name and by the
+    // identity of the running system instance (its boot id, if available), as
+    // host names are not necessarily unique.
+    class locality
+    {
+    public:
+        locality() noexcept
+          : pid_(0)
+        {
+        }
+
+        locality(std::string const& host, std::string const& boot_id,
+            std::uint32_t pid)
+          : host_(host)
+          , boot_id_(boot_id)
+          , pid_(pid)
+        {
+        }
+
+        [[nodiscard]] std::string const& host() const noexcept
+        {
+            return host_;
+        }
+
+        [[nodiscard]] std::string const& boot_id() const noexcept
+        {
+            return boot_id_;
+        }
+
+        // Return whether both localities run on the same system instance.
+        [[nodiscard]] bool same_node(locality const& rhs) const noexcept
+        {
+            return host_ == rhs.host_ && boot_id_ == rhs.boot_id_;
+        }
+
+        [[nodiscard]] std::uint32_t pid() const noexcept
+        {
+            return pid_;
+        }
+
+        // Return the name of the shared memory segment holding the inbound
+        // message queue of this locality.
+        [[nodiscard]] HPX_EXPORT std::string segment_name() const;
+
+        [[nodiscard]] static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        [[nodiscard]] explicit constexpr operator bool() const noexcept
+        {
+            return pid_ != 0;
+        }
+
+        HPX_EXPORT void save(serialization::output_archive& ar) const;
+        HPX_EXPORT void load(serialization::input_archive& ar);
+
+    private:
+        friend bool operator==(
+            locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.pid_ == rhs.pid_ && lhs.same_node(rhs);
+        }
+
+        friend bool operator<(locality const& lhs, locality const& rhs) noexcept
+        {
+            if (lhs.host_ != rhs.host_)
+                return lhs.host_ < rhs.host_;
+            if (lhs.boot_id_ != rhs.boot_id_)
+                return lhs.boot_id_ < rhs.boot_id_;
+            return lhs.pid_ < rhs.pid_;
+        }
+
+        friend HPX_EXPORT std::ostream& operator<<(
+            std::ostream& os, locality const& loc) noexcept;
+
+        std::string host_;
+        std::string boot_id_;
+        std::uint32_t pid_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,223 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // Bounded multi-producer/single-consumer queue of fixed size message slots
+    // placed into a shared memory segment. Every slot carries a sequence
+    // number which is used to hand the slot back and forth between the
+    // producers and the consumer (see D. Vyukov, 'Bounded MPMC queue'). All
+    // state lives inside of the segment, this class is merely a view onto it.
+    class message_queue
+    {
+        static constexpr std::uint64_t queue_magic = 0x6870782e73686d01ULL;
+
+        struct queue_header
+        {
+            std::uint64_t magic_;
+            std::uint64_t num_slots_;
+            std::uint64_t slot_size_;
+
+            alignas(threads::get_cache_line_size())
+                std::atomic<std::uint64_t> enqueue_pos_;
+            alignas(threads::get_cache_line_size())
+                std::atomic<std::uint64_t> dequeue_pos_;
+        };
+
+        struct alignas(threads::get_cache_line_size()) slot_header
+        {
+            std::atomic<std::uint64_t> sequence_;
+            std::uint64_t size_;
+        };
+
+        static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+            "the shared memory parcelport relies on address-free atomics");
+
+        static constexpr std::size_t align(std::size_t size) noexcept
+        {
+            constexpr std::size_t alignment =
+                threads::get_cache_line_size();
+            return (size + alignment - 1) & ~(alignment - 1);
+        }
+
+        static constexpr std::size_t slot_stride(std::size_t slot_size) noexcept
+        {
+            return align(sizeof(slot_header) + slot_size);
+        }
+
+    public:
+        message_queue() noexcept = default;
+
+        // Attach to an already initialized queue
+        explicit message_queue(void* base) noexcept
+          : header_(static_cast<queue_header*>(base))
+          , slots_(static_cast<char*>(base) + align(sizeof(queue_header)))
+        {
+            HPX_ASSERT(header_->magic_ == queue_magic);
+        }
+
+        // Return the number of bytes needed to hold a queue of the given
+        // dimensions.
+        static constexpr std::size_t required_size(
+            std::size_t num_slots, std::size_t slot_size) noexcept
+        {
+            return align(sizeof(queue_header)) +
+                num_slots * slot_stride(slot_size);
+        }
+
+        // Initialize a new queue in the given memory, num_slots has to be a
+        // power of two.
+        static message_queue initialize(
+            void* base, std::size_t num_slots, std::size_t slot_size) noexcept
+        {
+            HPX_ASSERT(num_slots != 0 && (num_slots & (num_slots - 1)) == 0);
+
+            auto* hdr = new (base) queue_header;
+            hdr->num_slots_ = num_slots;
+            hdr->slot_size_ = slot_size;
+            hdr->enqueue_pos_.store(0, std::memory_order_relaxed);
+            hdr->dequeue_pos_.store(0, std::memory_order_relaxed);
+
+            char* slots =
+                static_cast<char*>(base) + align(sizeof(queue_header));
+            for (std::size_t i = 0; i != num_slots; ++i)
+            {
+                auto* slot =
+                    new (slots + i * slot_stride(slot_size)) slot_header;
+                slot->sequence_.store(i, std::memory_order_relaxed);
+                slot->size_ = 0;
+            }
+
+            // make the queue visible to other processes only once it is
+            // fully initialized
+            std::atomic_thread_fence(std::memory_order_release);
+            hdr->magic_ = queue_magic;
+
+            return message_queue(base);
+        }
+
+        // Verify that the given memory holds an initialized queue
+        static bool is_valid(void const* base, std::size_t size) noexcept
+        {
+            if (size < sizeof(queue_header))
+                return false;
+
+            auto const* hdr = static_cast<queue_header const*>(base);
+            return hdr->magic_ == queue_magic &&
+                required_size(hdr->num_slots_, hdr->slot_size_) <= size;
+        }
+
+        [[nodiscard]] std::size_t max_message_size() const noexcept
+        {
+            return static_cast<std::size_t>(header_->slot_size_);
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return header_ != nullptr;
+        }
+
+        // Try to place a message of the given size into the queue. The
+        // function f is invoked with a pointer to the reserved slot and is
+        // expected to fill in the message data. Returns false if the queue is
+        // full.
+        template <typename F>
+        bool try_enqueue(std::size_t size, F&& f)
+        {
+            HPX_ASSERT(size <= max_message_size());
+
+            std::uint64_t const mask = header_->num_slots_ - 1;
+            std::uint64_t pos =
+                header_->enqueue_pos_.load(std::memory_order_relaxed);
+
+            slot_header* slot = nullptr;
+            while (true)
+            {
+                slot = get_slot(pos & mask);
+
+                std::uint64_t const seq =
+                    slot->sequence_.load(std::memory_order_acquire);
+                auto const diff = static_cast<std::int64_t>(seq - pos);
+                if (diff == 0)
+                {
+                    if (header_->enqueue_pos_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;    // queue is full
+                }
+                else
+                {
+                    pos = header_->enqueue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+
+            f(reinterpret_cast<char*>(slot + 1));
+            slot->size_ = size;
+
+            // publish the message to the consumer
+            slot->sequence_.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Try to retrieve the next message from the queue. The function f is
+        // invoked with a pointer to the message data and its size, the slot is
+        // handed back to the producers once f returns. Must not be called
+        // concurrently.
+        template <typename F>
+        bool try_dequeue(F&& f)
+        {
+            std::uint64_t const pos =
+                header_->dequeue_pos_.load(std::memory_order_relaxed);
+            slot_header* slot = get_slot(pos & (header_->num_slots_ - 1));
+
+            if (slot->sequence_.load(std::memory_order_acquire) != pos + 1)
+            {
+                return false;    // queue is empty
+            }
+
+            f(reinterpret_cast<char const*>(slot + 1),
+                static_cast<std::size_t>(slot->size_));
+
+            // hand the slot back to the producers
+            header_->dequeue_pos_.store(pos + 1, std::memory_order_relaxed);
+            slot->sequence_.store(
+                pos + header_->num_slots_, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        slot_header* get_slot(std::uint64_t idx) const noexcept
+        {
+            auto const slot_size =
+                static_cast<std::size_t>(header_->slot_size_);
+            return reinterpret_cast<slot_header*>(
+                slots_ + idx * slot_stride(slot_size));
+        }
+
+        queue_header* header_ = nullptr;
+        char* slots_ = nullptr;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
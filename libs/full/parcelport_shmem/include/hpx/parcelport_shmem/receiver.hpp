@@ -0,0 +1,221 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/synchronization.hpp>
+
+#include <hpx/parcelport_shmem/header.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/message_queue.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // The receiver owns the inbound message queue of this locality and
+    // decodes the messages placed there by the senders.
+    template <typename Parcelport>
+    class receiver
+    {
+        using parcel_buffer_type = parcel_buffer<>;
+
+        // maximal number of messages handled during one invocation of
+        // background_work
+        static constexpr std::size_t max_messages_per_call = 16;
+
+    public:
+        explicit receiver(Parcelport& pp) noexcept
+          : pp_(pp)
+        {
+        }
+
+        receiver(receiver const&) = delete;
+        receiver(receiver&&) = delete;
+        receiver& operator=(receiver const&) = delete;
+        receiver& operator=(receiver&&) = delete;
+
+        ~receiver()
+        {
+            shutdown();
+        }
+
+        // Create the inbound message queue
+        void create(locality const& here, std::size_t num_slots,
+            std::size_t slot_size, error_code& ec = throws)
+        {
+            std::error_code error;
+            if (!inbox_.create(here.segment_name(),
+                    message_queue::required_size(num_slots, slot_size), error))
+            {
+                HPX_THROWS_IF(ec, hpx::error::network_error,
+                    "shmem::receiver::create",
+                    "could not create shared memory segment '{}': {}",
+                    here.segment_name(), error.message());
+                return;
+            }
+
+            queue_ =
+                message_queue::initialize(inbox_.data(), num_slots, slot_size);
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
+        // Remove the inbound message queue, no more messages can be received
+        // afterwards
+        void shutdown() noexcept
+        {
+            std::lock_guard l(mtx_);
+            if (inbox_)
+            {
+                // release the bodies of messages nobody will look at anymore
+                while (queue_.try_dequeue(
+                    [](char const* data, std::size_t /* size */) {
+                        header hdr;
+                        std::memcpy(&hdr, data, sizeof(header));
+                        if (!hdr.is_inline())
+                        {
+                            shared_memory_segment::unlink(hdr.segment_name());
+                        }
+                    }))
+                {
+                }
+
+                inbox_.unlink();
+                inbox_.close();
+                queue_ = message_queue();
+            }
+        }
+
+        // Messages are taken from the queue while holding the lock, but they
+        // are decoded and dispatched only after the lock was released. Direct
+        // actions are executed while dispatching, they must not run while the
+        // (yielding) lock is held.
+        bool background_work()
+        {
+            std::array<received_message, max_messages_per_call> messages;
+            std::size_t num_messages = 0;
+
+            {
+                std::unique_lock l(mtx_, std::try_to_lock);
+                if (!l.owns_lock() || !queue_)
+                {
+                    return false;
+                }
+
+                while (num_messages != max_messages_per_call &&
+                    queue_.try_dequeue(
+                        [&](char const* data, std::size_t size) {
+                            take_message(messages[num_messages], data, size);
+                        }))
+                {
+                    ++num_messages;
+                }
+            }
+
+            for (std::size_t i = 0; i != num_messages; ++i)
+            {
+                handle_message(messages[i]);
+            }
+            return num_messages != 0;
+        }
+
+    private:
+        struct received_message
+        {
+            header hdr;
+
+            // copy of a message stored in a queue slot, this allows to hand
+            // the slot back to the senders before the message is decoded
+            std::vector<char> data;
+
+            // the mapped segment holding the body of a large message
+            shared_memory_segment body;
+        };
+
+        // Take the message out of the queue slot. Small messages are copied,
+        // the segments holding the body of large messages are mapped.
+        static void take_message(
+            received_message& msg, char const* data, std::size_t size)
+        {
+            std::memcpy(&msg.hdr, data, sizeof(header));
+            if (msg.hdr.is_inline())
+            {
+                HPX_ASSERT(size == sizeof(header) + msg.hdr.body_size_);
+                msg.data.assign(data + sizeof(header), data + size);
+                return;
+            }
+
+            // nobody else will access the segment, so it can be removed
+            // right away
+            std::error_code ec;
+            if (!msg.body.open(msg.hdr.segment_name(), ec))
+            {
+                LPT_(error).format(
+                    "shmem::receiver: could not open message segment '{}': {}",
+                    msg.hdr.segment_name(), ec.message());
+                return;
+            }
+            msg.body.unlink();
+
+            HPX_ASSERT(msg.body.size() >= msg.hdr.body_size_);
+        }
+
+        void handle_message(received_message& msg)
+        {
+            char const* body = nullptr;
+            if (msg.hdr.is_inline())
+            {
+                body = msg.data.data();
+            }
+            else if (msg.body)
+            {
+                body = static_cast<char const*>(msg.body.data());
+            }
+            else
+            {
+                return;    // the segment could not be mapped
+            }
+
+            header::received_buffer_type buffer;
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer.data_point_.bytes_ =
+                static_cast<std::size_t>(msg.hdr.size_);
+            buffer.data_point_.time_ = 0;
+#endif
+            // the serialized data and the zero-copy chunks refer directly to
+            // the message body, which is kept alive until the parcels are
+            // decoded
+            msg.hdr.read_body(buffer, body);
+            handle_received_parcels(decode_parcels(pp_, HPX_MOVE(buffer)));
+        }
+
+        Parcelport& pp_;
+
+        hpx::spinlock mtx_;
+        shared_memory_segment inbox_;
+        message_queue queue_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,128 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_shmem/header.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/message_queue.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <memory>
+#include <system_error>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    class HPX_EXPORT connection_handler;
+
+    // A sender places messages into the inbound message queue of the
+    // destination locality. Messages that don't fit into a queue slot are
+    // written to a separate shared memory segment which is handed over to the
+    // receiver. In both cases the encoded message is copied once into shared
+    // memory, the receiver decodes it in place.
+    class HPX_EXPORT sender : public parcelset::parcelport_connection<sender>
+    {
+        using handler_type =
+            hpx::move_only_function<void(std::error_code const&)>;
+        using postprocess_handler_type =
+            hpx::move_only_function<void(std::error_code const&,
+                parcelset::locality const&, std::shared_ptr<sender>)>;
+
+    public:
+        sender(connection_handler& parcelport,
+            parcelset::locality const& locality_id,
+            std::shared_ptr<shared_memory_segment> queue_segment);
+
+        sender(sender const&) = delete;
+        sender(sender&&) = delete;
+        sender& operator=(sender const&) = delete;
+        sender& operator=(sender&&) = delete;
+
+        ~sender();
+
+        parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        static constexpr void verify_(
+            parcelset::locality const& /* parcel_locality_id */) noexcept
+        {
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(
+            Handler&& handler, ParcelPostprocess&& parcel_postprocess)
+        {
+            HPX_ASSERT(!buffer_.data_.empty());
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+
+            handler_ = HPX_FORWARD(Handler, handler);
+            postprocess_handler_ =
+                HPX_FORWARD(ParcelPostprocess, parcel_postprocess);
+            HPX_ASSERT(handler_);
+            HPX_ASSERT(postprocess_handler_);
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
+#endif
+            // If the destination queue is currently full, the connection
+            // handler will retry sending the message during background work.
+            if (!send())
+            {
+                add_pending();
+            }
+        }
+
+        // Try to place the current message into the queue of the destination,
+        // return false if the queue is full.
+        bool send();
+
+        // Drop the current message, its handlers are called with the given
+        // error.
+        void cancel(std::error_code const& ec);
+
+    private:
+        bool prepare_message();
+        void add_pending();
+        void complete(std::error_code const& ec);
+
+        connection_handler& parcelport_;
+
+        // the other (receiving) end of this connection
+        parcelset::locality there_;
+
+        // the inbound message queue of the destination
+        std::shared_ptr<shared_memory_segment> queue_segment_;
+        message_queue queue_;
+
+        // the segment holding the body of messages too large for a queue slot
+        shared_memory_segment body_segment_;
+
+        header header_;
+        bool prepared_;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+#endif
+
+        handler_type handler_;
+        postprocess_handler_type postprocess_handler_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,79 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <cstddef>
+#include <string>
+#include <system_error>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // RAII wrapper for a mapped POSIX shared memory segment. The mapping is
+    // released on destruction, the segment itself is removed from the system
+    // only if unlink() is called explicitly.
+    class HPX_EXPORT shared_memory_segment
+    {
+    public:
+        shared_memory_segment() noexcept = default;
+
+        shared_memory_segment(shared_memory_segment const&) = delete;
+        shared_memory_segment& operator=(shared_memory_segment const&) = delete;
+
+        shared_memory_segment(shared_memory_segment&& rhs) noexcept;
+        shared_memory_segment& operator=(shared_memory_segment&& rhs) noexcept;
+
+        ~shared_memory_segment();
+
+        // Create a new segment of the given size and map it. An existing
+        // segment with the same name is replaced.
+        bool create(
+            std::string const& name, std::size_t size, std::error_code& ec);
+
+        // Map an existing segment, the size is taken from the segment.
+        bool open(std::string const& name, std::error_code& ec);
+
+        // Release the mapping.
+        void close() noexcept;
+
+        // Remove the named segment from the system. Existing mappings stay
+        // valid until they are released.
+        void unlink() noexcept;
+
+        static void unlink(std::string const& name) noexcept;
+
+        [[nodiscard]] void* data() const noexcept
+        {
+            return data_;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]] std::string const& name() const noexcept
+        {
+            return name_;
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return data_ != nullptr;
+        }
+
+    private:
+        std::string name_;
+        void* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,329 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/parcelport_shmem/connection_handler.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/message_queue.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace {
+
+        std::string node_name()
+        {
+            char name[256] = {};
+            if (::gethostname(name, sizeof(name) - 1) != 0)
+            {
+                return "localhost";
+            }
+            return name;
+        }
+
+        // The boot id identifies the running system instance, this
+        // distinguishes nodes which happen to use the same host name.
+        std::string boot_id()
+        {
+            std::ifstream in("/proc/sys/kernel/random/boot_id");
+            std::string id;
+            if (!in || !std::getline(in, id))
+            {
+                return {};
+            }
+            return id;
+        }
+
+        std::size_t num_slots(util::runtime_configuration const& ini)
+        {
+            std::size_t const slots = hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.shmem.num_slots", 256);
+
+            // the message queue requires the number of slots to be a power
+            // of two
+            std::size_t result = 1;
+            while (result < slots)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        std::size_t slot_size(util::runtime_configuration const& ini)
+        {
+            std::size_t const size = hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.shmem.slot_size", 16384);
+
+            // each slot has to be able to hold at least the message header
+            return (std::max)(size, 2 * sizeof(header));
+        }
+
+        std::chrono::milliseconds stop_timeout(
+            util::runtime_configuration const& ini)
+        {
+            return std::chrono::milliseconds(
+                hpx::util::get_entry_as<std::int64_t>(
+                    ini, "hpx.parcel.shmem.stop_timeout", 1000));
+        }
+    }    // namespace
+
+    parcelset::locality parcelport_address(
+        util::runtime_configuration const& /* ini */)
+    {
+        return parcelset::locality(locality(
+            node_name(), boot_id(), static_cast<std::uint32_t>(::getpid())));
+    }
+
+    connection_handler::connection_handler(
+        util::runtime_configuration const& ini,
+        threads::policies::callback_notifier const& notifier)
+      : base_type(ini, parcelport_address(ini), notifier)
+      , stopped_(false)
+      , segment_id_(0)
+      , stop_timeout_(stop_timeout(ini))
+      , receiver_(*this)
+    {
+        if (here_.type() != std::string("shmem"))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "shmem::parcelport::parcelport",
+                "this parcelport was instantiated to represent an unexpected "
+                "locality type: {}",
+                here_.type());
+        }
+
+        // The inbound message queue has to exist before the endpoint of this
+        // locality is published to others.
+        receiver_.create(here_.get<locality>(), num_slots(ini), slot_size(ini));
+    }
+
+    connection_handler::~connection_handler()
+    {
+        receiver_.shutdown();
+    }
+
+    bool connection_handler::do_run()
+    {
+        return true;
+    }
+
+    void connection_handler::do_stop()
+    {
+        // The destination of a pending message may have exited already, in
+        // which case its queue stays full forever. Pending messages are
+        // retried until the stop timeout expires only.
+        auto const deadline = std::chrono::steady_clock::now() + stop_timeout_;
+        while (std::chrono::steady_clock::now() < deadline &&
+            (background_work(0, parcelport_background_mode::all) ||
+                has_pending()))
+        {
+            if (threads::get_self_ptr())
+            {
+                hpx::this_thread::suspend(
+                    hpx::threads::thread_schedule_state::pending,
+                    "shmem::parcelport::do_stop");
+            }
+        }
+
+        stopped_.store(true, std::memory_order_release);
+
+        // the messages still waiting for free space in their destination
+        // queue will never be sent
+        std::deque<std::shared_ptr<sender>> pending;
+        {
+            std::lock_guard l(pending_mtx_);
+            std::swap(pending, pending_);
+        }
+
+        if (!pending.empty())
+        {
+            LPT_(error).format("shmem::parcelport::do_stop: dropping {} "
+                               "message(s) to destinations with a full queue",
+                pending.size());
+        }
+
+        for (auto const& s : pending)
+        {
+            s->cancel(hpx::make_system_error_code(
+                hpx::error::network_error, hpx::throwmode::lightweight));
+        }
+        {
+            std::lock_guard l(queues_mtx_);
+            queues_.clear();
+        }
+
+        receiver_.shutdown();
+    }
+
+    bool connection_handler::can_connect(
+        parcelset::locality const& dest, bool use_alternative_parcelport)
+    {
+        if (!use_alternative_parcelport ||
+            !dest.get<locality>().same_node(here_.get<locality>()))
+        {
+            return false;
+        }
+
+        // The destination may still be unreachable, e.g. if it runs in a
+        // container with a separate shared memory namespace. Those
+        // destinations are served by the next parcelport.
+        std::error_code ec;
+        return get_queue_segment(dest.get<locality>(), ec) != nullptr;
+    }
+
+    std::shared_ptr<shared_memory_segment>
+    connection_handler::get_queue_segment(
+        locality const& l, std::error_code& ec)
+    {
+        std::lock_guard lk(queues_mtx_);
+
+        auto it = queues_.find(l.pid());
+        if (it != queues_.end())
+        {
+            return it->second;
+        }
+
+        auto segment = std::make_shared<shared_memory_segment>();
+        if (!segment->open(l.segment_name(), ec))
+        {
+            return {};
+        }
+
+        if (!message_queue::is_valid(segment->data(), segment->size()))
+        {
+            ec = std::make_error_code(std::errc::invalid_argument);
+            return {};
+        }
+
+        queues_.emplace(l.pid(), segment);
+        return segment;
+    }
+
+    std::shared_ptr<sender> connection_handler::create_connection(
+        parcelset::locality const& l, error_code& ec)
+    {
+        // The parcelport is being stopped, this avoids hangs when late parcels
+        // are in flight (those are mainly decref requests).
+        if (stopped_.load(std::memory_order_acquire))
+        {
+            return {};
+        }
+
+        std::error_code error;
+        std::shared_ptr<shared_memory_segment> segment =
+            get_queue_segment(l.get<locality>(), error);
+
+        if (!segment)
+        {
+            if (tolerate_node_faults())
+                return {};
+
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::connection_handler::get_connection",
+                "{} (while trying to connect to: {})", error.message(), l);
+            return {};
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return std::make_shared<sender>(*this, l, HPX_MOVE(segment));
+    }
+
+    parcelset::locality connection_handler::agas_locality(
+        util::runtime_configuration const&) const
+    {
+        // this parcelport can't be used for bootstrapping
+        return parcelset::locality(locality());
+    }
+
+    parcelset::locality connection_handler::create_locality() const
+    {
+        return parcelset::locality(locality());
+    }
+
+    void connection_handler::add_pending(std::shared_ptr<sender> const& s)
+    {
+        std::lock_guard l(pending_mtx_);
+        pending_.push_back(s);
+    }
+
+    bool connection_handler::send_pending()
+    {
+        std::shared_ptr<sender> s;
+        {
+            std::unique_lock const l(pending_mtx_, std::try_to_lock);
+            if (!l.owns_lock() || pending_.empty())
+            {
+                return false;
+            }
+
+            s = HPX_MOVE(pending_.front());
+            pending_.pop_front();
+        }
+
+        // the destination queue might still be full, this is no progress
+        if (!s->send())
+        {
+            add_pending(s);
+            return false;
+        }
+        return true;
+    }
+
+    bool connection_handler::has_pending()
+    {
+        std::lock_guard l(pending_mtx_);
+        return !pending_.empty();
+    }
+
+    bool connection_handler::background_work(
+        std::size_t /* num_thread */, parcelport_background_mode mode)
+    {
+        if (stopped_.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        bool has_work = false;
+        if (mode & parcelport_background_mode::send)
+        {
+            has_work = send_pending();
+        }
+        if (mode & parcelport_background_mode::receive)
+        {
+            has_work = receiver_.background_work() || has_work;
+        }
+        return has_work;
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,145 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+
+#include <hpx/parcelport_shmem/connection_handler.hpp>
+#include <hpx/parcelport_shmem/header.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <system_error>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    sender::sender(connection_handler& parcelport,
+        parcelset::locality const& locality_id,
+        std::shared_ptr<shared_memory_segment> queue_segment)
+      : parcelport_(parcelport)
+      , there_(locality_id)
+      , queue_segment_(HPX_MOVE(queue_segment))
+      , queue_(queue_segment_->data())
+      , header_()
+      , prepared_(false)
+    {
+    }
+
+    sender::~sender()
+    {
+        // remove the body of a message that was never handed over
+        body_segment_.unlink();
+    }
+
+    bool sender::prepare_message()
+    {
+        header_ = header(buffer_, parcelport_.pid());
+
+        if (sizeof(header) + header_.body_size_ > queue_.max_message_size())
+        {
+            // the message body is too large to be stored inline, copy it into
+            // a separate segment which will be mapped by the receiver
+            header_.segment_id_ = parcelport_.next_segment_id();
+
+            std::error_code ec;
+            if (!body_segment_.create(header_.segment_name(),
+                    static_cast<std::size_t>(header_.body_size_), ec))
+            {
+                complete(ec);
+                return false;
+            }
+
+            header::write_body(buffer_, static_cast<char*>(body_segment_.data()));
+
+            // the mapping is not needed anymore, the segment stays alive
+            body_segment_.close();
+        }
+
+        prepared_ = true;
+        return true;
+    }
+
+    bool sender::send()
+    {
+        if (!prepared_ && !prepare_message())
+        {
+            return true;    // error was reported already
+        }
+
+        std::size_t const size = header_.is_inline() ?
+            sizeof(header) + static_cast<std::size_t>(header_.body_size_) :
+            sizeof(header);
+
+        bool const enqueued = queue_.try_enqueue(size, [this](char* data) {
+            std::memcpy(data, &header_, sizeof(header));
+            if (header_.is_inline())
+            {
+                header::write_body(buffer_, data + sizeof(header));
+            }
+        });
+
+        if (!enqueued)
+        {
+            return false;
+        }
+
+        // the receiver is now responsible for removing the body segment
+        body_segment_ = shared_memory_segment();
+
+        complete(std::error_code());
+        return true;
+    }
+
+    void sender::cancel(std::error_code const& ec)
+    {
+        // remove the body of the message, it will never be handed over
+        body_segment_.unlink();
+        body_segment_ = shared_memory_segment();
+
+        complete(ec);
+    }
+
+    void sender::add_pending()
+    {
+        parcelport_.add_pending(shared_from_this());
+    }
+
+    void sender::complete(std::error_code const& ec)
+    {
+        prepared_ = false;
+
+        // just call initial handler
+        handler_type handler;
+        std::swap(handler, handler_);
+        handler(ec);
+
+        // complete data point and push back onto gatherer
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        if (!ec)
+        {
+            buffer_.data_point_.time_ =
+                timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+            parcelport_.add_sent_data(buffer_.data_point_);
+        }
+#endif
+        buffer_.clear();
+
+        // Call post-processing handler, which will send remaining pending
+        // parcels. Pass along the connection so it can be reused if more
+        // parcels have to be sent.
+        postprocess_handler_type postprocess_handler;
+        std::swap(postprocess_handler, postprocess_handler_);
+        postprocess_handler(ec, there_, shared_from_this());
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,162 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace {
+
+        bool map_segment(int fd, std::size_t size, void*& data,
+            std::error_code& ec) noexcept
+        {
+            void* p =
+                ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED)
+            {
+                ec = std::error_code(errno, std::system_category());
+                ::close(fd);
+                return false;
+            }
+
+            // the mapping stays valid after the descriptor was closed
+            ::close(fd);
+            data = p;
+            return true;
+        }
+    }    // namespace
+
+    shared_memory_segment::shared_memory_segment(
+        shared_memory_segment&& rhs) noexcept
+      : name_(HPX_MOVE(rhs.name_))
+      , data_(std::exchange(rhs.data_, nullptr))
+      , size_(std::exchange(rhs.size_, 0))
+    {
+    }
+
+    shared_memory_segment& shared_memory_segment::operator=(
+        shared_memory_segment&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            close();
+            name_ = HPX_MOVE(rhs.name_);
+            data_ = std::exchange(rhs.data_, nullptr);
+            size_ = std::exchange(rhs.size_, 0);
+        }
+        return *this;
+    }
+
+    shared_memory_segment::~shared_memory_segment()
+    {
+        close();
+    }
+
+    bool shared_memory_segment::create(
+        std::string const& name, std::size_t size, std::error_code& ec)
+    {
+        close();
+
+        // remove stale segments left behind by a crashed process that happened
+        // to use the same process id
+        ::shm_unlink(name.c_str());
+
+        int const fd =
+            ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+        if (fd == -1)
+        {
+            ec = std::error_code(errno, std::system_category());
+            return false;
+        }
+
+        if (::ftruncate(fd, static_cast<off_t>(size)) == -1)
+        {
+            ec = std::error_code(errno, std::system_category());
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            return false;
+        }
+
+        if (!map_segment(fd, size, data_, ec))
+        {
+            ::shm_unlink(name.c_str());
+            return false;
+        }
+
+        name_ = name;
+        size_ = size;
+        return true;
+    }
+
+    bool shared_memory_segment::open(std::string const& name, std::error_code& ec)
+    {
+        close();
+
+        int const fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd == -1)
+        {
+            ec = std::error_code(errno, std::system_category());
+            return false;
+        }
+
+        struct stat st = {};
+        if (::fstat(fd, &st) == -1)
+        {
+            ec = std::error_code(errno, std::system_category());
+            ::close(fd);
+            return false;
+        }
+
+        auto const size = static_cast<std::size_t>(st.st_size);
+        if (!map_segment(fd, size, data_, ec))
+        {
+            return false;
+        }
+
+        name_ = name;
+        size_ = size;
+        return true;
+    }
+
+    void shared_memory_segment::close() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(data_, size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    void shared_memory_segment::unlink() noexcept
+    {
+        if (!name_.empty())
+        {
+            unlink(name_);
+        }
+    }
+
+    void shared_memory_segment::unlink(std::string const& name) noexcept
+    {
+        ::shm_unlink(name.c_str());
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
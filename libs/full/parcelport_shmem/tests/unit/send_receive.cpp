@@ -0,0 +1,127 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Send messages of various sizes between two localities running on the same
+// node. Small messages are placed into the queue slots of the destination,
+// large messages (exceeding hpx.parcel.shmem.slot_size) are passed through
+// separate shared memory segments.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint32_t> echo(std::vector<std::uint32_t> const& data)
+{
+    return data;
+}
+HPX_PLAIN_ACTION(echo)
+
+// direct actions are executed by the thread decoding the message
+std::uint64_t checksum(std::vector<std::uint32_t> const& data)
+{
+    std::uint64_t sum = 0;
+    for (std::uint32_t v : data)
+        sum += v;
+    return sum;
+}
+HPX_PLAIN_DIRECT_ACTION(checksum)
+
+using buffer_type = hpx::serialization::serialize_buffer<char>;
+
+// the buffer is sent as a zero-copy chunk
+std::size_t count_bytes(buffer_type const& buffer, char value)
+{
+    return static_cast<std::size_t>(
+        std::count(buffer.data(), buffer.data() + buffer.size(), value));
+}
+HPX_PLAIN_ACTION(count_bytes)
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint32_t> make_data(std::size_t size)
+{
+    std::vector<std::uint32_t> data(size);
+    for (std::size_t i = 0; i != size; ++i)
+        data[i] = static_cast<std::uint32_t>(i * 7 + 1);
+    return data;
+}
+
+void test_sizes(hpx::id_type const& dest)
+{
+    // the sizes cover messages stored in a slot and messages that exceed the
+    // slot size (16384 bytes by default)
+    for (std::size_t size : {0, 1, 100, 1000, 4000, 5000, 100000, 1000000})
+    {
+        std::vector<std::uint32_t> const data = make_data(size);
+
+        HPX_TEST(hpx::async<echo_action>(dest, data).get() == data);
+        HPX_TEST_EQ(
+            hpx::async<checksum_action>(dest, data).get(), checksum(data));
+    }
+
+    for (std::size_t size : {1000, 100000, 1000000})
+    {
+        buffer_type buffer(size);
+        std::fill(buffer.begin(), buffer.end(), 'x');
+        HPX_TEST_EQ(hpx::async<count_bytes_action>(dest, buffer, 'x').get(),
+            size);
+    }
+}
+
+// send more messages than the destination queue has slots
+void test_many_messages(hpx::id_type const& dest)
+{
+    constexpr std::size_t num_messages = 2000;
+
+    std::vector<hpx::future<std::uint64_t>> results;
+    results.reserve(num_messages);
+    for (std::size_t i = 0; i != num_messages; ++i)
+    {
+        // every tenth message is sent through a separate segment
+        std::vector<std::uint32_t> const data =
+            make_data(i % 10 == 0 ? 10000 : i % 100);
+        results.push_back(hpx::async<checksum_action>(dest, data));
+    }
+
+    for (std::size_t i = 0; i != num_messages; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(),
+            checksum(make_data(i % 10 == 0 ? 10000 : i % 100)));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    HPX_TEST_EQ(hpx::get_config_entry("hpx.parcel.shmem.enable", "0"),
+        std::string("1"));
+
+    for (hpx::id_type const& dest : hpx::find_remote_localities())
+    {
+        test_sizes(dest);
+        test_many_messages(dest);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
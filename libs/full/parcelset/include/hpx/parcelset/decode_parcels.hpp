@@ -210,35 +210,28 @@ namespace hpx::parcelset {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    inline void handle_received_parcels(
-        std::vector<parcelset::parcel>&& deferred_parcels,
-        std::size_t num_thread = -1)
-    {
-        if (HPX_LIKELY(deferred_parcels.empty()))
-        {
-            return;
-        }
+    namespace detail {
 
-        for (std::size_t i = 1; i != deferred_parcels.size(); ++i)
+        // Schedule the action of the given parcel on a new HPX thread.
+        inline void spawn_received_parcel(
+            parcelset::parcel&& p, std::size_t num_thread)
         {
-            LPT_(debug).format("handle_received_parcels: received: {}",
-                deferred_parcels[i].parcel_id());
+            LPT_(debug).format(
+                "handle_received_parcels: received: {}", p.parcel_id());
 
             auto f = [num_thread](parcelset::parcel&& p) {
                 if (p.schedule_action(num_thread))
                 {
-                    // route this parcel as the object was
-                    // migrated
+                    // route this parcel as the object was migrated
                     agas::route(HPX_MOVE(p),
                         &parcelset::detail::parcel_route_handler,
                         threads::thread_priority::normal);
                 }
             };
 
-            // schedule all but the first parcel on a new thread.
             hpx::threads::thread_init_data init_data(
-                hpx::threads::make_thread_function_nullary(util::deferred_call(
-                    HPX_MOVE(f), HPX_MOVE(deferred_parcels[i]))),
+                hpx::threads::make_thread_function_nullary(
+                    util::deferred_call(HPX_MOVE(f), HPX_MOVE(p))),
                 "schedule_parcel", threads::thread_priority::boost,
                 threads::thread_schedule_hint(
                     static_cast<std::int16_t>(num_thread)),
@@ -246,6 +239,23 @@ namespace hpx::parcelset {
                 threads::thread_schedule_state::pending, true);
             hpx::threads::register_thread(init_data);
         }
+    }    // namespace detail
+
+    inline void handle_received_parcels(
+        std::vector<parcelset::parcel>&& deferred_parcels,
+        std::size_t num_thread = -1)
+    {
+        if (HPX_LIKELY(deferred_parcels.empty()))
+        {
+            return;
+        }
+
+        // schedule all but the first parcel on a new thread.
+        for (std::size_t i = 1; i != deferred_parcels.size(); ++i)
+        {
+            detail::spawn_received_parcel(
+                HPX_MOVE(deferred_parcels[i]), num_thread);
+        }
 
         // If we are the first deferred parcel, we don't need to spin
         // up a new thread...
@@ -290,7 +300,13 @@ namespace hpx::parcelset {
                 {
                     archive >> parcel_count;    //-V128
                 }
-                if (parcel_count > 1 || allow_zero_copy_receive)
+
+                // Zero-copy received parcels refer to memory that has not been
+                // received yet, those have to be returned to the caller as a
+                // whole. All other deferred parcels are dispatched while the
+                // remainder of the message is still being decoded, only the
+                // last one is returned to be handled by the calling thread.
+                if (allow_zero_copy_receive)
                 {
                     deferred_parcels.reserve(parcel_count);
                 }
@@ -353,6 +369,17 @@ namespace hpx::parcelset {
                     }
                     else if (deferred_schedule || allow_zero_copy_receive)
                     {
+                        if (!allow_zero_copy_receive &&
+                            !deferred_parcels.empty())
+                        {
+                            // the previously decoded parcel can run
+                            // concurrently to decoding the remaining ones
+                            HPX_ASSERT(deferred_parcels.size() == 1);
+                            detail::spawn_received_parcel(
+                                HPX_MOVE(deferred_parcels.back()), num_thread);
+                            deferred_parcels.pop_back();
+                        }
+
                         // store parcel if needed
                         deferred_parcels.emplace_back(HPX_MOVE(p));
                     }
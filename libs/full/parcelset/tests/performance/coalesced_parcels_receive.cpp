@@ -0,0 +1,145 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the receive throughput for messages carrying a large
+// number of parcels (as produced by parcel coalescing). All parcels of one
+// iteration are handed to the parcel handler at once, which sends them to the
+// destination locality as a single message.
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/iostream.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> received_parcels(0);
+
+// Direct actions are the ones whose scheduling is deferred until the message
+// carrying them has been decoded.
+void receive_parcel(std::vector<double> const&)
+{
+    ++received_parcels;
+}
+HPX_PLAIN_DIRECT_ACTION(receive_parcel, receive_parcel_action)
+
+void wait_for_parcels(std::size_t expected)
+{
+    while (received_parcels.load() < expected)
+    {
+        hpx::this_thread::yield();
+    }
+}
+HPX_PLAIN_ACTION(wait_for_parcels, wait_for_parcels_action)
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::parcelset::parcel generate_parcel(
+    hpx::id_type const& dest_id, std::vector<double> const& data)
+{
+    hpx::naming::address addr;
+    hpx::naming::gid_type dest = dest_id.get_gid();
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        std::move(dest), std::move(addr), receive_parcel_action(),
+        hpx::launch::async, data));
+
+    p.set_source_id(hpx::find_here());
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_parcels = vm["parcels"].as<std::size_t>();
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+    std::size_t const data_size = vm["data_size"].as<std::size_t>();
+    bool const print_header = vm.count("no-header") == 0;
+
+    std::vector<hpx::id_type> const localities = hpx::find_remote_localities();
+    if (localities.empty())
+    {
+        hpx::cout << "this benchmark requires at least two localities\n"
+                  << std::flush;
+        return hpx::finalize();
+    }
+
+    hpx::id_type const& dest = localities[0];
+    std::vector<double> const data(data_size, 42.0);
+
+    double elapsed = 0;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        std::vector<hpx::parcelset::parcel> parcels;
+        parcels.reserve(num_parcels);
+        for (std::size_t j = 0; j != num_parcels; ++j)
+        {
+            parcels.push_back(generate_parcel(dest, data));
+        }
+
+        hpx::chrono::high_resolution_timer const t;
+
+        hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
+            std::move(parcels));
+
+        wait_for_parcels_action()(dest, (i + 1) * num_parcels);
+
+        elapsed += t.elapsed();
+    }
+
+    if (print_header)
+    {
+        hpx::cout << "parcels,datasize,iterations,average_time[s],"
+                     "throughput[parcels/s]\n"
+                  << std::flush;
+    }
+
+    hpx::util::format_to(hpx::cout, "{},{},{},{},{}\n", num_parcels,
+        data_size, iterations, elapsed / iterations,
+        static_cast<double>(num_parcels * iterations) / elapsed)
+        << std::flush;
+    hpx::util::print_cdash_timing("CoalescedParcelsReceive",
+        elapsed / iterations);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("parcels",
+            hpx::program_options::value<std::size_t>()->default_value(1000),
+            "number of parcels sent as one message (default: 1000)")
+        ("iterations",
+            hpx::program_options::value<std::size_t>()->default_value(100),
+            "number of messages to send (default: 100)")
+        ("data_size",
+            hpx::program_options::value<std::size_t>()->default_value(16),
+            "number of doubles sent as the argument of each parcel "
+            "(default: 16)")
+        ("no-header", "do not print out the csv header row")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::init(argc, argv, init_args);
+}
+
+#endif
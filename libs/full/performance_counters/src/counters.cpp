@@ -23,6 +23,7 @@
 #include <hpx/performance_counters/counter_parser.hpp>
 #include <hpx/performance_counters/counters.hpp>
 #include <hpx/performance_counters/registry.hpp>
+#include <hpx/runtime_configuration/deferred_modules.hpp>
 #include <hpx/runtime_local/get_num_all_localities.hpp>
 #include <hpx/runtime_local/get_os_thread_count.hpp>
 #include <hpx/runtime_local/runtime_local_fwd.hpp>
@@ -577,6 +578,10 @@ namespace hpx::performance_counters {
                 "the runtime is not currently running");
             return counter_status::generic_error;
         }
+
+        // all modules have to be loaded to discover all counter types
+        hpx::util::load_deferred_modules();
+
         return registry::instance().discover_counter_types(
             discover_counter, mode, ec);
     }
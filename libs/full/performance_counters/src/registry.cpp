@@ -20,6 +20,7 @@
 #include <hpx/performance_counters/server/raw_counter.hpp>
 #include <hpx/performance_counters/server/raw_values_counter.hpp>
 #include <hpx/performance_counters/server/statistics_counter.hpp>
+#include <hpx/runtime_configuration/deferred_modules.hpp>
 #include <hpx/statistics/rolling_max.hpp>
 #include <hpx/statistics/rolling_min.hpp>
 #include <hpx/util/regex_from_pattern.hpp>
@@ -58,6 +59,12 @@ namespace hpx { namespace performance_counters {
             if (!ec)
                 it = countertypes_.find("/" + p.objectname_);
         }
+
+        // the counter type might be exposed by a module which is loaded on
+        // demand
+        if (it == countertypes_.end() && hpx::util::load_deferred_modules())
+            return locate_counter_type(type_name);
+
         return it;
     }
 
@@ -75,6 +82,12 @@ namespace hpx { namespace performance_counters {
             if (!ec)
                 it = countertypes_.find("/" + p.objectname_);
         }
+
+        // the counter type might be exposed by a module which is loaded on
+        // demand
+        if (it == countertypes_.end() && hpx::util::load_deferred_modules())
+            return locate_counter_type(type_name);
+
         return it;
     }
 
@@ -167,6 +180,9 @@ namespace hpx { namespace performance_counters {
         }
         else
         {
+            // all modules have to be loaded to match all counter types
+            hpx::util::load_deferred_modules();
+
             std::string str_rx(util::regex_from_pattern(type_name, ec));
             if (ec)
                 return counter_status::invalid_data;
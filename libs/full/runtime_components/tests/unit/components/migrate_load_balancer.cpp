@@ -0,0 +1,273 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_distributed/load_balancer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::migration_support<
+        hpx::components::component_base<test_server>>
+{
+    using base_type = hpx::components::migration_support<
+        hpx::components::component_base<test_server>>;
+
+    test_server() = default;
+
+    test_server(test_server const& rhs)
+      : base_type(rhs)
+    {
+    }
+
+    test_server(test_server&& rhs) noexcept
+      : base_type(std::move(rhs))
+    {
+    }
+
+    test_server& operator=(test_server const&) = default;
+    test_server& operator=(test_server&&) noexcept = default;
+
+    [[nodiscard]] hpx::id_type call() const
+    {
+        return hpx::find_here();
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call, call_action)
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+using server_type = hpx::components::component<test_server>;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+using call_action = test_server::call_action;
+HPX_REGISTER_ACTION_DECLARATION(call_action)
+HPX_REGISTER_ACTION(call_action)
+
+struct test_client : hpx::components::client_base<test_client, test_server>
+{
+    using base_type = hpx::components::client_base<test_client, test_server>;
+
+    test_client() = default;
+
+    explicit test_client(hpx::id_type const& id)
+      : base_type(id)
+    {
+    }
+    test_client(hpx::future<hpx::id_type>&& id)
+      : base_type(std::move(id))
+    {
+    }
+
+    [[nodiscard]] hpx::id_type call() const
+    {
+        return hpx::async<call_action>(this->get_id()).get();
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_greedy_policy()
+{
+    using hpx::components::component_load;
+    using hpx::components::locality_load;
+    using hpx::components::migration_request;
+
+    std::vector<locality_load> localities = {{hpx::invalid_id, 10.0},
+        {hpx::invalid_id, 1.0}, {hpx::invalid_id, 4.0}};
+
+    std::vector<component_load> components = {{hpx::invalid_id, 0, 5},
+        {hpx::invalid_id, 0, 50}, {hpx::invalid_id, 0, 0},
+        {hpx::invalid_id, 1, 100}, {hpx::invalid_id, 0, 20}};
+
+    // the hottest components of the most loaded locality are moved to the
+    // localities with less than average load
+    std::vector<migration_request> requests =
+        hpx::components::greedy_load_balancing_policy(0.25, 2)(
+            localities, components);
+
+    HPX_TEST_EQ(requests.size(), std::size_t(2));
+    HPX_TEST_EQ(requests[0].component, std::size_t(1));
+    HPX_TEST_EQ(requests[0].target, std::size_t(1));
+    HPX_TEST_EQ(requests[1].component, std::size_t(4));
+    HPX_TEST_EQ(requests[1].target, std::size_t(2));
+
+    // no migrations if the imbalance is below the threshold
+    localities[0].load = 6.0;
+    requests = hpx::components::greedy_load_balancing_policy(0.75, 2)(
+        localities, components);
+    HPX_TEST(requests.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_balanced(hpx::id_type const& here)
+{
+    test_client c1(hpx::new_<test_server>(here));
+    test_client c2(hpx::new_<test_server>(here));
+
+    // the uptime is the same on all localities
+    hpx::components::load_balancer_parameters params;
+    params.load_counter = "/runtime{locality#*/total}/uptime";
+    params.hysteresis = 1;
+
+    std::size_t policy_invocations = 0;
+    hpx::components::load_balancer balancer(params,
+        [&](std::vector<hpx::components::locality_load> const&,
+            std::vector<hpx::components::component_load> const&) {
+            ++policy_invocations;
+            return std::vector<hpx::components::migration_request>();
+        });
+
+    balancer.register_component(c1);
+    balancer.register_component<test_server>(c2.get_id());
+
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST_EQ(c1.call(), here);
+    }
+
+    HPX_TEST_EQ(balancer.rebalance(), std::size_t(0));
+    HPX_TEST_EQ(policy_invocations, std::size_t(0));
+    HPX_TEST_EQ(balancer.num_migrations(), std::size_t(0));
+
+    balancer.unregister_component(c1.get_id());
+    balancer.unregister_component(c2.get_id());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The actions invoked on a component are counted, the counts drive the
+// decisions of the load balancing policy.
+void test_invocation_count(hpx::id_type const& here)
+{
+    test_client hot(hpx::new_<test_server>(here));
+    test_client cold(hpx::new_<test_server>(here));
+
+    std::shared_ptr<test_server> const ptr =
+        hpx::get_ptr<test_server>(hpx::launch::sync, hot.get_id());
+    std::uint64_t const count = ptr->invocation_count();
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST_EQ(hot.call(), here);
+    }
+    HPX_TEST_EQ(count + 10, ptr->invocation_count());
+
+    // pinning the object without running an action is not counted
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST(hpx::get_ptr<test_server>(hpx::launch::sync, hot.get_id()));
+    }
+    HPX_TEST_EQ(count + 10, ptr->invocation_count());
+
+    // treat any sample as an imbalance
+    hpx::components::load_balancer_parameters params;
+    params.load_counter = "/runtime{locality#*/total}/uptime";
+    params.threshold = -1.0;
+    params.hysteresis = 1;
+
+    // the greedy policy is applied as if there was a second, idle locality
+    std::vector<hpx::components::migration_request> requests;
+    hpx::components::load_balancer balancer(params,
+        [&](std::vector<hpx::components::locality_load> const& localities,
+            std::vector<hpx::components::component_load> const& components) {
+            HPX_TEST_EQ(localities.size(), std::size_t(1));
+            HPX_TEST_EQ(components.size(), std::size_t(2));
+
+            std::vector<hpx::components::locality_load> loads = localities;
+            loads.push_back({hpx::invalid_id, 0.0});
+            requests = hpx::components::greedy_load_balancing_policy(0.25, 1)(
+                loads, components);
+
+            // the migration to the non-existing locality is ignored
+            return requests;
+        });
+
+    balancer.register_component(cold);
+    balancer.register_component(hot);
+
+    HPX_TEST_EQ(balancer.rebalance(), std::size_t(0));
+
+    // the component which received the calls was chosen for migration
+    HPX_TEST_EQ(requests.size(), std::size_t(1));
+    HPX_TEST_EQ(requests[0].component, std::size_t(1));
+    HPX_TEST_EQ(requests[0].target, std::size_t(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_rebalance(hpx::id_type const& source, hpx::id_type const& target)
+{
+    test_client c(hpx::new_<test_server>(source));
+    HPX_TEST_EQ(c.call(), source);
+
+    // treat any sample as an imbalance, the policy moves all components to
+    // the target locality
+    hpx::components::load_balancer_parameters params;
+    params.load_counter = "/runtime{locality#*/total}/uptime";
+    params.threshold = -1.0;
+    params.hysteresis = 2;
+
+    hpx::components::load_balancer balancer(params,
+        [&](std::vector<hpx::components::locality_load> const& localities,
+            std::vector<hpx::components::component_load> const& components) {
+            std::vector<hpx::components::migration_request> requests;
+            for (std::size_t l = 0; l != localities.size(); ++l)
+            {
+                if (localities[l].locality != target)
+                {
+                    continue;
+                }
+                for (std::size_t i = 0; i != components.size(); ++i)
+                {
+                    HPX_TEST_NEQ(components[i].invocations, std::uint64_t(0));
+                    requests.push_back({i, l});
+                }
+            }
+            return requests;
+        });
+
+    balancer.register_component(c);
+
+    // the imbalance has to be observed twice before migrating
+    HPX_TEST_EQ(c.call(), source);
+    HPX_TEST_EQ(balancer.rebalance(), std::size_t(0));
+
+    HPX_TEST_EQ(c.call(), source);
+    HPX_TEST_EQ(balancer.rebalance(), std::size_t(1));
+    HPX_TEST_EQ(balancer.num_migrations(), std::size_t(1));
+
+    HPX_TEST_EQ(c.call(), target);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_greedy_policy();
+    test_balanced(hpx::find_here());
+    test_invocation_count(hpx::find_here());
+
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_rebalance(hpx::find_here(), id);
+        test_rebalance(id, hpx::find_here());
+    }
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,261 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file load_balancer.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/async_colocated/async_colocated.hpp>
+#include <hpx/components/client_base.hpp>
+#include <hpx/components/get_ptr.hpp>
+#include <hpx/components_base/traits/is_component.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/naming_base/naming_base.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/runtime_distributed/migrate_component.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hpx::components {
+
+    /// The load of a locality as sampled by the \a load_balancer
+    struct locality_load
+    {
+        hpx::id_type locality;
+        double load = 0.0;
+    };
+
+    /// The load of a component registered with the \a load_balancer
+    struct component_load
+    {
+        hpx::id_type id;
+
+        /// The index of the locality (into the sampled locality loads) the
+        /// component is currently located on
+        std::size_t locality = 0;
+
+        /// The number of actions invoked on the component since the previous
+        /// sample
+        std::uint64_t invocations = 0;
+    };
+
+    /// A migration requested by a load balancing policy
+    struct migration_request
+    {
+        /// The index of the component (into the sampled component loads) to
+        /// migrate
+        std::size_t component = 0;
+
+        /// The index of the locality (into the sampled locality loads) to
+        /// migrate the component to
+        std::size_t target = 0;
+    };
+
+    /// A load balancing policy decides which of the registered components
+    /// should be migrated based on the sampled loads of the localities and
+    /// of the components. It is invoked only if the localities were observed
+    /// to be imbalanced for a configurable number of consecutive samples.
+    using load_balancing_policy =
+        hpx::function<std::vector<migration_request>(
+            std::vector<locality_load> const&,
+            std::vector<component_load> const&)>;
+
+    /// The default load balancing policy moves the components with the most
+    /// invocations from the most loaded locality to the least loaded
+    /// localities, as long as the load of the most loaded locality exceeds
+    /// the average load by more than the given threshold.
+    struct HPX_EXPORT greedy_load_balancing_policy
+    {
+        explicit greedy_load_balancing_policy(
+            double threshold = 0.25, std::size_t max_migrations = 1) noexcept
+          : threshold_(threshold)
+          , max_migrations_(max_migrations)
+        {
+        }
+
+        std::vector<migration_request> operator()(
+            std::vector<locality_load> const& localities,
+            std::vector<component_load> const& components) const;
+
+    private:
+        double threshold_;
+        std::size_t max_migrations_;
+    };
+
+    /// Parameters controlling the behavior of the \a load_balancer
+    struct load_balancer_parameters
+    {
+        /// The time between two consecutive samples
+        std::chrono::milliseconds interval = std::chrono::seconds(1);
+
+        /// The performance counter used to measure the load of a locality,
+        /// 'locality#*' is replaced with the instance name of each of the
+        /// localities
+        std::string load_counter = "/threadqueue{locality#*/total}/length";
+
+        /// The relative deviation of the load of the most loaded locality
+        /// from the average load which is considered to be an imbalance
+        double threshold = 0.25;
+
+        /// The number of consecutive samples an imbalance has to be observed
+        /// before any components are migrated
+        std::size_t hysteresis = 3;
+
+        /// The number of samples a migrated component is not considered for
+        /// another migration
+        std::size_t cooldown = 5;
+    };
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        // The locality a component currently lives on and the number of
+        // actions which were invoked on it
+        struct component_sample
+        {
+            std::uint32_t locality_id = naming::invalid_locality_id;
+            std::uint64_t invocations = 0;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned int const)
+            {
+                // clang-format off
+                ar & locality_id & invocations;
+                // clang-format on
+            }
+        };
+
+        template <typename Component>
+        component_sample get_component_sample(hpx::id_type const& id)
+        {
+            return component_sample{hpx::get_locality_id(),
+                hpx::get_ptr<Component>(hpx::launch::sync, id)
+                    ->invocation_count()};
+        }
+
+        template <typename Component>
+        struct get_component_sample_action
+          : ::hpx::actions::action<component_sample (*)(hpx::id_type const&),
+                &get_component_sample<Component>,
+                get_component_sample_action<Component>>
+        {
+        };
+
+        struct registered_component
+        {
+            using sample_function =
+                hpx::future<component_sample> (*)(hpx::id_type const&);
+            using migrate_function = hpx::future<hpx::id_type> (*)(
+                hpx::id_type const&, hpx::id_type const&);
+
+            hpx::id_type id;
+            sample_function sample;
+            migrate_function migrate;
+
+            std::uint64_t last_invocation_count = 0;
+            std::size_t cooldown = 0;
+        };
+
+        template <typename Component>
+        hpx::future<component_sample> registered_sample(hpx::id_type const& id)
+        {
+            return hpx::detail::async_colocated<
+                get_component_sample_action<Component>>(id, id);
+        }
+
+        template <typename Component>
+        hpx::future<hpx::id_type> registered_migrate(
+            hpx::id_type const& id, hpx::id_type const& target)
+        {
+            return hpx::components::migrate<Component>(id, target);
+        }
+    }    // namespace detail
+    /// \endcond
+
+    /// The load_balancer periodically samples the load of all localities and
+    /// the number of invocations of all registered components. If the load
+    /// is observed to be imbalanced for several consecutive samples, it
+    /// migrates components as decided by the load balancing policy. The load
+    /// balancing is performed on the locality the load_balancer was created
+    /// on, the registered components may be located on any locality.
+    ///
+    /// Only components supporting migration (see
+    /// \a hpx::components::migration_support) can be registered.
+    class HPX_EXPORT load_balancer
+    {
+    public:
+        explicit load_balancer(
+            load_balancer_parameters params = load_balancer_parameters(),
+            load_balancing_policy policy = load_balancing_policy());
+
+        load_balancer(load_balancer const&) = delete;
+        load_balancer(load_balancer&&) = delete;
+        load_balancer& operator=(load_balancer const&) = delete;
+        load_balancer& operator=(load_balancer&&) = delete;
+
+        ~load_balancer();
+
+        /// Register the component referenced by the given id for load
+        /// balancing
+        template <typename Component>
+        void register_component(hpx::id_type const& id)
+        {
+            static_assert(traits::is_component_v<Component>,
+                "the load_balancer can manage components only");
+            static_assert(Component::supports_migration(),
+                "the load_balancer can manage migratable components only");
+
+            register_component(id,
+                &detail::registered_sample<Component>,
+                &detail::registered_migrate<Component>);
+        }
+
+        /// Register the component referenced by the given client for load
+        /// balancing
+        template <typename Derived, typename Stub, typename Data>
+        void register_component(client_base<Derived, Stub, Data> const& c)
+        {
+            using component_type =
+                typename client_base<Derived, Stub, Data>::server_component_type;
+            register_component<component_type>(c.get_id());
+        }
+
+        /// Remove the component referenced by the given id from load balancing
+        void unregister_component(hpx::id_type const& id);
+
+        /// Start sampling the loads periodically
+        void start();
+
+        /// Stop sampling the loads
+        void stop();
+
+        /// Sample the loads once and migrate components if necessary, returns
+        /// the number of migrated components
+        std::size_t rebalance();
+
+        /// The overall number of components migrated by this load_balancer
+        std::size_t num_migrations() const noexcept;
+
+    private:
+        void register_component(hpx::id_type const& id,
+            detail::registered_component::sample_function sample,
+            detail::registered_component::migrate_function migrate);
+
+        struct data;
+        std::shared_ptr<data> data_;
+    };
+}    // namespace hpx::components
+#endif
@@ -29,6 +29,7 @@
 #include <hpx/runtime_distributed/find_here.hpp>
 #include <hpx/synchronization/latch.hpp>
 #include <hpx/synchronization/mutex.hpp>
+#include <hpx/synchronization/recursive_mutex.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
 #include <atomic>
@@ -165,6 +166,12 @@ namespace hpx::components::server {
         /// \brief Load all components on this locality.
         int load_components();
 
+        /// \brief Load all component modules whose loading was deferred
+        ///        during startup (see hpx.load_modules_on_demand).
+        ///
+        /// \returns Whether at least one module was loaded.
+        bool load_deferred_components();
+
         void call_startup_functions(bool pre_startup);
         void call_shutdown_functions(bool pre_shutdown);
 
@@ -289,6 +296,10 @@ namespace hpx::components::server {
             bool isenabled, hpx::program_options::options_description& options,
             std::set<std::string>& startup_handled);
 
+        bool is_module_loaded(std::string const& component,
+            filesystem::path const& lib) const;
+        void register_component_types(hpx::util::plugin::dll& d);
+
         bool load_startup_shutdown_functions(
             hpx::util::plugin::dll& d, error_code& ec);
         bool load_commandline_options(hpx::util::plugin::dll& d,
@@ -357,6 +368,33 @@ namespace hpx::components::server {
         modules_map_type& modules_;
         static_modules_type static_modules_;
 
+        // component modules to be loaded on demand
+        struct deferred_component
+        {
+            std::string instance;
+            std::string component;
+            filesystem::path lib;
+            bool isdefault;
+            bool isenabled;
+        };
+
+        std::mutex deferred_mtx_;
+        std::vector<deferred_component> deferred_components_;
+
+        // serializes loading the deferred modules, concurrent callers wait
+        // for the load in flight and return its result
+        hpx::recursive_mutex deferred_load_mtx_;
+        std::atomic<std::size_t> deferred_load_generation_ = 0;
+        bool deferred_load_result_ = false;
+
+        // startup functions of modules loaded after the corresponding list of
+        // functions was invoked have to be called right away, the number of
+        // functions invoked so far is protected by globals_mtx_
+        std::atomic<bool> pre_startup_functions_called_;
+        std::atomic<bool> startup_functions_called_;
+        std::size_t num_pre_startup_functions_called_ = 0;
+        std::size_t num_startup_functions_called_ = 0;
+
         hpx::spinlock globals_mtx_;
         std::list<startup_function_type> pre_startup_functions_;
         std::list<startup_function_type> startup_functions_;
@@ -0,0 +1,414 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/performance_counters/performance_counter.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+#include <hpx/runtime_distributed/load_balancer.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
+#include <hpx/synchronization/mutex.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::components {
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<migration_request> greedy_load_balancing_policy::operator()(
+        std::vector<locality_load> const& localities,
+        std::vector<component_load> const& components) const
+    {
+        std::vector<migration_request> result;
+        if (localities.size() < 2 || components.empty() || max_migrations_ == 0)
+        {
+            return result;
+        }
+
+        double load = 0.0;
+        for (locality_load const& l : localities)
+        {
+            load += l.load;
+        }
+
+        double const mean = load / static_cast<double>(localities.size());
+        if (mean <= 0.0)
+        {
+            return result;
+        }
+
+        // order the localities by increasing load
+        std::vector<std::size_t> order(localities.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(
+            order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs) {
+                return localities[lhs].load < localities[rhs].load;
+            });
+
+        std::size_t const most_loaded = order.back();
+        if (localities[most_loaded].load - mean <= threshold_ * mean)
+        {
+            return result;
+        }
+
+        // migrate to the localities with less than average load
+        std::vector<std::size_t> targets;
+        for (std::size_t l : order)
+        {
+            if (localities[l].load >= mean)
+            {
+                break;
+            }
+            targets.push_back(l);
+        }
+
+        if (targets.empty())
+        {
+            return result;
+        }
+
+        // move the hottest components first
+        std::vector<std::size_t> candidates;
+        for (std::size_t c = 0; c != components.size(); ++c)
+        {
+            if (components[c].locality == most_loaded &&
+                components[c].invocations != 0)
+            {
+                candidates.push_back(c);
+            }
+        }
+
+        std::stable_sort(candidates.begin(), candidates.end(),
+            [&](std::size_t lhs, std::size_t rhs) {
+                return components[lhs].invocations >
+                    components[rhs].invocations;
+            });
+
+        for (std::size_t c : candidates)
+        {
+            if (result.size() == max_migrations_)
+            {
+                break;
+            }
+            result.push_back(
+                migration_request{c, targets[result.size() % targets.size()]});
+        }
+
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct load_balancer::data
+    {
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        data(load_balancer_parameters&& params, load_balancing_policy&& policy)
+          : params_(HPX_MOVE(params))
+          , policy_(HPX_MOVE(policy))
+        {
+            if (policy_.empty())
+            {
+                policy_ = greedy_load_balancing_policy(params_.threshold);
+            }
+        }
+
+        // Leaves the counters untouched if any of them could not be created,
+        // the next round will try again.
+        void initialize_counters()
+        {
+            if (!localities_.empty())
+            {
+                return;
+            }
+
+            std::vector<hpx::id_type> localities = hpx::find_all_localities();
+            std::map<std::uint32_t, std::size_t> locality_indices;
+            std::vector<performance_counters::performance_counter> counters;
+            counters.reserve(localities.size());
+
+            std::string const pattern("locality#*");
+            for (hpx::id_type const& l : localities)
+            {
+                std::uint32_t const locality_id =
+                    naming::get_locality_id_from_id(l);
+                locality_indices[locality_id] = counters.size();
+
+                std::string name = params_.load_counter;
+                std::string::size_type const p = name.find(pattern);
+                if (p != std::string::npos)
+                {
+                    name.replace(p, pattern.size(),
+                        "locality#" + std::to_string(locality_id));
+                }
+                counters.emplace_back(name);
+            }
+
+            localities_ = HPX_MOVE(localities);
+            locality_indices_ = HPX_MOVE(locality_indices);
+            counters_ = HPX_MOVE(counters);
+        }
+
+        // returns the loads of all localities which could be sampled and,
+        // for each counter, its index into the returned loads (or npos)
+        std::pair<std::vector<locality_load>, std::vector<std::size_t>>
+        sample_localities()
+        {
+            std::vector<hpx::future<double>> values;
+            values.reserve(counters_.size());
+            for (auto const& counter : counters_)
+            {
+                values.push_back(counter.get_value<double>());
+            }
+
+            std::vector<locality_load> loads;
+            std::vector<std::size_t> indices(values.size(), npos);
+            loads.reserve(values.size());
+            for (std::size_t i = 0; i != values.size(); ++i)
+            {
+                // the locality might not be able to deliver its counter
+                // value (for instance while shutting down), skip it for
+                // this round
+                values[i].wait();
+                if (values[i].has_exception())
+                {
+                    continue;
+                }
+
+                indices[i] = loads.size();
+                loads.push_back(locality_load{localities_[i], values[i].get()});
+            }
+            return {HPX_MOVE(loads), HPX_MOVE(indices)};
+        }
+
+        // returns the loads of all components which may be migrated and their
+        // index into the registered components
+        std::pair<std::vector<component_load>, std::vector<std::size_t>>
+        sample_components(std::vector<std::size_t> const& locality_indices)
+        {
+            std::vector<hpx::future<detail::component_sample>> samples;
+            samples.reserve(components_.size());
+            for (auto const& c : components_)
+            {
+                samples.push_back(c.sample(c.id));
+            }
+
+            std::vector<component_load> loads;
+            std::vector<std::size_t> indices;
+            for (std::size_t i = 0; i != components_.size(); ++i)
+            {
+                auto& c = components_[i];
+
+                // the component might be in the process of being migrated
+                // (or destroyed), skip this sample
+                samples[i].wait();
+                if (samples[i].has_exception())
+                {
+                    continue;
+                }
+
+                detail::component_sample const sample = samples[i].get();
+
+                // a migrated component starts counting from zero
+                std::uint64_t const invocations =
+                    sample.invocations >= c.last_invocation_count ?
+                    sample.invocations - c.last_invocation_count :
+                    sample.invocations;
+                c.last_invocation_count = sample.invocations;
+
+                if (c.cooldown != 0)
+                {
+                    --c.cooldown;
+                    continue;
+                }
+
+                // the locality of the component must have been sampled
+                auto it = locality_indices_.find(sample.locality_id);
+                if (it == locality_indices_.end() ||
+                    locality_indices[it->second] == npos)
+                {
+                    continue;
+                }
+
+                loads.push_back(component_load{
+                    c.id, locality_indices[it->second], invocations});
+                indices.push_back(i);
+            }
+
+            return {HPX_MOVE(loads), HPX_MOVE(indices)};
+        }
+
+        std::size_t rebalance()
+        {
+            std::lock_guard<hpx::mutex> l(mtx_);
+
+            initialize_counters();
+
+            auto [localities, locality_indices] = sample_localities();
+            auto [components, indices] = sample_components(locality_indices);
+
+            double load = 0.0;
+            double max_load = 0.0;
+            for (locality_load const& ll : localities)
+            {
+                load += ll.load;
+                max_load = (std::max) (max_load, ll.load);
+            }
+
+            double const mean =
+                localities.empty() ? 0.0 : load / localities.size();
+            if (mean <= 0.0 || max_load - mean <= params_.threshold * mean)
+            {
+                imbalanced_samples_ = 0;
+                return 0;
+            }
+
+            // require the imbalance to persist before migrating anything
+            if (++imbalanced_samples_ < params_.hysteresis)
+            {
+                return 0;
+            }
+            imbalanced_samples_ = 0;
+
+            std::vector<migration_request> requests =
+                policy_(localities, components);
+
+            std::vector<hpx::future<hpx::id_type>> migrations;
+            std::vector<std::size_t> migrated;
+            for (migration_request const& r : requests)
+            {
+                if (r.component >= components.size() ||
+                    r.target >= localities.size() ||
+                    components[r.component].locality == r.target)
+                {
+                    continue;
+                }
+
+                auto& c = components_[indices[r.component]];
+                migrations.push_back(
+                    c.migrate(c.id, localities[r.target].locality));
+                migrated.push_back(indices[r.component]);
+            }
+
+            std::size_t result = 0;
+            for (std::size_t i = 0; i != migrations.size(); ++i)
+            {
+                migrations[i].wait();
+                if (!migrations[i].has_exception())
+                {
+                    components_[migrated[i]].cooldown = params_.cooldown;
+                    ++result;
+                }
+            }
+
+            num_migrations_ += result;
+            return result;
+        }
+
+        load_balancer_parameters params_;
+        load_balancing_policy policy_;
+
+        hpx::mutex mtx_;
+        std::vector<detail::registered_component> components_;
+        std::vector<hpx::id_type> localities_;
+        std::map<std::uint32_t, std::size_t> locality_indices_;
+        std::vector<performance_counters::performance_counter> counters_;
+        std::size_t imbalanced_samples_ = 0;
+        std::atomic<std::size_t> num_migrations_ = 0;
+
+        std::unique_ptr<hpx::util::interval_timer> timer_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    load_balancer::load_balancer(
+        load_balancer_parameters params, load_balancing_policy policy)
+      : data_(std::make_shared<data>(HPX_MOVE(params), HPX_MOVE(policy)))
+    {
+    }
+
+    load_balancer::~load_balancer()
+    {
+        stop();
+    }
+
+    void load_balancer::register_component(hpx::id_type const& id,
+        detail::registered_component::sample_function sample,
+        detail::registered_component::migrate_function migrate)
+    {
+        std::lock_guard<hpx::mutex> l(data_->mtx_);
+        data_->components_.push_back(
+            detail::registered_component{id, sample, migrate});
+    }
+
+    void load_balancer::unregister_component(hpx::id_type const& id)
+    {
+        std::lock_guard<hpx::mutex> l(data_->mtx_);
+        auto& components = data_->components_;
+        components.erase(std::remove_if(components.begin(), components.end(),
+                             [&](detail::registered_component const& c) {
+                                 return c.id == id;
+                             }),
+            components.end());
+    }
+
+    void load_balancer::start()
+    {
+        if (!data_->timer_)
+        {
+            std::weak_ptr<data> weak_data = data_;
+            data_->timer_ = std::make_unique<hpx::util::interval_timer>(
+                [weak_data]() -> bool {
+                    if (auto d = weak_data.lock())
+                    {
+                        try
+                        {
+                            d->rebalance();
+                        }
+                        catch (...)
+                        {
+                            // failing to rebalance is not fatal, try again
+                            // in the next round
+                        }
+                        return true;
+                    }
+                    return false;
+                },
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    data_->params_.interval)
+                    .count(),
+                "load_balancer", true);
+        }
+        data_->timer_->start(false);
+    }
+
+    void load_balancer::stop()
+    {
+        if (data_->timer_)
+        {
+            data_->timer_->stop();
+        }
+    }
+
+    std::size_t load_balancer::rebalance()
+    {
+        return data_->rebalance();
+    }
+
+    std::size_t load_balancer::num_migrations() const noexcept
+    {
+        return data_->num_migrations_.load();
+    }
+}    // namespace hpx::components
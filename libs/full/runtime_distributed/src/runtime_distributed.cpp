@@ -42,6 +42,7 @@
 #include <hpx/runtime_components/console_logging.hpp>
 #include <hpx/runtime_components/server/console_error_sink.hpp>
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 #include <hpx/runtime_distributed.hpp>
 #include <hpx/runtime_distributed/applier.hpp>
 #include <hpx/runtime_distributed/big_boot_barrier.hpp>
@@ -360,6 +361,8 @@ namespace hpx {
             lbt_ << "(2nd stage) runtime_distributed::run_helper: launching "
                     "pre_main";
 
+            util::mark_startup_stage("runtime start");
+
             // Change our thread description, as we're about to call pre_main
             threads::set_thread_description(threads::get_self_id(), "pre_main");
 
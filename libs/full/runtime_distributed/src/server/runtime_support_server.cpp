@@ -36,6 +36,8 @@
 #include <hpx/runtime_components/console_logging.hpp>
 #include <hpx/runtime_configuration/component_commandline_base.hpp>
 #include <hpx/runtime_configuration/component_factory_base.hpp>
+#include <hpx/runtime_configuration/component_registry_base.hpp>
+#include <hpx/runtime_configuration/deferred_modules.hpp>
 #include <hpx/runtime_configuration/static_factory_data.hpp>
 #include <hpx/runtime_distributed.hpp>
 #include <hpx/runtime_distributed/find_localities.hpp>
@@ -63,6 +65,8 @@
 #include <exception>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -148,7 +152,11 @@ namespace hpx { namespace components { namespace server {
       , plugins_()
       , modules_(cfg.modules())
       , static_modules_()
+      , pre_startup_functions_called_(false)
+      , startup_functions_called_(false)
     {
+        util::set_deferred_modules_loader(
+            [this]() { return load_deferred_components(); });
     }
 
     // function to be called during shutdown
@@ -557,6 +565,9 @@ namespace hpx { namespace components { namespace server {
 
     void runtime_support::tidy()
     {
+        // modules can't be loaded on demand anymore
+        util::set_deferred_modules_loader(util::deferred_modules_loader_type());
+
         // Only after releasing the components we are allowed to release
         // the modules. This is done in reverse order of loading.
         plugins_.clear();    // unload all plugins
@@ -803,57 +814,168 @@ namespace hpx { namespace components { namespace server {
 #endif
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    bool runtime_support::load_deferred_components()
+    {
+#if defined(HPX_HAVE_STATIC_LINKING)
+        return false;
+#else
+        // Callers arriving while the deferred modules are being loaded wait
+        // for the load to finish and report its result. Recursive calls made
+        // while loading find no deferred modules left.
+        std::size_t const generation = deferred_load_generation_.load();
+        std::lock_guard<hpx::recursive_mutex> ll(deferred_load_mtx_);
+        if (generation != deferred_load_generation_.load())
+        {
+            return deferred_load_result_;
+        }
+
+        std::vector<deferred_component> deferred;
+        {
+            std::lock_guard<std::mutex> l(deferred_mtx_);
+            std::swap(deferred, deferred_components_);
+        }
+
+        if (deferred.empty())
+            return false;
+
+        util::runtime_configuration& ini = get_runtime().get_config();
+        naming::resolver_client& agas_client = naming::get_agas_client();
+        naming::gid_type const prefix = agas_client.get_local_locality();
+
+        // command line options exposed by the modules loaded now are not
+        // considered anymore
+        hpx::program_options::options_description options;
+        std::set<std::string> startup_handled;
+
+        bool result = false;
+        for (deferred_component const& c : deferred)
+        {
+            bool const was_loaded =
+                modules_.find(HPX_MANGLE_STRING(c.component)) != modules_.end();
+
+            if (!load_component_dynamic(ini, c.instance, c.component, c.lib,
+                    prefix, agas_client, c.isdefault, c.isenabled, options,
+                    startup_handled))
+            {
+                continue;
+            }
+
+            LRT_(info).format("loaded deferred component module: {}: {}",
+                c.lib.string(), c.instance);
+
+            if (!was_loaded)
+            {
+                auto const it = modules_.find(HPX_MANGLE_STRING(c.component));
+                if (it != modules_.end())
+                    register_component_types(it->second);
+            }
+            result = true;
+        }
+
+        // invoke the startup functions registered by the loaded modules if
+        // the runtime has already invoked the corresponding functions
+        std::vector<startup_function_type> startup_functions;
+        {
+            std::lock_guard<hpx::spinlock> l(globals_mtx_);
+            if (pre_startup_functions_called_)
+            {
+                std::copy(std::next(pre_startup_functions_.begin(),
+                              static_cast<std::ptrdiff_t>(
+                                  num_pre_startup_functions_called_)),
+                    pre_startup_functions_.end(),
+                    std::back_inserter(startup_functions));
+                num_pre_startup_functions_called_ =
+                    pre_startup_functions_.size();
+            }
+            if (startup_functions_called_)
+            {
+                std::copy(std::next(startup_functions_.begin(),
+                              static_cast<std::ptrdiff_t>(
+                                  num_startup_functions_called_)),
+                    startup_functions_.end(),
+                    std::back_inserter(startup_functions));
+                num_startup_functions_called_ = startup_functions_.size();
+            }
+        }
+
+        for (startup_function_type& f : startup_functions)
+        {
+            f();
+        }
+
+        deferred_load_result_ = result;
+        ++deferred_load_generation_;
+
+        return result;
+#endif
+    }
+
     void runtime_support::call_startup_functions(bool pre_startup)
     {
+        // functions registered by modules loaded concurrently are invoked by
+        // load_deferred_components
+        std::vector<startup_function_type> startup_functions;
         if (pre_startup)
         {
             get_runtime().set_state(hpx::state::pre_startup);
-            for (startup_function_type& f : pre_startup_functions_)
             {
-                f();
+                std::lock_guard<hpx::spinlock> l(globals_mtx_);
+                startup_functions.assign(pre_startup_functions_.begin(),
+                    pre_startup_functions_.end());
+                num_pre_startup_functions_called_ = startup_functions.size();
+                pre_startup_functions_called_ = true;
             }
         }
         else
         {
             get_runtime().set_state(hpx::state::startup);
-            for (startup_function_type& f : startup_functions_)
             {
-                f();
+                std::lock_guard<hpx::spinlock> l(globals_mtx_);
+                startup_functions.assign(
+                    startup_functions_.begin(), startup_functions_.end());
+                num_startup_functions_called_ = startup_functions.size();
+                startup_functions_called_ = true;
             }
         }
+
+        for (startup_function_type& f : startup_functions)
+        {
+            f();
+        }
     }
 
     void runtime_support::call_shutdown_functions(bool pre_shutdown)
     {
         runtime& rt = get_runtime();
+
+        std::vector<shutdown_function_type> shutdown_functions;
         if (pre_shutdown)
         {
             rt.set_state(hpx::state::pre_shutdown);
-            for (shutdown_function_type& f : pre_shutdown_functions_)
-            {
-                try
-                {
-                    f();
-                }
-                catch (...)
-                {
-                    rt.report_error(std::current_exception());
-                }
-            }
+
+            std::lock_guard<hpx::spinlock> l(globals_mtx_);
+            shutdown_functions.assign(
+                pre_shutdown_functions_.begin(), pre_shutdown_functions_.end());
         }
         else
         {
             rt.set_state(hpx::state::shutdown);
-            for (shutdown_function_type& f : shutdown_functions_)
+
+            std::lock_guard<hpx::spinlock> l(globals_mtx_);
+            shutdown_functions.assign(
+                shutdown_functions_.begin(), shutdown_functions_.end());
+        }
+
+        for (shutdown_function_type& f : shutdown_functions)
+        {
+            try
             {
-                try
-                {
-                    f();
-                }
-                catch (...)
-                {
-                    rt.report_error(std::current_exception());
-                }
+                f();
+            }
+            catch (...)
+            {
+                rt.report_error(std::current_exception());
             }
         }
     }
@@ -1302,9 +1424,24 @@ namespace hpx { namespace components { namespace server {
                         "loading of component '{}'",
                         instance);
 #else
-                    load_component_dynamic(ini, instance, component, lib,
-                        prefix, agas_client, isdefault, isenabled, options,
-                        startup_handled);
+                    if (sect.get_entry("on_demand", "0") == "1" &&
+                        !is_module_loaded(component, lib))
+                    {
+                        // defer loading this module until one of its
+                        // component types, actions, or counters is needed
+                        LRT_(info).format("deferring dynamic loading: {}: {}",
+                            lib.string(), instance);
+
+                        std::lock_guard<std::mutex> l(deferred_mtx_);
+                        deferred_components_.push_back(deferred_component{
+                            instance, component, lib, isdefault, isenabled});
+                    }
+                    else
+                    {
+                        load_component_dynamic(ini, instance, component, lib,
+                            prefix, agas_client, isdefault, isenabled, options,
+                            startup_handled);
+                    }
 #endif
                 }
             }
@@ -1365,6 +1502,7 @@ namespace hpx { namespace components { namespace server {
             {
                 if (!startup.empty())
                 {
+                    std::lock_guard<hpx::spinlock> l(globals_mtx_);
                     if (pre_startup)
                     {
                         pre_startup_functions_.push_back(HPX_MOVE(startup));
@@ -1382,6 +1520,7 @@ namespace hpx { namespace components { namespace server {
             {
                 if (!shutdown.empty())
                 {
+                    std::lock_guard<hpx::spinlock> l(globals_mtx_);
                     if (pre_shutdown)
                     {
                         pre_shutdown_functions_.push_back(HPX_MOVE(shutdown));
@@ -1516,6 +1655,44 @@ namespace hpx { namespace components { namespace server {
         return true;
     }
 
+    bool runtime_support::is_module_loaded(
+        std::string const& component, filesystem::path const& lib) const
+    {
+        if (modules_.find(HPX_MANGLE_STRING(component)) != modules_.end())
+            return true;
+
+        // the application might have been linked against the module
+        return hpx::util::plugin::dll(
+            (lib / std::string(HPX_MAKE_DLL_STRING(component))).string())
+            .is_loaded();
+    }
+
+    void runtime_support::register_component_types(hpx::util::plugin::dll& d)
+    {
+        // modules loaded during startup register their component types from
+        // a startup function, see hpx::init
+        error_code ec(throwmode::lightweight);
+        hpx::util::plugin::plugin_factory<component_registry_base> pf(
+            d, "registry");
+
+        std::vector<std::string> names;
+        pf.get_names(names, ec);
+        if (ec)
+            return;
+
+        for (std::string const& name : names)
+        {
+            std::shared_ptr<component_registry_base> registry(
+                pf.create(name, ec));
+            if (ec)
+            {
+                ec = error_code(throwmode::lightweight);
+                continue;
+            }
+            registry->register_component_type();
+        }
+    }
+
     bool runtime_support::load_startup_shutdown_functions(
         hpx::util::plugin::dll& d, error_code& ec)
     {
@@ -1540,6 +1717,7 @@ namespace hpx { namespace components { namespace server {
             bool pre_startup = true;
             if (startup_shutdown->get_startup_function(startup, pre_startup))
             {
+                std::lock_guard<hpx::spinlock> l(globals_mtx_);
                 if (pre_startup)
                     pre_startup_functions_.push_back(HPX_MOVE(startup));
                 else
@@ -1550,6 +1728,7 @@ namespace hpx { namespace components { namespace server {
             bool pre_shutdown = false;
             if (startup_shutdown->get_shutdown_function(shutdown, pre_shutdown))
             {
+                std::lock_guard<hpx::spinlock> l(globals_mtx_);
                 if (pre_shutdown)
                     pre_shutdown_functions_.push_back(HPX_MOVE(shutdown));
                 else
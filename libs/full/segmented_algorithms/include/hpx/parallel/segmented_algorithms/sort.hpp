@@ -0,0 +1,396 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/all_to_all.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+#include <hpx/modules/runtime_local.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_sort
+    //
+    // The segmented sort is a sample sort executed by one participant (site)
+    // per segment, all sites run colocated with the data they operate on:
+    //
+    //  1. each site sorts its segment locally
+    //  2. regularly spaced samples are exchanged between all sites, every
+    //     site selects the same set of splitters from those
+    //  3. the locally sorted data is split into runs along the splitters and
+    //     the runs are exchanged such that site i receives all elements of
+    //     bucket i (all-to-all)
+    //  4. the received runs are merged into the (sorted) bucket
+    //  5. the buckets are redistributed to match the original sizes of the
+    //     segments (all-to-all) and copied back into the segments
+    //
+    /// \cond NOINTERNAL
+
+    // number of samples contributed by each site per participating site
+    inline constexpr std::size_t segmented_sort_oversampling = 16;
+
+    inline std::string segmented_sort_basename()
+    {
+        static std::atomic<std::size_t> sequence_number(0);
+        return "/hpx/segmented_sort/" + std::to_string(hpx::get_locality_id()) +
+            "/" + std::to_string(++sequence_number);
+    }
+
+    template <typename T, typename Comp>
+    std::vector<T> segmented_sort_select_splitters(
+        std::vector<std::vector<T>>&& samples, std::size_t num_sites,
+        Comp const& comp)
+    {
+        std::vector<T> all_samples;
+        for (auto& s : samples)
+        {
+            all_samples.insert(all_samples.end(),
+                std::make_move_iterator(s.begin()),
+                std::make_move_iterator(s.end()));
+        }
+
+        std::vector<T> splitters;
+        if (all_samples.empty())
+        {
+            return splitters;
+        }
+
+        std::sort(all_samples.begin(), all_samples.end(), comp);
+
+        splitters.reserve(num_sites - 1);
+        for (std::size_t i = 1; i != num_sites; ++i)
+        {
+            splitters.push_back(
+                all_samples[i * all_samples.size() / num_sites]);
+        }
+        return splitters;
+    }
+
+    template <typename T, typename Comp>
+    std::vector<T> segmented_sort_merge_runs(
+        std::vector<std::vector<T>>&& runs, Comp const& comp)
+    {
+        if (runs.empty())
+        {
+            return std::vector<T>();
+        }
+
+        // merge neighboring runs until only one is left
+        while (runs.size() > 1)
+        {
+            std::vector<std::vector<T>> merged;
+            merged.reserve((runs.size() + 1) / 2);
+
+            for (std::size_t i = 0; i + 1 < runs.size(); i += 2)
+            {
+                std::vector<T> result;
+                result.reserve(runs[i].size() + runs[i + 1].size());
+                std::merge(std::make_move_iterator(runs[i].begin()),
+                    std::make_move_iterator(runs[i].end()),
+                    std::make_move_iterator(runs[i + 1].begin()),
+                    std::make_move_iterator(runs[i + 1].end()),
+                    std::back_inserter(result), comp);
+                merged.push_back(HPX_MOVE(result));
+            }
+            if (runs.size() % 2 != 0)
+            {
+                merged.push_back(HPX_MOVE(runs.back()));
+            }
+
+            runs = HPX_MOVE(merged);
+        }
+
+        return HPX_MOVE(runs.front());
+    }
+
+    // Executed colocated with the segment [first, last), which is the
+    // segment number 'this_site' out of 'sizes.size()' segments.
+    template <typename LocalIter, typename Comp>
+    void segmented_sort_site(std::string const& basename,
+        std::vector<std::size_t> const& sizes, std::size_t this_site,
+        LocalIter first_, LocalIter last_, Comp const& comp, bool is_parallel)
+    {
+        using local_traits =
+            hpx::traits::segmented_local_iterator_traits<LocalIter>;
+        using value_type = typename std::iterator_traits<LocalIter>::value_type;
+
+        auto first = local_traits::local(first_);
+        auto last = local_traits::local(last_);
+
+        std::size_t const num_sites = sizes.size();
+        std::size_t const size = std::distance(first, last);
+        HPX_ASSERT(this_site < num_sites && size == sizes[this_site]);
+
+        // 1. sort the local data
+        if (is_parallel)
+        {
+            hpx::sort(hpx::execution::par, first, last, comp);
+        }
+        else
+        {
+            hpx::sort(first, last, comp);
+        }
+
+        if (num_sites == 1)
+        {
+            return;
+        }
+
+        using namespace hpx::collectives;
+        communicator comm = create_communicator(basename.c_str(),
+            num_sites_arg(num_sites), this_site_arg(this_site));
+
+        // 2. exchange samples, select splitters
+        std::size_t const num_samples =
+            (std::min)(size, num_sites * segmented_sort_oversampling);
+
+        std::vector<value_type> samples;
+        samples.reserve(num_samples);
+        for (std::size_t i = 0; i != num_samples; ++i)
+        {
+            samples.push_back(
+                *std::next(first, (2 * i + 1) * size / (2 * num_samples)));
+        }
+
+        std::vector<value_type> const splitters =
+            segmented_sort_select_splitters(
+                all_gather(comm, HPX_MOVE(samples), this_site_arg(this_site),
+                    generation_arg(1))
+                    .get(),
+                num_sites, comp);
+
+        // 3. split the local data into runs, one for each bucket
+        std::vector<std::vector<value_type>> runs(num_sites);
+
+        auto it = first;
+        for (std::size_t i = 0; i != num_sites && it != last; ++i)
+        {
+            auto next = i < splitters.size() ?
+                std::lower_bound(it, last, splitters[i], comp) :
+                last;
+            runs[i].assign(
+                std::make_move_iterator(it), std::make_move_iterator(next));
+            it = next;
+        }
+
+        // 4. receive all runs of the local bucket and merge those
+        std::vector<value_type> bucket = segmented_sort_merge_runs(
+            all_to_all(comm, HPX_MOVE(runs), this_site_arg(this_site),
+                generation_arg(2))
+                .get(),
+            comp);
+
+        // 5. redistribute the buckets to the original segment sizes
+        std::vector<std::size_t> const bucket_sizes =
+            all_gather(comm, static_cast<std::size_t>(bucket.size()),
+                this_site_arg(this_site), generation_arg(3))
+                .get();
+
+        std::size_t bucket_begin = 0;
+        for (std::size_t i = 0; i != this_site; ++i)
+        {
+            bucket_begin += bucket_sizes[i];
+        }
+        std::size_t const bucket_end = bucket_begin + bucket.size();
+
+        std::vector<std::vector<value_type>> parts(num_sites);
+
+        std::size_t segment_begin = 0;
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            std::size_t const segment_end = segment_begin + sizes[i];
+
+            std::size_t const part_begin = (std::max)(segment_begin, bucket_begin);
+            std::size_t const part_end = (std::min)(segment_end, bucket_end);
+            if (part_begin < part_end)
+            {
+                parts[i].assign(std::make_move_iterator(std::next(bucket.begin(),
+                                    part_begin - bucket_begin)),
+                    std::make_move_iterator(
+                        std::next(bucket.begin(), part_end - bucket_begin)));
+            }
+
+            segment_begin = segment_end;
+        }
+
+        // the received parts are ordered by site, i.e. they are sorted
+        std::vector<std::vector<value_type>> received =
+            all_to_all(comm, HPX_MOVE(parts), this_site_arg(this_site),
+                generation_arg(4))
+                .get();
+
+        auto out = first;
+        for (auto& part : received)
+        {
+            out = std::move(part.begin(), part.end(), out);
+        }
+        HPX_ASSERT(out == last);
+    }
+
+    template <typename LocalIter, typename Comp>
+    struct segmented_sort_site_action
+      : hpx::actions::make_action<
+            decltype(&segmented_sort_site<LocalIter, Comp>),
+            &segmented_sort_site<LocalIter, Comp>,
+            segmented_sort_site_action<LocalIter, Comp>>::type
+    {
+    };
+
+    template <typename ExPolicy, typename SegIter, typename Comp>
+    util::detail::algorithm_result_t<ExPolicy> segmented_sort(
+        ExPolicy&& policy, SegIter first, SegIter last, Comp&& comp)
+    {
+        using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+        using segment_iterator = typename traits::segment_iterator;
+        using local_iterator_type = typename traits::local_iterator;
+        using result = util::detail::algorithm_result<ExPolicy>;
+
+        constexpr bool is_parallel =
+            !hpx::is_sequenced_execution_policy_v<ExPolicy>;
+
+        // collect all non-empty segments
+        std::vector<hpx::id_type> ids;
+        std::vector<local_iterator_type> begins;
+        std::vector<local_iterator_type> ends;
+        std::vector<std::size_t> sizes;
+
+        auto add_segment = [&](segment_iterator const& sit,
+                               local_iterator_type const& beg,
+                               local_iterator_type const& end) {
+            if (beg != end)
+            {
+                ids.push_back(traits::get_id(sit));
+                begins.push_back(beg);
+                ends.push_back(end);
+                sizes.push_back(std::distance(beg, end));
+            }
+        };
+
+        segment_iterator sit = traits::segment(first);
+        segment_iterator send = traits::segment(last);
+
+        if (sit == send)
+        {
+            // all elements are on the same partition
+            add_segment(sit, traits::local(first), traits::local(last));
+        }
+        else
+        {
+            // handle the remaining part of the first partition
+            add_segment(sit, traits::local(first), traits::end(sit));
+
+            // handle all of the full partitions
+            for (++sit; sit != send; ++sit)
+            {
+                add_segment(sit, traits::begin(sit), traits::end(sit));
+            }
+
+            // handle the beginning of the last partition
+            add_segment(sit, traits::begin(sit), traits::local(last));
+        }
+
+        std::string const basename = segmented_sort_basename();
+
+        segmented_sort_site_action<local_iterator_type, std::decay_t<Comp>>
+            act;
+
+        std::vector<hpx::future<void>> segments;
+        segments.reserve(ids.size());
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            segments.push_back(hpx::async(act, hpx::colocated(ids[i]),
+                basename, sizes, i, begins[i], ends[i], comp, is_parallel));
+        }
+
+        return result::get(hpx::dataflow(
+            hpx::launch::sync,
+            [](std::vector<hpx::future<void>>&& r) {
+                // handle any remote exceptions, will throw on error
+                std::list<std::exception_ptr> errors;
+                parallel::util::detail::handle_remote_exceptions<
+                    ExPolicy>::call(r, errors);
+            },
+            HPX_MOVE(segments)));
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx::segmented {
+
+    // clang-format off
+    template <typename SegIter,
+        typename Comp = hpx::parallel::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    void tag_invoke(hpx::sort_t, SegIter first, SegIter last, Comp comp = Comp())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        if (first == last)
+        {
+            return;
+        }
+
+        hpx::parallel::detail::segmented_sort(
+            hpx::execution::seq, first, last, HPX_MOVE(comp));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter,
+        typename Comp = hpx::parallel::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy> tag_invoke(
+        hpx::sort_t, ExPolicy&& policy, SegIter first, SegIter last,
+        Comp comp = Comp())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        if (first == last)
+        {
+            return hpx::parallel::util::detail::algorithm_result<
+                ExPolicy>::get();
+        }
+
+        return hpx::parallel::detail::segmented_sort(
+            HPX_FORWARD(ExPolicy, policy), first, last, HPX_MOVE(comp));
+    }
+}    // namespace hpx::segmented
@@ -0,0 +1,156 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+unsigned int seed = std::random_device{}();
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> fill_random(hpx::partitioned_vector<T>& v, T max_value)
+{
+    std::mt19937 gen(seed++);
+    std::uniform_int_distribution<int> dist(0, static_cast<int>(max_value));
+
+    std::vector<T> values(v.size());
+    for (auto& val : values)
+    {
+        val = static_cast<T>(dist(gen));
+    }
+    std::copy(values.begin(), values.end(), v.begin());
+    return values;
+}
+
+template <typename T>
+std::vector<std::size_t> get_partition_sizes(hpx::partitioned_vector<T>& v)
+{
+    std::vector<std::size_t> sizes;
+    using traits = hpx::traits::segmented_iterator_traits<
+        typename hpx::partitioned_vector<T>::iterator>;
+
+    auto sit = traits::segment(v.begin());
+    auto send = traits::segment(v.end());
+    for (/**/; sit != send; ++sit)
+    {
+        sizes.push_back(std::distance(traits::begin(sit), traits::end(sit)));
+    }
+    return sizes;
+}
+
+template <typename T, typename Comp>
+void verify_sorted(hpx::partitioned_vector<T> const& v, std::size_t first,
+    std::size_t last, std::vector<T> expected, Comp comp)
+{
+    std::sort(expected.begin() + first, expected.begin() + last, comp);
+
+    std::vector<T> actual(v.size());
+    std::copy(v.begin(), v.end(), actual.begin());
+
+    HPX_TEST(actual == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy(
+    std::size_t size, DistPolicy const& dist_policy, ExPolicy const& policy)
+{
+    hpx::partitioned_vector<T> c(size, dist_policy);
+
+    // full range, many duplicates
+    std::vector<T> values = fill_random(c, T(10));
+    std::vector<std::size_t> const sizes = get_partition_sizes(c);
+
+    hpx::sort(policy, c.begin(), c.end());
+    verify_sorted(c, 0, size, values, std::less<T>());
+    HPX_TEST(get_partition_sizes(c) == sizes);
+
+    // full range, custom comparison
+    values = fill_random(c, T(10000));
+    hpx::sort(policy, c.begin(), c.end(), std::greater<T>());
+    verify_sorted(c, 0, size, values, std::greater<T>());
+
+    // partial range
+    values = fill_random(c, T(10000));
+    hpx::sort(policy, c.begin() + 1, c.end() - 1);
+    verify_sorted(c, 1, size - 1, values, std::less<T>());
+    HPX_TEST(get_partition_sizes(c) == sizes);
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy_async(
+    std::size_t size, DistPolicy const& dist_policy, ExPolicy const& policy)
+{
+    hpx::partitioned_vector<T> c(size, dist_policy);
+
+    std::vector<T> values = fill_random(c, T(10000));
+
+    hpx::future<void> f = hpx::sort(policy, c.begin(), c.end());
+    f.get();
+
+    verify_sorted(c, 0, size, values, std::less<T>());
+}
+
+template <typename T, typename DistPolicy>
+void sort_tests_with_policy(std::size_t size, DistPolicy const& dist_policy)
+{
+    using namespace hpx::execution;
+
+    // sequential overload
+    {
+        hpx::partitioned_vector<T> c(size, dist_policy);
+        std::vector<T> values = fill_random(c, T(10000));
+
+        hpx::sort(c.begin(), c.end());
+        verify_sorted(c, 0, size, values, std::less<T>());
+    }
+
+    sort_algo_tests_with_policy<T>(size, dist_policy, seq);
+    sort_algo_tests_with_policy<T>(size, dist_policy, par);
+
+    sort_algo_tests_with_policy_async<T>(size, dist_policy, seq(task));
+    sort_algo_tests_with_policy_async<T>(size, dist_policy, par(task));
+}
+
+template <typename T>
+void sort_tests()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    for (std::size_t size : {std::size_t(13), std::size_t(1000)})
+    {
+        sort_tests_with_policy<T>(size, hpx::container_layout);
+        sort_tests_with_policy<T>(size, hpx::container_layout(3));
+        sort_tests_with_policy<T>(size, hpx::container_layout(3, localities));
+        sort_tests_with_policy<T>(size, hpx::container_layout(localities));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    sort_tests<double>();
+    sort_tests<int>();
+
+    return hpx::util::report_errors();
+}
+#endif
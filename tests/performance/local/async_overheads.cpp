@@ -9,6 +9,7 @@
 #include <hpx/init.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include "queue_backends.hpp"
 #include "worker_timed.hpp"
 
 #include <algorithm>
@@ -141,10 +142,14 @@ int main(int argc, char* argv[])
         ("delay,d", value<std::uint64_t>(&delay_ns)->default_value(0),
         "time spent in the delay loop [ns]");
     // clang-format on
+    desc_commandline.add(queue_backend_options());
 
     // Initialize and run HPX
     hpx::init_params init_args;
     init_args.desc_cmdline = desc_commandline;
+    init_args.rp_callback = [](auto& rp, variables_map const& vm) {
+        select_queue_backend(rp, vm);
+    };
 
     return hpx::init(argc, argv, init_args);
 }
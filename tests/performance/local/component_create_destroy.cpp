@@ -0,0 +1,161 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of creating and destroying small
+// managed components concurrently on all worker threads. Run it with
+// increasing values of --hpx:threads to measure the scalability of the
+// component heaps.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/chrono.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/future.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+using hpx::chrono::high_resolution_timer;
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::int64_t> num_alive(0);
+
+struct small_server
+  : hpx::components::managed_component_base<small_server>
+{
+    small_server() noexcept
+    {
+        ++num_alive;
+    }
+
+    ~small_server()
+    {
+        --num_alive;
+    }
+};
+
+using small_server_type = hpx::components::managed_component<small_server>;
+HPX_REGISTER_COMPONENT(small_server_type, small_server)
+
+///////////////////////////////////////////////////////////////////////////////
+void create_destroy(std::uint64_t count, std::uint64_t batch)
+{
+    std::vector<hpx::id_type> ids;
+    ids.reserve(batch);
+
+    for (std::uint64_t i = 0; i < count; /**/)
+    {
+        for (std::uint64_t j = 0; j != batch && i != count; ++j, ++i)
+        {
+            ids.push_back(hpx::local_new<small_server>(hpx::launch::sync));
+        }
+
+        // releasing the last reference destroys the components
+        ids.clear();
+    }
+}
+
+double measure_create_destroy(
+    std::uint64_t count, std::uint64_t batch, std::size_t num_tasks)
+{
+    high_resolution_timer const t;
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        std::uint64_t const task_count =
+            (i + 1) * count / num_tasks - i * count / num_tasks;
+        tasks.push_back(hpx::async(&create_destroy, task_count, batch));
+    }
+    hpx::wait_all(tasks);
+
+    // components are destroyed asynchronously once AGAS has processed the
+    // (batched) reference count decrements
+    hpx::agas::garbage_collect();
+    hpx::util::yield_while([]() { return num_alive.load() != 0; });
+
+    return t.elapsed();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    std::uint64_t const count = vm["components"].as<std::uint64_t>();
+    std::uint64_t const batch = vm["batch"].as<std::uint64_t>();
+    int const repetitions = vm["repetitions"].as<int>();
+
+    if (count == 0 || batch == 0)
+    {
+        throw std::logic_error(
+            "error: the number of components and the batch size must be "
+            "positive");
+    }
+
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+    std::size_t const num_tasks = 4 * num_threads;
+
+    // warm up the heaps
+    measure_create_destroy(count, batch, num_tasks);
+
+    double elapsed = 0.0;
+    for (int i = 0; i != repetitions; ++i)
+    {
+        elapsed += measure_create_destroy(count, batch, num_tasks);
+    }
+    elapsed /= repetitions;
+
+    std::ostringstream temp;
+    hpx::util::format_to(temp,
+        "threads, {:4}, components, {:10}, batch, {:6}, duration [s], "
+        "{:10.6f}, components/s, {:12.0f}\n",
+        num_threads, count, batch, elapsed,
+        static_cast<double>(count) / elapsed);
+    std::cout << temp.str() << std::flush;
+
+    hpx::util::print_cdash_timing("ComponentCreateDestroy", elapsed);
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("components", value<std::uint64_t>()->default_value(500000),
+         "number of components to create and destroy")
+        ("batch", value<std::uint64_t>()->default_value(128),
+         "number of components a task keeps alive at the same time")
+        ("repetitions", value<int>()->default_value(3),
+         "number of repetitions of the benchmark");
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -18,6 +18,7 @@
 #include <numeric>
 #include <vector>
 
+#include "queue_backends.hpp"
 #include "worker_timed.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -123,9 +124,13 @@ int main(int argc, char* argv[])
         ("no-parent", "do not test child-stealing (launch::async only)")
         ;
     // clang-format on
+    cmdline.add(queue_backend_options());
 
     hpx::local::init_params init_args;
     init_args.desc_cmdline = cmdline;
+    init_args.rp_callback = [](auto& rp, po::variables_map const& vm) {
+        select_queue_backend(rp, vm);
+    };
 
     return hpx::local::init(hpx_main, argc, argv, init_args);
 }
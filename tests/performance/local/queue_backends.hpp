@@ -0,0 +1,104 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Helpers allowing to run the scheduler benchmarks with a local priority queue
+// scheduler using one of the available queue backends, e.g.:
+//
+//     skynet --queue-backend=chase-lev
+
+#pragma once
+
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/thread_pools.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+
+inline hpx::program_options::options_description queue_backend_options()
+{
+    hpx::program_options::options_description desc("Queue backend options");
+
+    // clang-format off
+    desc.add_options()
+        ("queue-backend",
+         hpx::program_options::value<std::string>()->default_value("default"),
+         "the queue backend of the local priority scheduler to use for the "
+         "default pool: default (use --hpx:queuing), fifo, lifo, abp-fifo, "
+         "abp-lifo, or chase-lev")
+        ;
+    // clang-format on
+
+    return desc;
+}
+
+template <typename QueueBackend, typename Partitioner>
+void create_default_pool(Partitioner& rp)
+{
+    using scheduler_type =
+        hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+            QueueBackend>;
+
+    rp.create_thread_pool("default",
+        [](hpx::threads::thread_pool_init_parameters thread_pool_init,
+            hpx::threads::policies::thread_queue_init_parameters
+                thread_queue_init)
+            -> std::unique_ptr<hpx::threads::thread_pool_base> {
+            typename scheduler_type::init_parameter_type init(
+                thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
+                thread_pool_init.num_threads_, thread_queue_init,
+                "queue_backend_scheduler");
+            std::unique_ptr<scheduler_type> scheduler(new scheduler_type(init));
+
+            return std::make_unique<
+                hpx::threads::detail::scheduled_thread_pool<scheduler_type>>(
+                std::move(scheduler), thread_pool_init);
+        });
+}
+
+// Use as (part of) the resource partitioner callback.
+template <typename Partitioner>
+void select_queue_backend(
+    Partitioner& rp, hpx::program_options::variables_map const& vm)
+{
+    std::string const backend = vm["queue-backend"].as<std::string>();
+    if (backend == "default")
+    {
+        return;
+    }
+
+    if (backend == "fifo")
+    {
+        create_default_pool<hpx::threads::policies::lockfree_fifo>(rp);
+    }
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+    else if (backend == "lifo")
+    {
+        create_default_pool<hpx::threads::policies::lockfree_lifo>(rp);
+    }
+    else if (backend == "abp-fifo")
+    {
+        create_default_pool<hpx::threads::policies::lockfree_abp_fifo>(rp);
+    }
+    else if (backend == "abp-lifo")
+    {
+        create_default_pool<hpx::threads::policies::lockfree_abp_lifo>(rp);
+    }
+#endif
+    else if (backend == "chase-lev")
+    {
+        create_default_pool<hpx::threads::policies::lockfree_chase_lev>(rp);
+    }
+    else
+    {
+        std::cerr << "unknown (or unsupported) queue backend: " << backend
+                  << ", using the default scheduler\n";
+    }
+}
@@ -25,6 +25,8 @@
 #include <iostream>
 #include <vector>
 
+#include "queue_backends.hpp"
+
 ///////////////////////////////////////////////////////////////////////////////
 std::int64_t skynet(std::int64_t num, std::int64_t size, std::int64_t div)
 {
@@ -111,5 +113,16 @@ int hpx_main()
 
 int main(int argc, char* argv[])
 {
-    return hpx::local::init(hpx_main, argc, argv);
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+    cmdline.add(queue_backend_options());
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.rp_callback = [](auto& rp,
+                                hpx::program_options::variables_map const& vm) {
+        select_queue_backend(rp, vm);
+    };
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
 }